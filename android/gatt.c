@@ -97,6 +97,8 @@ struct gatt_app {
 	/* Valid for client applications */
 	struct queue *notifications;
 
+	GHashTable *connections;	/* gatt_device -> app_connection */
+
 	gatt_conn_cb_t func;
 
 	struct adv_instance *adv;
@@ -136,9 +138,7 @@ struct notification_data {
 	struct hal_gatt_srvc_id service;
 	struct hal_gatt_gatt_id ch;
 	struct app_connection *conn;
-	guint notif_id;
-	guint ind_id;
-	int ref;
+	uint16_t handle;
 };
 
 struct gatt_device {
@@ -154,6 +154,10 @@ struct gatt_device {
 	guint watch_id;
 	guint server_id;
 	guint ind_id;
+	guint notif_id;
+
+	/* Characteristic value handle -> queue of notification_data */
+	GHashTable *notifications;
 
 	int ref;
 
@@ -188,6 +192,10 @@ static struct queue *gatt_apps = NULL;
 static struct queue *gatt_devices = NULL;
 static struct queue *app_connections = NULL;
 
+/* Lookups done for every request and response */
+static GHashTable *apps_by_id = NULL;
+static GHashTable *connections_by_id = NULL;
+
 static struct queue *services_sdp = NULL;
 
 static struct queue *listen_apps = NULL;
@@ -335,7 +343,7 @@ static bool match_app_by_id(const void *data, const void *user_data)
 
 static struct gatt_app *find_app_by_id(int32_t id)
 {
-	return queue_find(gatt_apps, match_app_by_id, INT_TO_PTR(id));
+	return g_hash_table_lookup(apps_by_id, INT_TO_PTR(id));
 }
 
 static bool match_device_by_bdaddr(const void *data, const void *user_data)
@@ -388,8 +396,7 @@ static struct app_connection *find_connection_by_id(int32_t conn_id)
 {
 	struct app_connection *conn;
 
-	conn = queue_find(app_connections, match_connection_by_id,
-							INT_TO_PTR(conn_id));
+	conn = g_hash_table_lookup(connections_by_id, INT_TO_PTR(conn_id));
 	if (conn && conn->device->state == DEVICE_CONNECTED)
 		return conn;
 
@@ -524,40 +531,79 @@ static bool match_char_by_element_id(const void *data, const void *user_data)
 	return false;
 }
 
-static void destroy_notification(void *data)
+static bool match_notification_by_conn(const void *data,
+							const void *user_data)
 {
-	struct notification_data *notification = data;
-	struct gatt_app *app;
+	const struct notification_data *notification = data;
 
-	if (!notification)
-		return;
+	return notification->conn == user_data;
+}
 
-	if (--notification->ref)
+static void destroy_notification_queue(void *data)
+{
+	queue_destroy(data, NULL);
+}
+
+static void add_device_notification(struct notification_data *notification)
+{
+	struct gatt_device *dev = notification->conn->device;
+	struct queue *q;
+
+	q = g_hash_table_lookup(dev->notifications,
+					UINT_TO_PTR(notification->handle));
+	if (!q) {
+		q = queue_new();
+		g_hash_table_insert(dev->notifications,
+					UINT_TO_PTR(notification->handle), q);
+	}
+
+	queue_push_tail(q, notification);
+}
+
+static void remove_device_notification(struct notification_data *notification)
+{
+	struct gatt_device *dev = notification->conn->device;
+	struct queue *q;
+
+	q = g_hash_table_lookup(dev->notifications,
+					UINT_TO_PTR(notification->handle));
+	if (!q)
 		return;
 
-	app = notification->conn->app;
-	queue_remove_if(app->notifications, match_notification, notification);
+	queue_remove(q, notification);
+
+	if (queue_isempty(q))
+		g_hash_table_remove(dev->notifications,
+					UINT_TO_PTR(notification->handle));
+}
+
+static void destroy_notification(void *data)
+{
+	struct notification_data *notification = data;
+
+	remove_device_notification(notification);
 	free(notification);
 }
 
 static void unregister_notification(void *data)
 {
 	struct notification_data *notification = data;
-	struct gatt_device *dev = notification->conn->device;
 
-	/*
-	 * No device means it was already disconnected and client cleanup was
-	 * triggered afterwards, but once client unregisters, device stays if
-	 * used by others. Then just unregister single handle.
-	 */
-	if (!queue_find(gatt_devices, NULL, dev))
-		return;
+	queue_remove(notification->conn->app->notifications, notification);
+	destroy_notification(notification);
+}
 
-	if (notification->notif_id && dev)
-		g_attrib_unregister(dev->attrib, notification->notif_id);
+static void clear_device_notifications(void *key, void *value,
+							void *user_data)
+{
+	struct queue *q = value;
+	struct notification_data *notification;
 
-	if (notification->ind_id && dev)
-		g_attrib_unregister(dev->attrib, notification->ind_id);
+	while ((notification = queue_pop_head(q))) {
+		queue_remove(notification->conn->app->notifications,
+								notification);
+		free(notification);
+	}
 }
 
 static void device_set_state(struct gatt_device *dev, uint32_t state)
@@ -614,6 +660,13 @@ static void connection_cleanup(struct gatt_device *device)
 		if (device->ind_id > 0)
 			g_attrib_unregister(device->attrib, device->ind_id);
 
+		if (device->notif_id > 0)
+			g_attrib_unregister(device->attrib, device->notif_id);
+
+		device->server_id = 0;
+		device->ind_id = 0;
+		device->notif_id = 0;
+
 		device->attrib = NULL;
 		g_attrib_cancel_all(attrib);
 		g_attrib_unref(attrib);
@@ -633,6 +686,11 @@ static void connection_cleanup(struct gatt_device *device)
 	if (!bt_device_is_bonded(&device->bdaddr))
 		queue_remove_all(device->services, NULL, NULL, destroy_service);
 
+	/* Registrations for notifications do not outlive the link */
+	g_hash_table_foreach(device->notifications, clear_device_notifications,
+									NULL);
+	g_hash_table_remove_all(device->notifications);
+
 	device_set_state(device, DEVICE_DISCONNECTED);
 
 	if (!queue_isempty(device->autoconnect_apps))
@@ -678,6 +736,8 @@ static void destroy_gatt_app(void *data)
 
 	queue_destroy(app->notifications, free);
 
+	g_hash_table_destroy(app->connections);
+
 	free_adv_instance(app->adv);
 
 	free(app);
@@ -718,6 +778,7 @@ static void destroy_device(void *data)
 	queue_destroy(dev->services, destroy_service);
 	queue_destroy(dev->pending_requests, destroy_pending_request);
 	queue_destroy(dev->autoconnect_apps, NULL);
+	g_hash_table_destroy(dev->notifications);
 
 	bt_auto_connect_remove(&dev->bdaddr);
 
@@ -756,6 +817,9 @@ static struct gatt_device *create_device(const bdaddr_t *addr)
 	dev->services = queue_new();
 	dev->autoconnect_apps = queue_new();
 	dev->pending_requests = queue_new();
+	dev->notifications = g_hash_table_new_full(g_direct_hash,
+						g_direct_equal, NULL,
+						destroy_notification_queue);
 
 	queue_push_head(gatt_devices, dev);
 
@@ -859,6 +923,18 @@ static void destroy_connection(void *data)
 	if (!conn)
 		return;
 
+	if (g_hash_table_lookup(connections_by_id, INT_TO_PTR(conn->id)) == conn)
+		g_hash_table_remove(connections_by_id, INT_TO_PTR(conn->id));
+
+	if (conn->app && g_hash_table_lookup(conn->app->connections,
+						conn->device) == conn)
+		g_hash_table_remove(conn->app->connections, conn->device);
+
+	if (conn->app && conn->app->notifications)
+		queue_remove_all(conn->app->notifications,
+					match_notification_by_conn, conn,
+					destroy_notification);
+
 	if (conn->timeout_id > 0)
 		g_source_remove(conn->timeout_id);
 
@@ -1109,6 +1185,11 @@ static struct app_connection *create_connection(struct gatt_device *device,
 
 	new_conn->device = device_ref(device);
 
+	g_hash_table_insert(connections_by_id, INT_TO_PTR(new_conn->id),
+								new_conn);
+	if (app)
+		g_hash_table_insert(app->connections, device, new_conn);
+
 	return new_conn;
 }
 
@@ -1397,9 +1478,14 @@ static struct app_connection *find_conn_without_app(struct gatt_device *dev)
 								&conn_match);
 }
 
+static struct app_connection *find_app_connection(struct gatt_device *dev,
+							struct gatt_app *app)
+{
+	return g_hash_table_lookup(app->connections, dev);
+}
+
 static struct app_connection *find_conn(const bdaddr_t *addr, int32_t app_id)
 {
-	struct app_connection conn_match;
 	struct gatt_device *dev;
 	struct gatt_app *app;
 
@@ -1417,11 +1503,7 @@ static struct app_connection *find_conn(const bdaddr_t *addr, int32_t app_id)
 		return NULL;
 	}
 
-	conn_match.device = dev;
-	conn_match.app = app;
-
-	return queue_find(app_connections, match_connection_by_device_and_app,
-								&conn_match);
+	return find_app_connection(dev, app);
 }
 
 static void create_app_connection(void *data, void *user_data)
@@ -1439,6 +1521,56 @@ static void create_app_connection(void *data, void *user_data)
 		create_connection(dev, app);
 }
 
+struct notification_pdu {
+	const uint8_t *pdu;
+	uint16_t len;
+};
+
+static void handle_notification(void *data, void *user_data)
+{
+	uint8_t buf[IPC_MTU];
+	struct hal_ev_gatt_client_notify *ev = (void *) buf;
+	struct notification_data *notification = data;
+	const struct notification_pdu *n = user_data;
+	const uint8_t *pdu = n->pdu;
+	uint16_t len = n->len;
+	uint8_t data_offset = sizeof(uint8_t) + sizeof(uint16_t);
+
+	memcpy(&ev->char_id, &notification->ch, sizeof(ev->char_id));
+	memcpy(&ev->srvc_id, &notification->service, sizeof(ev->srvc_id));
+	bdaddr2android(&notification->conn->device->bdaddr, &ev->bda);
+	ev->conn_id = notification->conn->id;
+	ev->is_notify = pdu[0] == ATT_OP_HANDLE_NOTIFY;
+
+	/* We have to cut opcode and handle from data */
+	ev->len = len - data_offset;
+	memcpy(ev->value, pdu + data_offset, len - data_offset);
+
+	ipc_send_notif(hal_ipc, HAL_SERVICE_ID_GATT, HAL_EV_GATT_CLIENT_NOTIFY,
+						sizeof(*ev) + ev->len, ev);
+}
+
+static void notify_handler(const uint8_t *pdu, uint16_t len,
+							gpointer user_data)
+{
+	struct gatt_device *dev = user_data;
+	struct notification_pdu n;
+	struct queue *q;
+
+	if (len < sizeof(uint8_t) + sizeof(uint16_t))
+		return;
+
+	q = g_hash_table_lookup(dev->notifications,
+					UINT_TO_PTR(get_le16(pdu + 1)));
+	if (!q)
+		return;
+
+	n.pdu = pdu;
+	n.len = len;
+
+	queue_foreach(q, handle_notification, &n);
+}
+
 static void ind_handler(const uint8_t *cmd, uint16_t cmd_len,
 							gpointer user_data)
 {
@@ -1455,6 +1587,8 @@ static void ind_handler(const uint8_t *cmd, uint16_t cmd_len,
 
 	resp_length = enc_confirmation(opdu, length);
 	g_attrib_send(dev->attrib, 0, opdu, resp_length, NULL, NULL, NULL);
+
+	notify_handler(cmd, cmd_len, dev);
 }
 
 static void connect_cb(GIOChannel *io, GError *gerr, gpointer user_data)
@@ -1526,7 +1660,10 @@ static void connect_cb(GIOChannel *io, GError *gerr, gpointer user_data)
 	dev->ind_id = g_attrib_register(attrib, ATT_OP_HANDLE_IND,
 						GATTRIB_ALL_HANDLES,
 						ind_handler, dev, NULL);
-	if ((dev->server_id && dev->ind_id) == 0)
+	dev->notif_id = g_attrib_register(attrib, ATT_OP_HANDLE_NOTIFY,
+						GATTRIB_ALL_HANDLES,
+						notify_handler, dev, NULL);
+	if ((dev->server_id && dev->ind_id && dev->notif_id) == 0)
 		error("gatt: Could not attach to server");
 
 	device_set_state(dev, DEVICE_CONNECTED);
@@ -1747,11 +1884,14 @@ static struct gatt_app *register_app(const uint8_t *uuid, gatt_type_t type)
 	if (app->type == GATT_CLIENT)
 		app->notifications = queue_new();
 
+	app->connections = g_hash_table_new(g_direct_hash, g_direct_equal);
+
 	memcpy(app->uuid, uuid, sizeof(app->uuid));
 
 	app->id = application_id++;
 
 	queue_push_head(gatt_apps, app);
+	g_hash_table_insert(apps_by_id, INT_TO_PTR(app->id), app);
 
 	if (app->type == GATT_SERVER)
 		queue_push_tail(listen_apps, INT_TO_PTR(app->id));
@@ -1947,6 +2087,8 @@ static uint8_t unregister_app(int client_if)
 		return HAL_STATUS_FAILED;
 	}
 
+	g_hash_table_remove(apps_by_id, INT_TO_PTR(client_if));
+
 	/* Destroy app connections with proper notifications for this app. */
 	queue_remove_all(app_connections, match_connection_by_app, cl,
 							destroy_connection);
@@ -2045,7 +2187,6 @@ reply:
 
 static uint8_t handle_connect(int32_t app_id, const bdaddr_t *addr, bool direct)
 {
-	struct app_connection conn_match;
 	struct app_connection *conn;
 	struct gatt_device *device;
 	struct gatt_app *app;
@@ -2060,11 +2201,7 @@ static uint8_t handle_connect(int32_t app_id, const bdaddr_t *addr, bool direct)
 	if (!device)
 		device = create_device(addr);
 
-	conn_match.device = device;
-	conn_match.app = app;
-
-	conn = queue_find(app_connections, match_connection_by_device_and_app,
-								&conn_match);
+	conn = find_app_connection(device, app);
 	if (!conn) {
 		conn = create_connection(device, app);
 		if (!conn)
@@ -3644,31 +3781,6 @@ reply:
 		send_client_write_execute_notify(cmd->conn_id, GATT_FAILURE);
 }
 
-static void handle_notification(const uint8_t *pdu, uint16_t len,
-							gpointer user_data)
-{
-	uint8_t buf[IPC_MTU];
-	struct hal_ev_gatt_client_notify *ev = (void *) buf;
-	struct notification_data *notification = user_data;
-	uint8_t data_offset = sizeof(uint8_t) + sizeof(uint16_t);
-
-	if (len < data_offset)
-		return;
-
-	memcpy(&ev->char_id, &notification->ch, sizeof(ev->char_id));
-	memcpy(&ev->srvc_id, &notification->service, sizeof(ev->srvc_id));
-	bdaddr2android(&notification->conn->device->bdaddr, &ev->bda);
-	ev->conn_id = notification->conn->id;
-	ev->is_notify = pdu[0] == ATT_OP_HANDLE_NOTIFY;
-
-	/* We have to cut opcode and handle from data */
-	ev->len = len - data_offset;
-	memcpy(ev->value, pdu + data_offset, len - data_offset);
-
-	ipc_send_notif(hal_ipc, HAL_SERVICE_ID_GATT, HAL_EV_GATT_CLIENT_NOTIFY,
-						sizeof(*ev) + ev->len, ev);
-}
-
 static void send_register_for_notification_ev(int32_t id, int32_t registered,
 					int32_t status,
 					const struct hal_gatt_srvc_id *srvc,
@@ -3733,6 +3845,7 @@ static void handle_client_register_for_notification(const void *buf,
 	memcpy(&notification->service, &cmd->srvc_id,
 						sizeof(notification->service));
 	notification->conn = conn;
+	notification->handle = c->ch.value_handle;
 
 	if (queue_find(conn->app->notifications, match_notification,
 								notification)) {
@@ -3741,39 +3854,14 @@ static void handle_client_register_for_notification(const void *buf,
 		goto failed;
 	}
 
-	notification->notif_id = g_attrib_register(conn->device->attrib,
-							ATT_OP_HANDLE_NOTIFY,
-							c->ch.value_handle,
-							handle_notification,
-							notification,
-							destroy_notification);
-	if (!notification->notif_id) {
+	/* Notifications and indications are received by the device */
+	if (!conn->device->notif_id || !conn->device->ind_id) {
 		free(notification);
 		status = HAL_STATUS_FAILED;
 		goto failed;
 	}
 
-	notification->ind_id = g_attrib_register(conn->device->attrib,
-							ATT_OP_HANDLE_IND,
-							c->ch.value_handle,
-							handle_notification,
-							notification,
-							destroy_notification);
-	if (!notification->ind_id) {
-		g_attrib_unregister(conn->device->attrib,
-							notification->notif_id);
-		free(notification);
-		status = HAL_STATUS_FAILED;
-		goto failed;
-	}
-
-	/*
-	 * Because same data - notification - is shared by two handlers, we
-	 * introduce ref counter to be sure that data can be freed with no risk.
-	 * Counter is decremented in destroy_notification.
-	 */
-	notification->ref = 2;
-
+	add_device_notification(notification);
 	queue_push_tail(conn->app->notifications, notification);
 
 	status = HAL_STATUS_SUCCESS;
@@ -4062,8 +4150,7 @@ static void handle_client_test_command(const void *buf, uint16_t len)
 		status = handle_connect(test_client_if, &bdaddr, false);
 		break;
 	case GATT_CLIENT_TEST_CMD_DISCONNECT:
-		app = queue_find(gatt_apps, match_app_by_id,
-						INT_TO_PTR(test_client_if));
+		app = find_app_by_id(test_client_if);
 		queue_remove_all(app_connections, match_connection_by_app, app,
 							destroy_connection);
 
@@ -7232,6 +7319,8 @@ bool bt_gatt_register(struct ipc *ipc, const bdaddr_t *addr)
 	gatt_devices = queue_new();
 	gatt_apps = queue_new();
 	app_connections = queue_new();
+	apps_by_id = g_hash_table_new(g_direct_hash, g_direct_equal);
+	connections_by_id = g_hash_table_new(g_direct_hash, g_direct_equal);
 	listen_apps = queue_new();
 	services_sdp = queue_new();
 	gatt_db = gatt_db_new();
@@ -7276,6 +7365,12 @@ failed:
 	queue_destroy(app_connections, NULL);
 	app_connections = NULL;
 
+	g_hash_table_destroy(apps_by_id);
+	apps_by_id = NULL;
+
+	g_hash_table_destroy(connections_by_id);
+	connections_by_id = NULL;
+
 	queue_destroy(listen_apps, NULL);
 	listen_apps = NULL;
 
@@ -7314,6 +7409,12 @@ void bt_gatt_unregister(void)
 	queue_destroy(gatt_apps, destroy_gatt_app);
 	gatt_apps = NULL;
 
+	g_hash_table_destroy(apps_by_id);
+	apps_by_id = NULL;
+
+	g_hash_table_destroy(connections_by_id);
+	connections_by_id = NULL;
+
 	queue_destroy(gatt_devices, destroy_device);
 	gatt_devices = NULL;
 
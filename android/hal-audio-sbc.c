@@ -9,6 +9,7 @@
 #include <string.h>
 #include <malloc.h>
 #include <stdlib.h>
+#include <stdio.h>
 
 #include <sbc/sbc.h>
 #include "audio-msg.h"
@@ -66,6 +67,8 @@ struct sbc_data {
 
 	unsigned frame_duration;
 	unsigned frames_per_packet;
+
+	unsigned bitpool_changes;
 };
 
 static const a2dp_sbc_t sbc_presets[] = {
@@ -370,17 +373,31 @@ static bool sbc_update_qos(void *codec_data, uint8_t op)
 	struct sbc_data *sbc_data = (struct sbc_data *) codec_data;
 	uint8_t curr_bitpool = sbc_data->enc.bitpool;
 	uint8_t new_bitpool = curr_bitpool;
+	uint8_t min_bitpool = SBC_QUALITY_MIN_BITPOOL;
+	uint8_t max_bitpool = sbc_data->sbc.max_bitpool;
+
+	/* Never go below what the remote has accepted */
+	if (min_bitpool < sbc_data->sbc.min_bitpool)
+		min_bitpool = sbc_data->sbc.min_bitpool;
 
 	switch (op) {
 	case QOS_POLICY_DEFAULT:
-		new_bitpool = sbc_data->sbc.max_bitpool;
+		new_bitpool = max_bitpool;
 		break;
 
 	case QOS_POLICY_DECREASE:
-		if (curr_bitpool > SBC_QUALITY_MIN_BITPOOL) {
+		if (curr_bitpool > min_bitpool) {
 			new_bitpool = curr_bitpool - SBC_QUALITY_STEP;
-			if (new_bitpool < SBC_QUALITY_MIN_BITPOOL)
-				new_bitpool = SBC_QUALITY_MIN_BITPOOL;
+			if (new_bitpool < min_bitpool)
+				new_bitpool = min_bitpool;
+		}
+		break;
+
+	case QOS_POLICY_INCREASE:
+		if (curr_bitpool < max_bitpool) {
+			new_bitpool = curr_bitpool + SBC_QUALITY_STEP;
+			if (new_bitpool > max_bitpool)
+				new_bitpool = max_bitpool;
 		}
 		break;
 	}
@@ -389,6 +406,7 @@ static bool sbc_update_qos(void *codec_data, uint8_t op)
 		return false;
 
 	sbc_data->enc.bitpool = new_bitpool;
+	sbc_data->bitpool_changes++;
 
 	sbc_codec_calculate(sbc_data);
 
@@ -397,6 +415,21 @@ static bool sbc_update_qos(void *codec_data, uint8_t op)
 	return true;
 }
 
+static void sbc_dump(void *codec_data, int fd)
+{
+	struct sbc_data *sbc_data = (struct sbc_data *) codec_data;
+
+	dprintf(fd, "SBC: bitpool %d (%d-%d), %u changes\n",
+				sbc_data->enc.bitpool,
+				sbc_data->sbc.min_bitpool,
+				sbc_data->sbc.max_bitpool,
+				sbc_data->bitpool_changes);
+	dprintf(fd, "SBC: %u frames of %zu bytes per packet, %u us each\n",
+				sbc_data->frames_per_packet,
+				sbc_data->out_frame_len,
+				sbc_data->frame_duration);
+}
+
 static const struct audio_codec codec = {
 	.type = A2DP_CODEC_SBC,
 	.use_rtp = true,
@@ -410,6 +443,7 @@ static const struct audio_codec codec = {
 	.get_mediapacket_duration = sbc_get_mediapacket_duration,
 	.encode_mediapacket = sbc_encode_mediapacket,
 	.update_qos = sbc_update_qos,
+	.dump = sbc_dump,
 };
 
 const struct audio_codec *codec_sbc(void)
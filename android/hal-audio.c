@@ -11,11 +11,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/ioctl.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
 #include <arpa/inet.h>
 #include <fcntl.h>
+#include <termios.h>
 
 #include <hardware/audio.h>
 #include <hardware/hardware.h>
@@ -34,6 +36,18 @@
 
 #define MAX_DELAY	100000 /* 100ms */
 
+/*
+ * Encoder quality control: the bitpool is lowered as soon as the transport
+ * queue fills up or writes start blocking, and raised again one step at a
+ * time only after the link has been clear for a while.
+ */
+#define QOS_QUEUE_HIGH		50	/* % of socket send buffer */
+#define QOS_QUEUE_LOW		15	/* % of socket send buffer */
+#define QOS_WRITE_LATENCY_HIGH	20000	/* 20ms */
+#define QOS_WRITE_LATENCY_LOW	5000	/* 5ms */
+#define QOS_DECREASE_INTERVAL	500000	/* 500ms */
+#define QOS_INCREASE_INTERVAL	3000000	/* 3s */
+
 static const uint8_t a2dp_src_uuid[] = {
 		0x00, 0x00, 0x11, 0x0a, 0x00, 0x00, 0x10, 0x00,
 		0x80, 0x00, 0x00, 0x80, 0x5f, 0x9b, 0x34, 0xfb };
@@ -77,6 +91,15 @@ static uint64_t timespec_diff_us(struct timespec *a, struct timespec *b)
 	return res.tv_sec * 1000000ll + res.tv_nsec / 1000ll;
 }
 
+static uint64_t get_time_us(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ts.tv_sec * 1000000ll + ts.tv_nsec / 1000ll;
+}
+
 #if defined(ANDROID)
 /*
  * Bionic does not have clock_nanosleep() prototype in time.h even though
@@ -99,6 +122,29 @@ static struct {
 
 #define MAX_AUDIO_ENDPOINTS NUM_CODECS
 
+struct audio_stats {
+	uint64_t packets;
+	uint64_t bytes;
+
+	uint64_t encode_count;
+	uint64_t encode_time;
+	uint64_t encode_time_max;
+
+	uint64_t write_count;
+	uint64_t write_time;
+	uint64_t write_time_max;
+
+	unsigned int queue_depth;
+	unsigned int queue_depth_max;
+
+	uint64_t underruns;
+	uint64_t overruns;
+	uint64_t dropped;
+
+	unsigned int qos_decreases;
+	unsigned int qos_increases;
+};
+
 struct audio_endpoint {
 	uint8_t id;
 	const struct audio_codec *codec;
@@ -108,11 +154,22 @@ struct audio_endpoint {
 	struct media_packet *mp;
 	size_t mp_data_len;
 
+	/* PCM held back until there is enough for a full media packet */
+	uint8_t *pcm_buf;
+	size_t pcm_buf_size;
+	size_t pcm_len;
+
 	uint16_t seq;
 	uint32_t samples;
 	struct timespec start;
 
 	bool resync;
+
+	int sndbuf;
+	uint64_t qos_changed;
+	uint64_t qos_clear_since;
+
+	struct audio_stats stats;
 };
 
 static struct audio_endpoint audio_endpoints[MAX_AUDIO_ENDPOINTS];
@@ -472,6 +529,16 @@ static void unregister_endpoints(void)
 	}
 }
 
+static bool get_sndbuf(int fd, int *sndbuf)
+{
+	socklen_t len = sizeof(*sndbuf);
+
+	if (getsockopt(fd, SOL_SOCKET, SO_SNDBUF, sndbuf, &len) < 0)
+		return false;
+
+	return *sndbuf > 0;
+}
+
 static bool open_endpoint(struct audio_endpoint **epp,
 						struct audio_input_config *cfg)
 {
@@ -511,6 +578,7 @@ static bool open_endpoint(struct audio_endpoint **epp,
 		payload_len -= sizeof(struct rtp_header);
 
 	ep->fd = fd;
+	memset(&ep->stats, 0, sizeof(ep->stats));
 
 	codec = ep->codec;
 	codec->init(preset, payload_len, &ep->codec_data);
@@ -530,6 +598,9 @@ static bool open_endpoint(struct audio_endpoint **epp,
 
 	ep->mp_data_len = payload_len;
 
+	if (!get_sndbuf(fd, &ep->sndbuf))
+		ep->sndbuf = 0;
+
 	free(preset);
 
 	return true;
@@ -551,6 +622,11 @@ static void close_endpoint(struct audio_endpoint *ep)
 
 	free(ep->mp);
 
+	free(ep->pcm_buf);
+	ep->pcm_buf = NULL;
+	ep->pcm_buf_size = 0;
+	ep->pcm_len = 0;
+
 	ep->codec->cleanup(ep->codec_data);
 	ep->codec_data = NULL;
 }
@@ -562,9 +638,13 @@ static bool resume_endpoint(struct audio_endpoint *ep)
 
 	ep->samples = 0;
 	ep->resync = false;
+	ep->pcm_len = 0;
 
 	ep->codec->update_qos(ep->codec_data, QOS_POLICY_DEFAULT);
 
+	ep->qos_changed = get_time_us();
+	ep->qos_clear_since = ep->qos_changed;
+
 	return true;
 }
 
@@ -614,11 +694,83 @@ static bool wait_for_endpoint(struct audio_endpoint *ep, bool *writable)
 	return true;
 }
 
-static bool write_to_endpoint(struct audio_endpoint *ep, size_t bytes)
+static void update_queue_depth(struct audio_endpoint *ep)
+{
+	int space;
+
+	if (!ep->sndbuf)
+		return;
+
+	/* On Bluetooth sockets TIOCOUTQ reports the free send buffer space */
+	if (ioctl(ep->fd, TIOCOUTQ, &space) < 0) {
+		ep->sndbuf = 0;
+		return;
+	}
+
+	if (space < 0)
+		space = 0;
+	else if (space > ep->sndbuf)
+		space = ep->sndbuf;
+
+	ep->stats.queue_depth = ep->sndbuf - space;
+	if (ep->stats.queue_depth > ep->stats.queue_depth_max)
+		ep->stats.queue_depth_max = ep->stats.queue_depth;
+}
+
+static void qos_decrease(struct audio_endpoint *ep, uint64_t now)
+{
+	ep->qos_clear_since = now;
+
+	/* Give the previous step a chance to take effect */
+	if (now - ep->qos_changed < QOS_DECREASE_INTERVAL)
+		return;
+
+	if (ep->codec->update_qos(ep->codec_data, QOS_POLICY_DECREASE)) {
+		ep->qos_changed = now;
+		ep->stats.qos_decreases++;
+	}
+}
+
+static void update_qos(struct audio_endpoint *ep, uint64_t write_time,
+								bool dropped)
+{
+	uint64_t now = get_time_us();
+	unsigned int queue = 0;
+
+	if (ep->sndbuf)
+		queue = ep->stats.queue_depth * 100 / ep->sndbuf;
+
+	if (dropped || queue >= QOS_QUEUE_HIGH ||
+					write_time >= QOS_WRITE_LATENCY_HIGH) {
+		qos_decrease(ep, now);
+		return;
+	}
+
+	/* Anything between the watermarks restarts the clear period */
+	if (queue > QOS_QUEUE_LOW || write_time > QOS_WRITE_LATENCY_LOW) {
+		ep->qos_clear_since = now;
+		return;
+	}
+
+	if (now - ep->qos_clear_since < QOS_INCREASE_INTERVAL)
+		return;
+
+	if (ep->codec->update_qos(ep->codec_data, QOS_POLICY_INCREASE)) {
+		ep->qos_changed = now;
+		ep->stats.qos_increases++;
+	}
+
+	ep->qos_clear_since = now;
+}
+
+static bool write_to_endpoint(struct audio_endpoint *ep, size_t bytes,
+								bool *dropped)
 {
 	struct media_packet *mp = (struct media_packet *) ep->mp;
 	int ret;
 
+	*dropped = false;
+
 	while (true) {
 		ret = write(ep->fd, mp, bytes);
 
@@ -630,9 +782,10 @@ static bool write_to_endpoint(struct audio_endpoint *ep, size_t bytes)
 		 * fail, we can try to write next packet
 		 */
 		if (errno == EAGAIN) {
-			ret = errno;
-			warn("write failed (%d)", ret);
-			break;
+			warn("write failed (%d)", errno);
+			ep->stats.overruns++;
+			*dropped = true;
+			return true;
 		}
 
 		if (errno != EINTR) {
@@ -642,121 +795,237 @@ static bool write_to_endpoint(struct audio_endpoint *ep, size_t bytes)
 		}
 	}
 
+	if (ret > 0) {
+		ep->stats.packets++;
+		ep->stats.bytes += ret;
+	}
+
 	return true;
 }
 
-static bool write_data(struct a2dp_stream_out *out, const void *buffer,
-								size_t bytes)
+static bool send_mediapacket(struct a2dp_stream_out *out, const uint8_t *buffer,
+					size_t bytes, size_t *consumed)
 {
 	struct audio_endpoint *ep = out->ep;
 	struct media_packet *mp = (struct media_packet *) ep->mp;
 	struct media_packet_rtp *mp_rtp = (struct media_packet_rtp *) ep->mp;
-	size_t free_space = ep->mp_data_len;
-	size_t consumed = 0;
+	size_t written = 0;
+	ssize_t read;
+	uint32_t samples;
+	int ret;
+	struct timespec current;
+	uint64_t audio_sent, audio_passed;
+	uint64_t encode_start, write_start, elapsed;
+	bool do_write = false;
+	bool dropped;
 
-	while (consumed < bytes) {
-		size_t written = 0;
-		ssize_t read;
-		uint32_t samples;
-		int ret;
-		struct timespec current;
-		uint64_t audio_sent, audio_passed;
-		bool do_write = false;
+	*consumed = 0;
 
-		/*
-		 * prepare media packet in advance so we don't waste time after
-		 * wakeup
-		 */
-		if (ep->codec->use_rtp) {
-			mp_rtp->hdr.sequence_number = htons(ep->seq++);
-			mp_rtp->hdr.timestamp = htonl(ep->samples);
-		}
-		read = ep->codec->encode_mediapacket(ep->codec_data,
-						buffer + consumed,
-						bytes - consumed, mp,
-						free_space, &written);
+	/*
+	 * prepare media packet in advance so we don't waste time after
+	 * wakeup
+	 */
+	if (ep->codec->use_rtp) {
+		mp_rtp->hdr.sequence_number = htons(ep->seq++);
+		mp_rtp->hdr.timestamp = htonl(ep->samples);
+	}
 
-		/*
-		 * not much we can do here, let's just ignore remaining
-		 * data and continue
-		 */
-		if (read <= 0)
-			return true;
+	encode_start = get_time_us();
 
-		/* calculate where are we and where we should be */
-		clock_gettime(CLOCK_MONOTONIC, &current);
-		if (!ep->samples)
-			memcpy(&ep->start, &current, sizeof(ep->start));
-		audio_sent = ep->samples * 1000000ll / out->cfg.rate;
-		audio_passed = timespec_diff_us(&current, &ep->start);
+	read = ep->codec->encode_mediapacket(ep->codec_data, buffer, bytes, mp,
+						ep->mp_data_len, &written);
 
-		/*
-		 * if we're ahead of stream then wait for next write point,
-		 * if we're lagging more than 100ms then stop writing and just
-		 * skip data until we're back in sync
-		 */
-		if (audio_sent > audio_passed) {
-			struct timespec anchor;
+	elapsed = get_time_us() - encode_start;
+	ep->stats.encode_count++;
+	ep->stats.encode_time += elapsed;
+	if (elapsed > ep->stats.encode_time_max)
+		ep->stats.encode_time_max = elapsed;
+
+	/*
+	 * not much we can do here, let's just ignore remaining
+	 * data and continue
+	 */
+	if (read <= 0)
+		return true;
 
-			ep->resync = false;
+	/* calculate where are we and where we should be */
+	clock_gettime(CLOCK_MONOTONIC, &current);
+	if (!ep->samples)
+		memcpy(&ep->start, &current, sizeof(ep->start));
+	audio_sent = ep->samples * 1000000ll / out->cfg.rate;
+	audio_passed = timespec_diff_us(&current, &ep->start);
 
-			timespec_add(&ep->start, audio_sent, &anchor);
+	/*
+	 * if we're ahead of stream then wait for next write point,
+	 * if we're lagging more than 100ms then stop writing and just
+	 * skip data until we're back in sync
+	 */
+	if (audio_sent > audio_passed) {
+		struct timespec anchor;
 
-			while (true) {
-				ret = clock_nanosleep(CLOCK_MONOTONIC,
-							TIMER_ABSTIME, &anchor,
-							NULL);
+		ep->resync = false;
 
-				if (!ret)
-					break;
+		timespec_add(&ep->start, audio_sent, &anchor);
 
-				if (ret != EINTR) {
-					error("clock_nanosleep failed (%d)",
-									ret);
-					return false;
-				}
-			}
-		} else if (!ep->resync) {
-			uint64_t diff = audio_passed - audio_sent;
+		while (true) {
+			ret = clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME,
+								&anchor, NULL);
 
-			if (diff > MAX_DELAY) {
-				warn("lag is %jums, resyncing", diff / 1000);
+			if (!ret)
+				break;
 
-				ep->codec->update_qos(ep->codec_data,
-							QOS_POLICY_DECREASE);
-				ep->resync = true;
+			if (ret != EINTR) {
+				error("clock_nanosleep failed (%d)", ret);
+				return false;
 			}
 		}
+	} else if (!ep->resync) {
+		uint64_t diff = audio_passed - audio_sent;
+
+		if (diff > MAX_DELAY) {
+			warn("lag is %jums, resyncing", diff / 1000);
+
+			qos_decrease(ep, get_time_us());
+			ep->resync = true;
+			ep->stats.underruns++;
+		}
+	}
+
+	/* we send data only in case codec encoded some data, i.e. some
+	 * codecs do internal buffering and output data only if full
+	 * frame can be encoded
+	 * in resync mode we'll just drop mediapackets
+	 */
+	if (written > 0 && ep->resync) {
+		ep->stats.dropped++;
+	} else if (written > 0) {
+		write_start = get_time_us();
 
-		/* we send data only in case codec encoded some data, i.e. some
-		 * codecs do internal buffering and output data only if full
-		 * frame can be encoded
-		 * in resync mode we'll just drop mediapackets
+		/* wait some time for socket to be ready for write,
+		 * but we'll just skip writing data if timeout occurs
 		 */
-		if (written > 0 && !ep->resync) {
-			/* wait some time for socket to be ready for write,
-			 * but we'll just skip writing data if timeout occurs
-			 */
-			if (!wait_for_endpoint(ep, &do_write))
-				return false;
+		if (!wait_for_endpoint(ep, &do_write))
+			return false;
 
-			if (do_write) {
-				if (ep->codec->use_rtp)
-					written += sizeof(struct rtp_header);
+		if (do_write) {
+			if (ep->codec->use_rtp)
+				written += sizeof(struct rtp_header);
 
-				if (!write_to_endpoint(ep, written))
-					return false;
-			}
+			if (!write_to_endpoint(ep, written, &dropped))
+				return false;
+		} else {
+			ep->stats.overruns++;
+			dropped = true;
 		}
 
+		elapsed = get_time_us() - write_start;
+		ep->stats.write_count++;
+		ep->stats.write_time += elapsed;
+		if (elapsed > ep->stats.write_time_max)
+			ep->stats.write_time_max = elapsed;
+
+		update_queue_depth(ep);
+		update_qos(ep, elapsed, dropped);
+	}
+
+	/*
+	 * AudioFlinger provides 16bit PCM, so sample size is 2 bytes
+	 * multiplied by number of channels. Number of channels is
+	 * simply number of bits set in channels mask.
+	 */
+	samples = read / (2 * popcount(out->cfg.channels));
+	ep->samples += samples;
+	*consumed = read;
+
+	return true;
+}
+
+static bool stage_pcm(struct audio_endpoint *ep, const uint8_t *buffer,
+					size_t bytes, size_t size, size_t *staged)
+{
+	size_t len = 0;
+
+	if (size > ep->pcm_buf_size) {
+		uint8_t *buf;
+
+		buf = realloc(ep->pcm_buf, size);
+		if (!buf)
+			return false;
+
+		ep->pcm_buf = buf;
+		ep->pcm_buf_size = size;
+	}
+
+	if (ep->pcm_len < size) {
+		len = size - ep->pcm_len;
+		if (len > bytes)
+			len = bytes;
+
+		memcpy(ep->pcm_buf + ep->pcm_len, buffer, len);
+		ep->pcm_len += len;
+	}
+
+	*staged = len;
+
+	return true;
+}
+
+static bool write_data(struct a2dp_stream_out *out, const void *buffer,
+								size_t bytes)
+{
+	struct audio_endpoint *ep = out->ep;
+	size_t packet_size;
+	size_t consumed = 0;
+
+	/* Amount of PCM encoded into a single, full media packet */
+	packet_size = ep->codec->get_buffer_size(ep->codec_data);
+
+	while (consumed < bytes || (packet_size &&
+					ep->pcm_len >= packet_size)) {
+		size_t len = bytes - consumed;
+		size_t read;
+
 		/*
-		 * AudioFlinger provides 16bit PCM, so sample size is 2 bytes
-		 * multiplied by number of channels. Number of channels is
-		 * simply number of bits set in channels mask.
+		 * Input that would not fill a whole media packet is kept
+		 * and sent together with the start of the next buffer, so
+		 * the link is not loaded with short packets.
 		 */
-		samples = read / (2 * popcount(out->cfg.channels));
-		ep->samples += samples;
-		consumed += read;
+		if (ep->pcm_len || len < packet_size) {
+			size_t staged;
+
+			if (!stage_pcm(ep, buffer + consumed, len, packet_size,
+								&staged))
+				return false;
+
+			consumed += staged;
+
+			if (ep->pcm_len < packet_size)
+				break;
+
+			if (!send_mediapacket(out, ep->pcm_buf, ep->pcm_len,
+								&read))
+				return false;
+
+			if (!read) {
+				ep->pcm_len = 0;
+				return true;
+			}
+
+			ep->pcm_len -= read;
+			memmove(ep->pcm_buf, ep->pcm_buf + read, ep->pcm_len);
+		} else {
+			if (!send_mediapacket(out, buffer + consumed, len,
+								&read))
+				return false;
+
+			if (!read)
+				return true;
+
+			consumed += read;
+		}
+
+		/* Bitpool changes also change the packet size */
+		packet_size = ep->codec->get_buffer_size(ep->codec_data);
 	}
 
 	return true;
@@ -900,8 +1169,39 @@ static int out_standby(struct audio_stream *stream)
 
 static int out_dump(const struct audio_stream *stream, int fd)
 {
+	struct a2dp_stream_out *out = (struct a2dp_stream_out *) stream;
+	struct audio_endpoint *ep = out->ep;
+	struct audio_stats *stats;
+
 	DBG("");
-	return -ENOSYS;
+
+	if (!ep || !ep->codec_data)
+		return 0;
+
+	stats = &ep->stats;
+
+	dprintf(fd, "A2DP: %ju packets, %ju bytes\n", stats->packets,
+							stats->bytes);
+	dprintf(fd, "A2DP: encode time avg %ju us, max %ju us\n",
+			stats->encode_count ?
+			stats->encode_time / stats->encode_count : 0,
+			stats->encode_time_max);
+	dprintf(fd, "A2DP: write time avg %ju us, max %ju us\n",
+			stats->write_count ?
+			stats->write_time / stats->write_count : 0,
+			stats->write_time_max);
+	dprintf(fd, "A2DP: queue depth %u bytes, max %u of %d\n",
+			stats->queue_depth, stats->queue_depth_max,
+			ep->sndbuf);
+	dprintf(fd, "A2DP: %ju underruns, %ju packets dropped, %ju overruns\n",
+			stats->underruns, stats->dropped, stats->overruns);
+	dprintf(fd, "A2DP: quality %u decreases, %u increases\n",
+			stats->qos_decreases, stats->qos_increases);
+
+	if (ep->codec->dump)
+		ep->codec->dump(ep->codec_data, fd);
+
+	return 0;
 }
 
 static int out_set_parameters(struct audio_stream *stream, const char *kvpairs)
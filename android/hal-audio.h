@@ -80,10 +80,12 @@ struct audio_codec {
 					size_t len, struct media_packet *mp,
 					size_t mp_data_len, size_t *written);
 	bool (*update_qos) (void *codec_data, uint8_t op);
+	void (*dump) (void *codec_data, int fd);
 };
 
 #define QOS_POLICY_DEFAULT	0x00
 #define QOS_POLICY_DECREASE	0x01
+#define QOS_POLICY_INCREASE	0x02
 
 typedef const struct audio_codec * (*audio_codec_get_t) (void);
 
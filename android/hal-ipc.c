@@ -116,13 +116,48 @@ static bool handle_msg(void *buf, ssize_t len, int fd)
 	return true;
 }
 
+static bool handle_batch(void *buf, ssize_t len)
+{
+	struct ipc_hdr *batch = buf;
+	uint8_t *data = batch->payload;
+	size_t pos = 0;
+
+	if (len != (ssize_t) (sizeof(*batch) + batch->len)) {
+		error("IPC: batch malformed (%zd bytes)", len);
+		return false;
+	}
+
+	while (pos < batch->len) {
+		struct ipc_hdr *msg = (void *) (data + pos);
+		size_t msg_len;
+
+		if (batch->len - pos < sizeof(*msg)) {
+			error("IPC: batch truncated (%zd bytes)", len);
+			return false;
+		}
+
+		msg_len = sizeof(*msg) + msg->len;
+		if (msg_len > batch->len - pos) {
+			error("IPC: batch truncated (%zd bytes)", len);
+			return false;
+		}
+
+		if (!handle_msg(msg, msg_len, -1))
+			return false;
+
+		pos += msg_len;
+	}
+
+	return true;
+}
+
 static void *notification_handler(void *data)
 {
 	struct msghdr msg;
 	struct iovec iv;
 	struct cmsghdr *cmsg;
 	char cmsgbuf[CMSG_SPACE(sizeof(int))];
-	char buf[IPC_MTU];
+	char buf[IPC_BATCH_MTU];
 	ssize_t ret;
 	int fd;
 
@@ -130,7 +165,6 @@ static void *notification_handler(void *data)
 
 	while (true) {
 		memset(&msg, 0, sizeof(msg));
-		memset(buf, 0, sizeof(buf));
 		memset(cmsgbuf, 0, sizeof(cmsgbuf));
 
 		iv.iov_base = buf;
@@ -174,6 +208,15 @@ static void *notification_handler(void *data)
 			}
 		}
 
+		if (ret >= (ssize_t) sizeof(struct ipc_hdr) &&
+				((struct ipc_hdr *) buf)->service_id ==
+							IPC_SERVICE_ID_BATCH) {
+			if (fd >= 0 || !handle_batch(buf, ret))
+				goto failed;
+
+			continue;
+		}
+
 		if (!handle_msg(buf, ret, fd))
 			goto failed;
 	}
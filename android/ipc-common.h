@@ -10,6 +10,14 @@
 
 #define IPC_MTU 1024
 
+/*
+ * Notifications that could not be sent right away are delivered in batch
+ * frames, with the payload carrying several complete messages back to back.
+ */
+#define IPC_BATCH_MTU		8192
+#define IPC_SERVICE_ID_BATCH	0xff
+#define IPC_OP_BATCH		0x00
+
 #define IPC_STATUS_SUCCESS	0x00
 
 struct ipc_hdr {
@@ -18,6 +18,7 @@
 #include <string.h>
 #include <signal.h>
 #include <stdbool.h>
+#include <poll.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 #include <unistd.h>
@@ -27,6 +28,11 @@
 #include "ipc.h"
 #include "src/log.h"
 
+/* Notifications kept while the HAL is not reading before giving up */
+#define IPC_NOTIF_BACKLOG_MAX	(1024 * 1024)
+
+#define IPC_FLUSH_TIMEOUT	1000	/* ms */
+
 struct service_handler {
 	const struct ipc_handler *handler;
 	uint8_t size;
@@ -46,6 +52,9 @@ struct ipc {
 	GIOChannel *notif_io;
 	guint notif_watch;
 
+	GByteArray *notif_backlog;
+	guint notif_flush_watch;
+
 	ipc_disconnect_cb disconnect_cb;
 	void *disconnect_cb_data;
 };
@@ -68,6 +77,13 @@ static void ipc_disconnect(struct ipc *ipc, bool in_cleanup)
 		ipc->notif_watch = 0;
 	}
 
+	if (ipc->notif_flush_watch) {
+		g_source_remove(ipc->notif_flush_watch);
+		ipc->notif_flush_watch = 0;
+	}
+
+	g_byte_array_set_size(ipc->notif_backlog, 0);
+
 	if (ipc->notif_io) {
 		g_io_channel_shutdown(ipc->notif_io, TRUE, NULL);
 		g_io_channel_unref(ipc->notif_io);
@@ -294,9 +310,11 @@ struct ipc *ipc_init(const char *path, size_t size, int max_service_id,
 	ipc->size = size;
 
 	ipc->notifications = notifications;
+	ipc->notif_backlog = g_byte_array_new();
 
 	ipc->cmd_io = ipc_connect(path, size, cmd_connect_cb, ipc);
 	if (!ipc->cmd_io) {
+		g_byte_array_free(ipc->notif_backlog, TRUE);
 		g_free(ipc->services);
 		g_free(ipc);
 		return NULL;
@@ -312,35 +330,22 @@ void ipc_cleanup(struct ipc *ipc)
 {
 	ipc_disconnect(ipc, true);
 
+	g_byte_array_free(ipc->notif_backlog, TRUE);
 	g_free(ipc->services);
 	g_free(ipc);
 }
 
-static void ipc_send(int sk, uint8_t service_id, uint8_t opcode, uint16_t len,
-							void *param, int fd)
+static int ipc_sendmsg(int sk, struct iovec *iv, int iovcnt, int fd)
 {
 	struct msghdr msg;
-	struct iovec iv[2];
-	struct ipc_hdr m;
 	char cmsgbuf[CMSG_SPACE(sizeof(int))];
 	struct cmsghdr *cmsg;
 
 	memset(&msg, 0, sizeof(msg));
-	memset(&m, 0, sizeof(m));
 	memset(cmsgbuf, 0, sizeof(cmsgbuf));
 
-	m.service_id = service_id;
-	m.opcode = opcode;
-	m.len = len;
-
-	iv[0].iov_base = &m;
-	iv[0].iov_len = sizeof(m);
-
-	iv[1].iov_base = param;
-	iv[1].iov_len = len;
-
 	msg.msg_iov = iv;
-	msg.msg_iovlen = 2;
+	msg.msg_iovlen = iovcnt;
 
 	if (fd >= 0) {
 		msg.msg_control = cmsgbuf;
@@ -355,12 +360,188 @@ static void ipc_send(int sk, uint8_t service_id, uint8_t opcode, uint16_t len,
 		memcpy(CMSG_DATA(cmsg), &fd, sizeof(int));
 	}
 
-	if (sendmsg(sk, &msg, 0) < 0) {
-		error("IPC send failed :%s", strerror(errno));
+	while (sendmsg(sk, &msg, 0) < 0) {
+		if (errno != EINTR)
+			return -errno;
+	}
+
+	return 0;
+}
+
+static void ipc_send_failed(int err)
+{
+	error("IPC send failed :%s", strerror(-err));
+
+	/* TODO disconnect IPC here when this function becomes static */
+	raise(SIGTERM);
+}
+
+static int ipc_send_msg(int sk, uint8_t service_id, uint8_t opcode,
+					uint16_t len, void *param, int fd)
+{
+	struct iovec iv[2];
+	struct ipc_hdr m;
+
+	memset(&m, 0, sizeof(m));
+
+	m.service_id = service_id;
+	m.opcode = opcode;
+	m.len = len;
+
+	iv[0].iov_base = &m;
+	iv[0].iov_len = sizeof(m);
+
+	iv[1].iov_base = param;
+	iv[1].iov_len = len;
+
+	return ipc_sendmsg(sk, iv, 2, fd);
+}
+
+static void ipc_send(int sk, uint8_t service_id, uint8_t opcode, uint16_t len,
+							void *param, int fd)
+{
+	int err;
+
+	err = ipc_send_msg(sk, service_id, opcode, len, param, fd);
+	if (err < 0)
+		ipc_send_failed(err);
+}
+
+/*
+ * Sends the queued notifications, packing as many as fit into each frame.
+ * Returns -EAGAIN if the HAL is still not keeping up.
+ */
+static int ipc_flush_notif(struct ipc *ipc)
+{
+	GByteArray *backlog = ipc->notif_backlog;
+	int sk = g_io_channel_unix_get_fd(ipc->notif_io);
+	size_t pos = 0;
+	int err = 0;
+
+	while (pos < backlog->len) {
+		struct ipc_hdr batch;
+		struct iovec iv[2];
+		size_t len = 0;
+		unsigned int count = 0;
+
+		while (pos + len < backlog->len) {
+			const struct ipc_hdr *m = (void *) (backlog->data +
+								pos + len);
+			size_t size = sizeof(*m) + m->len;
+
+			if (count && len + size > IPC_BATCH_MTU - sizeof(batch))
+				break;
+
+			len += size;
+			count++;
+		}
+
+		iv[1].iov_base = backlog->data + pos;
+		iv[1].iov_len = len;
+
+		if (count == 1) {
+			err = ipc_sendmsg(sk, &iv[1], 1, -1);
+		} else {
+			memset(&batch, 0, sizeof(batch));
+			batch.service_id = IPC_SERVICE_ID_BATCH;
+			batch.opcode = IPC_OP_BATCH;
+			batch.len = len;
+
+			iv[0].iov_base = &batch;
+			iv[0].iov_len = sizeof(batch);
+
+			err = ipc_sendmsg(sk, iv, 2, -1);
+		}
+
+		if (err < 0)
+			break;
+
+		pos += len;
+	}
+
+	g_byte_array_remove_range(backlog, 0, pos);
+
+	return err;
+}
+
+static gboolean notif_flush_cb(GIOChannel *io, GIOCondition cond,
+							gpointer user_data)
+{
+	struct ipc *ipc = user_data;
+	int err;
 
-		/* TODO disconnect IPC here when this function becomes static */
-		raise(SIGTERM);
+	if (cond & (G_IO_NVAL | G_IO_ERR | G_IO_HUP)) {
+		ipc->notif_flush_watch = 0;
+		return FALSE;
 	}
+
+	err = ipc_flush_notif(ipc);
+	if (err == -EAGAIN)
+		return TRUE;
+
+	ipc->notif_flush_watch = 0;
+
+	if (err < 0)
+		ipc_send_failed(err);
+
+	return FALSE;
+}
+
+static void ipc_queue_notif(struct ipc *ipc, uint8_t service_id,
+				uint8_t opcode, uint16_t len, void *param)
+{
+	struct ipc_hdr m;
+	GIOCondition cond;
+
+	if (ipc->notif_backlog->len + sizeof(m) + len > IPC_NOTIF_BACKLOG_MAX) {
+		ipc_send_failed(-ENOBUFS);
+		return;
+	}
+
+	memset(&m, 0, sizeof(m));
+
+	m.service_id = service_id;
+	m.opcode = opcode;
+	m.len = len;
+
+	g_byte_array_append(ipc->notif_backlog, (void *) &m, sizeof(m));
+	g_byte_array_append(ipc->notif_backlog, param, len);
+
+	if (ipc->notif_flush_watch)
+		return;
+
+	cond = G_IO_OUT | G_IO_ERR | G_IO_HUP | G_IO_NVAL;
+
+	ipc->notif_flush_watch = g_io_add_watch(ipc->notif_io, cond,
+							notif_flush_cb, ipc);
+}
+
+/* Used when a notification must not be queued behind the backlog */
+static int ipc_flush_notif_sync(struct ipc *ipc)
+{
+	struct pollfd pfd;
+	int err, ret;
+
+	pfd.fd = g_io_channel_unix_get_fd(ipc->notif_io);
+	pfd.events = POLLOUT;
+
+	while ((err = ipc_flush_notif(ipc)) == -EAGAIN) {
+		pfd.revents = 0;
+
+		ret = poll(&pfd, 1, IPC_FLUSH_TIMEOUT);
+		if (ret == 0)
+			return -ETIMEDOUT;
+
+		if (ret < 0 && errno != EINTR)
+			return -errno;
+	}
+
+	if (ipc->notif_flush_watch) {
+		g_source_remove(ipc->notif_flush_watch);
+		ipc->notif_flush_watch = 0;
+	}
+
+	return err;
 }
 
 void ipc_send_rsp(struct ipc *ipc, uint8_t service_id, uint8_t opcode,
@@ -397,11 +578,35 @@ void ipc_send_notif(struct ipc *ipc, uint8_t service_id, uint8_t opcode,
 void ipc_send_notif_with_fd(struct ipc *ipc, uint8_t service_id, uint8_t opcode,
 					uint16_t len, void *param, int fd)
 {
+	int err;
+
 	if (!ipc || !ipc->notif_io)
 		return;
 
-	ipc_send(g_io_channel_unix_get_fd(ipc->notif_io), service_id, opcode,
-								len, param, fd);
+	/* Keep the order of notifications queued while the HAL was busy */
+	if (ipc->notif_backlog->len) {
+		if (fd < 0) {
+			ipc_queue_notif(ipc, service_id, opcode, len, param);
+			return;
+		}
+
+		/* File descriptors are passed immediately, never queued */
+		err = ipc_flush_notif_sync(ipc);
+		if (err < 0) {
+			ipc_send_failed(err);
+			return;
+		}
+	}
+
+	err = ipc_send_msg(g_io_channel_unix_get_fd(ipc->notif_io), service_id,
+						opcode, len, param, fd);
+	if (err == -EAGAIN && fd < 0) {
+		ipc_queue_notif(ipc, service_id, opcode, len, param);
+		return;
+	}
+
+	if (err < 0)
+		ipc_send_failed(err);
 }
 
 void ipc_register(struct ipc *ipc, uint8_t service,
@@ -20,6 +20,7 @@
 #include <inttypes.h>
 #include <string.h>
 #include <fcntl.h>
+#include <time.h>
 #include <sys/socket.h>
 #include <sys/un.h>
 
@@ -40,6 +41,7 @@ struct test_data {
 	uint8_t service;
 	const struct ipc_handler *handlers;
 	uint8_t handlers_size;
+	unsigned int notif_count;
 };
 
 struct context {
@@ -55,6 +57,11 @@ struct context {
 	GIOChannel *notif_io;
 
 	const struct test_data *data;
+
+	unsigned int notif_received;
+	unsigned int notif_frames;
+	unsigned int notif_batches;
+	struct timespec start;
 };
 
 
@@ -97,6 +104,62 @@ static gboolean cmd_watch(GIOChannel *io, GIOCondition cond,
 	return TRUE;
 }
 
+static void check_notif(struct context *context, const uint8_t *buf,
+								size_t len)
+{
+	const struct ipc_hdr *hdr = (const void *) buf;
+	uint32_t seq;
+
+	g_assert(len == sizeof(*hdr) + sizeof(seq));
+	g_assert(hdr->service_id == 1);
+	g_assert(hdr->opcode == 0x81);
+	g_assert(hdr->len == sizeof(seq));
+
+	/* Notifications must arrive in order and none may be lost */
+	memcpy(&seq, hdr->payload, sizeof(seq));
+	g_assert(seq == context->notif_received);
+
+	context->notif_received++;
+}
+
+static void read_notif(struct context *context, int sk)
+{
+	const struct test_data *test_data = context->data;
+	uint8_t buf[IPC_BATCH_MTU];
+	const struct ipc_hdr *hdr = (const void *) buf;
+	ssize_t len;
+	size_t pos;
+
+	len = read(sk, buf, sizeof(buf));
+	g_assert(len >= (ssize_t) sizeof(*hdr));
+	g_assert(len == (ssize_t) (sizeof(*hdr) + hdr->len));
+
+	context->notif_frames++;
+
+	if (hdr->service_id != IPC_SERVICE_ID_BATCH) {
+		check_notif(context, buf, len);
+		goto done;
+	}
+
+	g_assert(hdr->opcode == IPC_OP_BATCH);
+
+	context->notif_batches++;
+
+	for (pos = sizeof(*hdr); pos < (size_t) len;) {
+		const struct ipc_hdr *msg = (const void *) (buf + pos);
+		size_t msg_len = sizeof(*msg) + msg->len;
+
+		g_assert(pos + msg_len <= (size_t) len);
+
+		check_notif(context, buf + pos, msg_len);
+		pos += msg_len;
+	}
+
+done:
+	if (context->notif_received == test_data->notif_count)
+		context_quit(context);
+}
+
 static gboolean notif_watch(GIOChannel *io, GIOCondition cond,
 							gpointer user_data)
 {
@@ -110,9 +173,27 @@ static gboolean notif_watch(GIOChannel *io, GIOCondition cond,
 
 	g_assert(!test_data->disconnect);
 
+	if (test_data->notif_count)
+		read_notif(context, g_io_channel_unix_get_fd(io));
+
 	return TRUE;
 }
 
+static gboolean send_notifs(gpointer user_data)
+{
+	struct context *context = user_data;
+	const struct test_data *test_data = context->data;
+	uint32_t seq;
+
+	clock_gettime(CLOCK_MONOTONIC, &context->start);
+
+	/* Sent without yielding, so the HAL side falls behind */
+	for (seq = 0; seq < test_data->notif_count; seq++)
+		ipc_send_notif(ipc, 1, 0x81, sizeof(seq), &seq);
+
+	return FALSE;
+}
+
 static gboolean connect_handler(GIOChannel *io, GIOCondition cond,
 						gpointer user_data)
 {
@@ -149,7 +230,11 @@ static gboolean connect_handler(GIOChannel *io, GIOCondition cond,
 		context->cmd_io = new_io;
 	}
 
-	if (context->cmd_source && context->notif_source && !test_data->cmd)
+	if (context->cmd_source && context->notif_source &&
+						test_data->notif_count)
+		g_idle_add(send_notifs, context);
+	else if (context->cmd_source && context->notif_source &&
+							!test_data->cmd)
 		context_quit(context);
 
 	return TRUE;
@@ -196,10 +281,8 @@ static struct context *create_context(gconstpointer data)
 	return context;
 }
 
-static void execute_context(struct context *context)
+static void destroy_context(struct context *context)
 {
-	g_main_loop_run(context->main_loop);
-
 	g_io_channel_shutdown(context->notif_io, TRUE, NULL);
 	g_io_channel_shutdown(context->cmd_io, TRUE, NULL);
 	g_io_channel_unref(context->cmd_io);
@@ -214,6 +297,13 @@ static void execute_context(struct context *context)
 	g_free(context);
 }
 
+static void execute_context(struct context *context)
+{
+	g_main_loop_run(context->main_loop);
+
+	destroy_context(context);
+}
+
 static void disconnected(void *data)
 {
 	struct context *context = data;
@@ -238,6 +328,44 @@ static void test_init(gconstpointer data)
 	ipc = NULL;
 }
 
+static void test_notif(gconstpointer data)
+{
+	struct context *context = create_context(data);
+	const struct test_data *test_data = data;
+	struct timespec end;
+	double elapsed;
+
+	ipc = ipc_init(HAL_SK_PATH, sizeof(HAL_SK_PATH), SERVICE_ID_MAX,
+						true, NULL, NULL);
+
+	g_assert(ipc);
+
+	g_main_loop_run(context->main_loop);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	g_assert(context->notif_received == test_data->notif_count);
+
+	/* The backlog must have been delivered in batches */
+	g_assert(context->notif_batches > 0);
+	g_assert(context->notif_frames < test_data->notif_count);
+
+	elapsed = (end.tv_sec - context->start.tv_sec) +
+			(end.tv_nsec - context->start.tv_nsec) / 1e9;
+
+	if (g_test_verbose())
+		g_print("%u notifications in %u frames (%u batches), "
+				"%.0f notifications/s\n",
+				context->notif_received, context->notif_frames,
+				context->notif_batches,
+				context->notif_received / elapsed);
+
+	destroy_context(context);
+
+	ipc_cleanup(ipc);
+	ipc = NULL;
+}
+
 static gboolean send_cmd(gpointer user_data)
 {
 	struct context *context = user_data;
@@ -348,6 +476,10 @@ static void test_cmd_handler_invalid(const void *buf, uint16_t len)
 
 static const struct test_data test_init_1 = {};
 
+static const struct test_data test_notif_throughput = {
+	.notif_count = 50000,
+};
+
 static const struct ipc_hdr test_cmd_1_hdr = {
 	.service_id = 0,
 	.opcode = 1,
@@ -533,6 +665,8 @@ int main(int argc, char *argv[])
 		__btd_log_init("*", 0);
 
 	g_test_add_data_func("/android_ipc/init", &test_init_1, test_init);
+	g_test_add_data_func("/android_ipc/notif_throughput",
+				&test_notif_throughput, test_notif);
 	g_test_add_data_func("/android_ipc/service_invalid_1",
 				&test_cmd_service_invalid_1, test_cmd);
 	g_test_add_data_func("/android_ipc/service_valid_1",
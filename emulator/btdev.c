@@ -28,6 +28,7 @@
 #include "src/shared/timeout.h"
 #include "src/shared/crypto.h"
 #include "src/shared/ecc.h"
+#include "src/shared/ecc-pool.h"
 #include "monitor/bt.h"
 #include "btdev.h"
 
@@ -158,12 +159,33 @@ struct inquiry_data {
 
 #define MAX_BTDEV_ENTRIES 16
 
+#define KEY_POOL_DEPTH 4
+
 static const uint8_t LINK_KEY_NONE[16] = { 0 };
 static const uint8_t LINK_KEY_DUMMY[16] = {	0, 1, 2, 3, 4, 5, 6, 7,
 						8, 9, 0, 1, 2, 3, 4, 5 };
 
 static struct btdev *btdev_list[MAX_BTDEV_ENTRIES] = { };
 
+/* P-256 keypairs shared by all LE capable devices */
+static struct ecc_pool *key_pool;
+static unsigned int key_pool_users;
+
+static void key_pool_ref(void)
+{
+	if (!key_pool_users++)
+		key_pool = ecc_pool_new(KEY_POOL_DEPTH);
+}
+
+static void key_pool_unref(void)
+{
+	if (--key_pool_users)
+		return;
+
+	ecc_pool_free(key_pool);
+	key_pool = NULL;
+}
+
 static int get_hook_index(struct btdev *btdev, enum btdev_hook_type type,
 								uint16_t opcode)
 {
@@ -687,6 +709,8 @@ struct btdev *btdev_create(enum btdev_type type, uint16_t id)
 			free(btdev);
 			return NULL;
 		}
+
+		key_pool_ref();
 	}
 
 	btdev->type = type;
@@ -744,6 +768,8 @@ struct btdev *btdev_create(enum btdev_type type, uint16_t id)
 
 	index = add_btdev(btdev);
 	if (index < 0) {
+		if (btdev->crypto)
+			key_pool_unref();
 		bt_crypto_unref(btdev->crypto);
 		free(btdev);
 		return NULL;
@@ -762,6 +788,9 @@ void btdev_destroy(struct btdev *btdev)
 	if (btdev->inquiry_id > 0)
 		timeout_remove(btdev->inquiry_id);
 
+	if (btdev->crypto)
+		key_pool_unref();
+
 	bt_crypto_unref(btdev->crypto);
 	del_btdev(btdev);
 
@@ -3534,7 +3563,8 @@ static void default_cmd(struct btdev *btdev, uint16_t opcode,
 	case BT_HCI_CMD_LE_READ_LOCAL_PK256:
 		if (btdev->type == BTDEV_TYPE_BREDR)
 			goto unsupported;
-		if (!ecc_make_key(pk_evt.local_pk256, btdev->le_local_sk256)) {
+		if (!ecc_pool_get(key_pool, pk_evt.local_pk256,
+						btdev->le_local_sk256)) {
 			cmd_status(btdev, BT_HCI_ERR_COMMAND_DISALLOWED,
 									opcode);
 			break;
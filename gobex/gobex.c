@@ -14,6 +14,7 @@
 #include <unistd.h>
 #include <string.h>
 #include <errno.h>
+#include <sys/socket.h>
 
 #include "gobex.h"
 #include "gobex-debug.h"
@@ -51,6 +52,7 @@ struct srm_config {
 struct _GObex {
 	int ref_count;
 	GIOChannel *io;
+	int fd;
 	guint io_source;
 
 	gboolean (*read) (GObex *obex, GError **err);
@@ -254,17 +256,24 @@ static gboolean req_timeout(gpointer user_data)
 	return FALSE;
 }
 
+/*
+ * The channel is unbuffered so data goes straight between the packet buffers
+ * and the file descriptor, bypassing GIOChannel.
+ */
 static gboolean write_stream(GObex *obex, GError **err)
 {
-	GIOStatus status;
-	gsize bytes_written;
+	ssize_t bytes_written;
 	char *buf;
 
 	buf = (char *) &obex->tx_buf[obex->tx_sent];
-	status = g_io_channel_write_chars(obex->io, buf, obex->tx_data,
-							&bytes_written, err);
-	if (status != G_IO_STATUS_NORMAL)
+	bytes_written = write(obex->fd, buf, obex->tx_data);
+	if (bytes_written < 0) {
+		/* Keep the data until the transport has room for it */
+		if (errno == EAGAIN || errno == EINTR)
+			return TRUE;
+
 		return FALSE;
+	}
 
 	g_obex_dump(G_OBEX_DEBUG_DATA, "<", buf, bytes_written);
 
@@ -276,17 +285,19 @@ static gboolean write_stream(GObex *obex, GError **err)
 
 static gboolean write_packet(GObex *obex, GError **err)
 {
-	GIOStatus status;
-	gsize bytes_written;
+	ssize_t bytes_written;
 	char *buf;
 
 	buf = (char *) &obex->tx_buf[obex->tx_sent];
-	status = g_io_channel_write_chars(obex->io, buf, obex->tx_data,
-							&bytes_written, err);
-	if (status != G_IO_STATUS_NORMAL)
+	bytes_written = send(obex->fd, buf, obex->tx_data, MSG_NOSIGNAL);
+	if (bytes_written < 0) {
+		if (errno == EAGAIN || errno == EINTR)
+			return TRUE;
+
 		return FALSE;
+	}
 
-	if (bytes_written != obex->tx_data)
+	if ((size_t) bytes_written != obex->tx_data)
 		return FALSE;
 
 	g_obex_dump(G_OBEX_DEBUG_DATA, "<", buf, bytes_written);
@@ -1206,28 +1217,22 @@ fail:
 
 static gboolean read_stream(GObex *obex, GError **err)
 {
-	GIOChannel *io = obex->io;
-	GIOStatus status;
-	gsize rbytes, toread;
+	ssize_t rbytes;
 	guint16 u16;
-	char *buf;
 
 	if (obex->rx_data >= 3)
 		goto read_body;
 
-	rbytes = 0;
-	toread = 3 - obex->rx_data;
-	buf = (char *) &obex->rx_buf[obex->rx_data];
-
-	status = g_io_channel_read_chars(io, buf, toread, &rbytes, NULL);
-	if (status != G_IO_STATUS_NORMAL)
+	rbytes = read(obex->fd, &obex->rx_buf[obex->rx_data],
+							3 - obex->rx_data);
+	if (rbytes <= 0)
 		return TRUE;
 
 	obex->rx_data += rbytes;
 	if (obex->rx_data < 3)
 		goto done;
 
-	memcpy(&u16, &buf[1], sizeof(u16));
+	memcpy(&u16, &obex->rx_buf[1], sizeof(u16));
 	obex->rx_pkt_len = g_ntohs(u16);
 
 	if (obex->rx_pkt_len > obex->rx_mtu) {
@@ -1240,19 +1245,14 @@ static gboolean read_stream(GObex *obex, GError **err)
 	}
 
 read_body:
-	if (obex->rx_data >= obex->rx_pkt_len)
-		goto done;
-
-	do {
-		toread = obex->rx_pkt_len - obex->rx_data;
-		buf = (char *) &obex->rx_buf[obex->rx_data];
-
-		status = g_io_channel_read_chars(io, buf, toread, &rbytes, NULL);
-		if (status != G_IO_STATUS_NORMAL)
-			goto done;
+	while (obex->rx_data < obex->rx_pkt_len) {
+		rbytes = read(obex->fd, &obex->rx_buf[obex->rx_data],
+					obex->rx_pkt_len - obex->rx_data);
+		if (rbytes <= 0)
+			break;
 
 		obex->rx_data += rbytes;
-	} while (rbytes > 0 && obex->rx_data < obex->rx_pkt_len);
+	}
 
 done:
 	g_obex_dump(G_OBEX_DEBUG_DATA, ">", obex->rx_buf, obex->rx_data);
@@ -1262,10 +1262,7 @@ done:
 
 static gboolean read_packet(GObex *obex, GError **err)
 {
-	GIOChannel *io = obex->io;
-	GError *read_err = NULL;
-	GIOStatus status;
-	gsize rbytes;
+	ssize_t rbytes;
 	guint16 u16;
 
 	if (obex->rx_data > 0) {
@@ -1274,12 +1271,20 @@ static gboolean read_packet(GObex *obex, GError **err)
 		goto fail;
 	}
 
-	status = g_io_channel_read_chars(io, (char *) obex->rx_buf,
-					obex->rx_mtu, &rbytes, &read_err);
-	if (status != G_IO_STATUS_NORMAL) {
+	/* MSG_TRUNC reports the real length of a packet that did not fit */
+	rbytes = recv(obex->fd, obex->rx_buf, obex->rx_mtu, MSG_TRUNC);
+	if (rbytes < 0) {
+		if (errno == EAGAIN || errno == EINTR)
+			return TRUE;
+
+		g_set_error(err, G_OBEX_ERROR, G_OBEX_ERROR_PARSE_ERROR,
+				"Unable to read data: %s", strerror(errno));
+		goto fail;
+	}
+
+	if (rbytes > obex->rx_mtu) {
 		g_set_error(err, G_OBEX_ERROR, G_OBEX_ERROR_PARSE_ERROR,
-				"Unable to read data: %s", read_err->message);
-		g_error_free(read_err);
+				"Too big incoming packet");
 		goto fail;
 	}
 
@@ -1296,7 +1301,7 @@ static gboolean read_packet(GObex *obex, GError **err)
 
 	if (obex->rx_pkt_len != rbytes) {
 		g_set_error(err, G_OBEX_ERROR, G_OBEX_ERROR_PARSE_ERROR,
-			"Data size doesn't match packet size (%zu != %u)",
+			"Data size doesn't match packet size (%zd != %u)",
 			rbytes, obex->rx_pkt_len);
 		return FALSE;
 	}
@@ -1448,6 +1453,7 @@ GObex *g_obex_new(GIOChannel *io, GObexTransportType transport_type,
 	obex = g_new0(GObex, 1);
 
 	obex->io = g_io_channel_ref(io);
+	obex->fd = g_io_channel_unix_get_fd(io);
 	obex->ref_count = 1;
 	obex->conn_id = CONNID_INVALID;
 	obex->rx_last_op = G_OBEX_OP_NONE;
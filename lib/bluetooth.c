@@ -258,4786 +258,2405 @@ int bt_error(uint16_t code)
 	}
 }
 
+/* Indexed by company identifier, generated by tools/update_compids.sh */
+static const char *compids[] = {
+	[0] = "Ericsson Technology Licensing",
+	[1] = "Nokia Mobile Phones",
+	[2] = "Intel Corp.",
+	[3] = "IBM Corp.",
+	[4] = "Toshiba Corp.",
+	[5] = "3Com",
+	[6] = "Microsoft",
+	[7] = "Lucent",
+	[8] = "Motorola",
+	[9] = "Infineon Technologies AG",
+	[10] = "Cambridge Silicon Radio",
+	[11] = "Silicon Wave",
+	[12] = "Digianswer A/S",
+	[13] = "Texas Instruments Inc.",
+	[14] = "Parthus Technologies Inc.",
+	[15] = "Broadcom Corporation",
+	[16] = "Mitel Semiconductor",
+	[17] = "Widcomm, Inc.",
+	[18] = "Zeevo, Inc.",
+	[19] = "Atmel Corporation",
+	[20] = "Mitsubishi Electric Corporation",
+	[21] = "RTX Telecom A/S",
+	[22] = "KC Technology Inc.",
+	[23] = "Newlogic",
+	[24] = "Transilica, Inc.",
+	[25] = "Rohde & Schwarz GmbH & Co. KG",
+	[26] = "TTPCom Limited",
+	[27] = "Signia Technologies, Inc.",
+	[28] = "Conexant Systems Inc.",
+	[29] = "Qualcomm",
+	[30] = "Inventel",
+	[31] = "AVM Berlin",
+	[32] = "BandSpeed, Inc.",
+	[33] = "Mansella Ltd",
+	[34] = "NEC Corporation",
+	[35] = "WavePlus Technology Co., Ltd.",
+	[36] = "Alcatel",
+	[37] = "NXP Semiconductors (formerly Philips Semiconductors)",
+	[38] = "C Technologies",
+	[39] = "Open Interface",
+	[40] = "R F Micro Devices",
+	[41] = "Hitachi Ltd",
+	[42] = "Symbol Technologies, Inc.",
+	[43] = "Tenovis",
+	[44] = "Macronix International Co. Ltd.",
+	[45] = "GCT Semiconductor",
+	[46] = "Norwood Systems",
+	[47] = "MewTel Technology Inc.",
+	[48] = "ST Microelectronics",
+	[49] = "Synopsys, Inc.",
+	[50] = "Red-M (Communications) Ltd",
+	[51] = "Commil Ltd",
+	[52] = "Computer Access Technology Corporation (CATC)",
+	[53] = "Eclipse (HQ Espana) S.L.",
+	[54] = "Renesas Electronics Corporation",
+	[55] = "Mobilian Corporation",
+	[56] = "Syntronix Corporation",
+	[57] = "Integrated System Solution Corp.",
+	[58] = "Panasonic Corporation (formerly Matsushita Electric Industrial Co., Ltd.)",
+	[59] = "Gennum Corporation",
+	[60] = "BlackBerry Limited (formerly Research In Motion)",
+	[61] = "IPextreme, Inc.",
+	[62] = "Systems and Chips, Inc",
+	[63] = "Bluetooth SIG, Inc",
+	[64] = "Seiko Epson Corporation",
+	[65] = "Integrated Silicon Solution Taiwan, Inc.",
+	[66] = "CONWISE Technology Corporation Ltd",
+	[67] = "PARROT AUTOMOTIVE SAS",
+	[68] = "Socket Mobile",
+	[69] = "Atheros Communications, Inc.",
+	[70] = "MediaTek, Inc.",
+	[71] = "Bluegiga",
+	[72] = "Marvell Technology Group Ltd.",
+	[73] = "3DSP Corporation",
+	[74] = "Accel Semiconductor Ltd.",
+	[75] = "Continental Automotive Systems",
+	[76] = "Apple, Inc.",
+	[77] = "Staccato Communications, Inc.",
+	[78] = "Avago Technologies",
+	[79] = "APT Ltd.",
+	[80] = "SiRF Technology, Inc.",
+	[81] = "Tzero Technologies, Inc.",
+	[82] = "J&M Corporation",
+	[83] = "Free2move AB",
+	[84] = "3DiJoy Corporation",
+	[85] = "Plantronics, Inc.",
+	[86] = "Sony Ericsson Mobile Communications",
+	[87] = "Harman International Industries, Inc.",
+	[88] = "Vizio, Inc.",
+	[89] = "Nordic Semiconductor ASA",
+	[90] = "EM Microelectronic-Marin SA",
+	[91] = "Ralink Technology Corporation",
+	[92] = "Belkin International, Inc.",
+	[93] = "Realtek Semiconductor Corporation",
+	[94] = "Stonestreet One, LLC",
+	[95] = "Wicentric, Inc.",
+	[96] = "RivieraWaves S.A.S",
+	[97] = "RDA Microelectronics",
+	[98] = "Gibson Guitars",
+	[99] = "MiCommand Inc.",
+	[100] = "Band XI International, LLC",
+	[101] = "Hewlett-Packard Company",
+	[102] = "9Solutions Oy",
+	[103] = "GN Netcom A/S",
+	[104] = "General Motors",
+	[105] = "A&D Engineering, Inc.",
+	[106] = "MindTree Ltd.",
+	[107] = "Polar Electro OY",
+	[108] = "Beautiful Enterprise Co., Ltd.",
+	[109] = "BriarTek, Inc",
+	[110] = "Summit Data Communications, Inc.",
+	[111] = "Sound ID",
+	[112] = "Monster, LLC",
+	[113] = "connectBlue AB",
+	[114] = "ShangHai Super Smart Electronics Co. Ltd.",
+	[115] = "Group Sense Ltd.",
+	[116] = "Zomm, LLC",
+	[117] = "Samsung Electronics Co. Ltd.",
+	[118] = "Creative Technology Ltd.",
+	[119] = "Laird Technologies",
+	[120] = "Nike, Inc.",
+	[121] = "lesswire AG",
+	[122] = "MStar Semiconductor, Inc.",
+	[123] = "Hanlynn Technologies",
+	[124] = "A & R Cambridge",
+	[125] = "Seers Technology Co., Ltd.",
+	[126] = "Sports Tracking Technologies Ltd.",
+	[127] = "Autonet Mobile",
+	[128] = "DeLorme Publishing Company, Inc.",
+	[129] = "WuXi Vimicro",
+	[130] = "Sennheiser Communications A/S",
+	[131] = "TimeKeeping Systems, Inc.",
+	[132] = "Ludus Helsinki Ltd.",
+	[133] = "BlueRadios, Inc.",
+	[134] = "Equinux AG",
+	[135] = "Garmin International, Inc.",
+	[136] = "Ecotest",
+	[137] = "GN ReSound A/S",
+	[138] = "Jawbone",
+	[139] = "Topcon Positioning Systems, LLC",
+	[140] = "Gimbal Inc. (formerly Qualcomm Labs, Inc. and Qualcomm Retail Solutions, Inc.)",
+	[141] = "Zscan Software",
+	[142] = "Quintic Corp",
+	[143] = "Telit Wireless Solutions GmbH (formerly Stollmann E+V GmbH)",
+	[144] = "Funai Electric Co., Ltd.",
+	[145] = "Advanced PANMOBIL systems GmbH & Co. KG",
+	[146] = "ThinkOptics, Inc.",
+	[147] = "Universal Electronics, Inc.",
+	[148] = "Airoha Technology Corp.",
+	[149] = "NEC Lighting, Ltd.",
+	[150] = "ODM Technology, Inc.",
+	[151] = "ConnecteDevice Ltd.",
+	[152] = "zero1.tv GmbH",
+	[153] = "i.Tech Dynamic Global Distribution Ltd.",
+	[154] = "Alpwise",
+	[155] = "Jiangsu Toppower Automotive Electronics Co., Ltd.",
+	[156] = "Colorfy, Inc.",
+	[157] = "Geoforce Inc.",
+	[158] = "Bose Corporation",
+	[159] = "Suunto Oy",
+	[160] = "Kensington Computer Products Group",
+	[161] = "SR-Medizinelektronik",
+	[162] = "Vertu Corporation Limited",
+	[163] = "Meta Watch Ltd.",
+	[164] = "LINAK A/S",
+	[165] = "OTL Dynamics LLC",
+	[166] = "Panda Ocean Inc.",
+	[167] = "Visteon Corporation",
+	[168] = "ARP Devices Limited",
+	[169] = "MARELLI EUROPE S.P.A. (formerly Magneti Marelli S.p.A.)",
+	[170] = "CAEN RFID srl",
+	[171] = "Ingenieur-Systemgruppe Zahn GmbH",
+	[172] = "Green Throttle Games",
+	[173] = "Peter Systemtechnik GmbH",
+	[174] = "Omegawave Oy",
+	[175] = "Cinetix",
+	[176] = "Passif Semiconductor Corp",
+	[177] = "Saris Cycling Group, Inc",
+	[178] = "Bekey A/S",
+	[179] = "Clarinox Technologies Pty. Ltd.",
+	[180] = "BDE Technology Co., Ltd.",
+	[181] = "Swirl Networks",
+	[182] = "Meso international",
+	[183] = "TreLab Ltd",
+	[184] = "Qualcomm Innovation Center, Inc. (QuIC)",
+	[185] = "Johnson Controls, Inc.",
+	[186] = "Starkey Laboratories Inc.",
+	[187] = "S-Power Electronics Limited",
+	[188] = "Ace Sensor Inc",
+	[189] = "Aplix Corporation",
+	[190] = "AAMP of America",
+	[191] = "Stalmart Technology Limited",
+	[192] = "AMICCOM Electronics Corporation",
+	[193] = "Shenzhen Excelsecu Data Technology Co.,Ltd",
+	[194] = "Geneq Inc.",
+	[195] = "adidas AG",
+	[196] = "LG Electronics",
+	[197] = "Onset Computer Corporation",
+	[198] = "Selfly BV",
+	[199] = "Quuppa Oy.",
+	[200] = "GeLo Inc",
+	[201] = "Evluma",
+	[202] = "MC10",
+	[203] = "Binauric SE",
+	[204] = "Beats Electronics",
+	[205] = "Microchip Technology Inc.",
+	[206] = "Elgato Systems GmbH",
+	[207] = "ARCHOS SA",
+	[208] = "Dexcom, Inc.",
+	[209] = "Polar Electro Europe B.V.",
+	[210] = "Dialog Semiconductor B.V.",
+	[211] = "Taixingbang Technology (HK) Co,. LTD.",
+	[212] = "Kawantech",
+	[213] = "Austco Communication Systems",
+	[214] = "Timex Group USA, Inc.",
+	[215] = "Qualcomm Technologies, Inc.",
+	[216] = "Qualcomm Connected Experiences, Inc.",
+	[217] = "Voyetra Turtle Beach",
+	[218] = "txtr GmbH",
+	[219] = "Biosentronics",
+	[220] = "Procter & Gamble",
+	[221] = "Hosiden Corporation",
+	[222] = "Muzik LLC",
+	[223] = "Misfit Wearables Corp",
+	[224] = "Google",
+	[225] = "Danlers Ltd",
+	[226] = "Semilink Inc",
+	[227] = "inMusic Brands, Inc",
+	[228] = "L.S. Research Inc.",
+	[229] = "Eden Software Consultants Ltd.",
+	[230] = "Freshtemp",
+	[231] = "KS Technologies",
+	[232] = "ACTS Technologies",
+	[233] = "Vtrack Systems",
+	[234] = "Nielsen-Kellerman Company",
+	[235] = "Server Technology Inc.",
+	[236] = "BioResearch Associates",
+	[237] = "Jolly Logic, LLC",
+	[238] = "Above Average Outcomes, Inc.",
+	[239] = "Bitsplitters GmbH",
+	[240] = "PayPal, Inc.",
+	[241] = "Witron Technology Limited",
+	[242] = "Morse Project Inc.",
+	[243] = "Kent Displays Inc.",
+	[244] = "Nautilus Inc.",
+	[245] = "Smartifier Oy",
+	[246] = "Elcometer Limited",
+	[247] = "VSN Technologies, Inc.",
+	[248] = "AceUni Corp., Ltd.",
+	[249] = "StickNFind",
+	[250] = "Crystal Code AB",
+	[251] = "KOUKAAM a.s.",
+	[252] = "Delphi Corporation",
+	[253] = "ValenceTech Limited",
+	[254] = "Stanley Black and Decker",
+	[255] = "Typo Products, LLC",
+	[256] = "TomTom International BV",
+	[257] = "Fugoo, Inc.",
+	[258] = "Keiser Corporation",
+	[259] = "Bang & Olufsen A/S",
+	[260] = "PLUS Location Systems Pty Ltd",
+	[261] = "Ubiquitous Computing Technology Corporation",
+	[262] = "Innovative Yachtter Solutions",
+	[263] = "William Demant Holding A/S",
+	[264] = "Chicony Electronics Co., Ltd.",
+	[265] = "Atus BV",
+	[266] = "Codegate Ltd",
+	[267] = "ERi, Inc",
+	[268] = "Transducers Direct, LLC",
+	[269] = "DENSO TEN LIMITED (formerly Fujitsu Ten LImited)",
+	[270] = "Audi AG",
+	[271] = "HiSilicon Technologies CO., LIMITED",
+	[272] = "Nippon Seiki Co., Ltd.",
+	[273] = "Steelseries ApS",
+	[274] = "Visybl Inc.",
+	[275] = "Openbrain Technologies, Co., Ltd.",
+	[276] = "Xensr",
+	[277] = "e.solutions",
+	[278] = "10AK Technologies",
+	[279] = "Wimoto Technologies Inc",
+	[280] = "Radius Networks, Inc.",
+	[281] = "Wize Technology Co., Ltd.",
+	[282] = "Qualcomm Labs, Inc.",
+	[283] = "Aruba Networks",
+	[284] = "Baidu",
+	[285] = "Arendi AG",
+	[286] = "Skoda Auto a.s.",
+	[287] = "Volkswagen AG",
+	[288] = "Porsche AG",
+	[289] = "Sino Wealth Electronic Ltd.",
+	[290] = "AirTurn, Inc.",
+	[291] = "Kinsa, Inc",
+	[292] = "HID Global",
+	[293] = "SEAT es",
+	[294] = "Promethean Ltd.",
+	[295] = "Salutica Allied Solutions",
+	[296] = "GPSI Group Pty Ltd",
+	[297] = "Nimble Devices Oy",
+	[298] = "Changzhou Yongse Infotech  Co., Ltd.",
+	[299] = "SportIQ",
+	[300] = "TEMEC Instruments B.V.",
+	[301] = "Sony Corporation",
+	[302] = "ASSA ABLOY",
+	[303] = "Clarion Co. Inc.",
+	[304] = "Warehouse Innovations",
+	[305] = "Cypress Semiconductor",
+	[306] = "MADS Inc",
+	[307] = "Blue Maestro Limited",
+	[308] = "Resolution Products, Ltd.",
+	[309] = "Aireware LLC",
+	[310] = "Silvair, Inc.",
+	[311] = "Prestigio Plaza Ltd.",
+	[312] = "NTEO Inc.",
+	[313] = "Focus Systems Corporation",
+	[314] = "Tencent Holdings Ltd.",
+	[315] = "Allegion",
+	[316] = "Murata Manufacturing Co., Ltd.",
+	[317] = "WirelessWERX",
+	[318] = "Nod, Inc.",
+	[319] = "B&B Manufacturing Company",
+	[320] = "Alpine Electronics (China) Co., Ltd",
+	[321] = "FedEx Services",
+	[322] = "Grape Systems Inc.",
+	[323] = "Bkon Connect",
+	[324] = "Lintech GmbH",
+	[325] = "Novatel Wireless",
+	[326] = "Ciright",
+	[327] = "Mighty Cast, Inc.",
+	[328] = "Ambimat Electronics",
+	[329] = "Perytons Ltd.",
+	[330] = "Tivoli Audio, LLC",
+	[331] = "Master Lock",
+	[332] = "Mesh-Net Ltd",
+	[333] = "HUIZHOU DESAY SV AUTOMOTIVE CO., LTD.",
+	[334] = "Tangerine, Inc.",
+	[335] = "B&W Group Ltd.",
+	[336] = "Pioneer Corporation",
+	[337] = "OnBeep",
+	[338] = "Vernier Software & Technology",
+	[339] = "ROL Ergo",
+	[340] = "Pebble Technology",
+	[341] = "NETATMO",
+	[342] = "Accumulate AB",
+	[343] = "Anhui Huami Information Technology Co., Ltd.",
+	[344] = "Inmite s.r.o.",
+	[345] = "ChefSteps, Inc.",
+	[346] = "micas AG",
+	[347] = "Biomedical Research Ltd.",
+	[348] = "Pitius Tec S.L.",
+	[349] = "Estimote, Inc.",
+	[350] = "Unikey Technologies, Inc.",
+	[351] = "Timer Cap Co.",
+	[352] = "AwoX",
+	[353] = "yikes",
+	[354] = "MADSGlobalNZ Ltd.",
+	[355] = "PCH International",
+	[356] = "Qingdao Yeelink Information Technology Co., Ltd.",
+	[357] = "Milwaukee Tool (Formally Milwaukee Electric Tools)",
+	[358] = "MISHIK Pte Ltd",
+	[359] = "Ascensia Diabetes Care US Inc.",
+	[360] = "Spicebox LLC",
+	[361] = "emberlight",
+	[362] = "Cooper-Atkins Corporation",
+	[363] = "Qblinks",
+	[364] = "MYSPHERA",
+	[365] = "LifeScan Inc",
+	[366] = "Volantic AB",
+	[367] = "Podo Labs, Inc",
+	[368] = "Roche Diabetes Care AG",
+	[369] = "Amazon.com Services, LLC (formerly Amazon Fulfillment Service)",
+	[370] = "Connovate Technology Private Limited",
+	[371] = "Kocomojo, LLC",
+	[372] = "Everykey Inc.",
+	[373] = "Dynamic Controls",
+	[374] = "SentriLock",
+	[375] = "I-SYST inc.",
+	[376] = "CASIO COMPUTER CO., LTD.",
+	[377] = "LAPIS Semiconductor Co., Ltd.",
+	[378] = "Telemonitor, Inc.",
+	[379] = "taskit GmbH",
+	[380] = "Daimler AG",
+	[381] = "BatAndCat",
+	[382] = "BluDotz Ltd",
+	[383] = "XTel Wireless ApS",
+	[384] = "Gigaset Communications GmbH",
+	[385] = "Gecko Health Innovations, Inc.",
+	[386] = "HOP Ubiquitous",
+	[387] = "Walt Disney",
+	[388] = "Nectar",
+	[389] = "bel'apps LLC",
+	[390] = "CORE Lighting Ltd",
+	[391] = "Seraphim Sense Ltd",
+	[392] = "Unico RBC",
+	[393] = "Physical Enterprises Inc.",
+	[394] = "Able Trend Technology Limited",
+	[395] = "Konica Minolta, Inc.",
+	[396] = "Wilo SE",
+	[397] = "Extron Design Services",
+	[398] = "Fitbit, Inc.",
+	[399] = "Fireflies Systems",
+	[400] = "Intelletto Technologies Inc.",
+	[401] = "FDK CORPORATION",
+	[402] = "Cloudleaf, Inc",
+	[403] = "Maveric Automation LLC",
+	[404] = "Acoustic Stream Corporation",
+	[405] = "Zuli",
+	[406] = "Paxton Access Ltd",
+	[407] = "WiSilica Inc.",
+	[408] = "VENGIT Korlatolt Felelossegu Tarsasag",
+	[409] = "SALTO SYSTEMS S.L.",
+	[410] = "TRON Forum (formerly T-Engine Forum)",
+	[411] = "CUBETECH s.r.o.",
+	[412] = "Cokiya Incorporated",
+	[413] = "CVS Health",
+	[414] = "Ceruus",
+	[415] = "Strainstall Ltd",
+	[416] = "Channel Enterprises (HK) Ltd.",
+	[417] = "FIAMM",
+	[418] = "GIGALANE.CO.,LTD",
+	[419] = "EROAD",
+	[420] = "Mine Safety Appliances",
+	[421] = "Icon Health and Fitness",
+	[422] = "Wille Engineering (formely as Asandoo GmbH)",
+	[423] = "ENERGOUS CORPORATION",
+	[424] = "Taobao",
+	[425] = "Canon Inc.",
+	[426] = "Geophysical Technology Inc.",
+	[427] = "Facebook, Inc.",
+	[428] = "Trividia Health, Inc.",
+	[429] = "FlightSafety International",
+	[430] = "Earlens Corporation",
+	[431] = "Sunrise Micro Devices, Inc.",
+	[432] = "Star Micronics Co., Ltd.",
+	[433] = "Netizens Sp. z o.o.",
+	[434] = "Nymi Inc.",
+	[435] = "Nytec, Inc.",
+	[436] = "Trineo Sp. z o.o.",
+	[437] = "Nest Labs Inc.",
+	[438] = "LM Technologies Ltd",
+	[439] = "General Electric Company",
+	[440] = "i+D3 S.L.",
+	[441] = "HANA Micron",
+	[442] = "Stages Cycling LLC",
+	[443] = "Cochlear Bone Anchored Solutions AB",
+	[444] = "SenionLab AB",
+	[445] = "Syszone Co., Ltd",
+	[446] = "Pulsate Mobile Ltd.",
+	[447] = "Hong Kong HunterSun Electronic Limited",
+	[448] = "pironex GmbH",
+	[449] = "BRADATECH Corp.",
+	[450] = "Transenergooil AG",
+	[451] = "Bunch",
+	[452] = "DME Microelectronics",
+	[453] = "Bitcraze AB",
+	[454] = "HASWARE Inc.",
+	[455] = "Abiogenix Inc.",
+	[456] = "Poly-Control ApS",
+	[457] = "Avi-on",
+	[458] = "Laerdal Medical AS",
+	[459] = "Fetch My Pet",
+	[460] = "Sam Labs Ltd.",
+	[461] = "Chengdu Synwing Technology Ltd",
+	[462] = "HOUWA SYSTEM DESIGN, k.k.",
+	[463] = "BSH",
+	[464] = "Primus Inter Pares Ltd",
+	[465] = "August Home, Inc",
+	[466] = "Gill Electronics",
+	[467] = "Sky Wave Design",
+	[468] = "Newlab S.r.l.",
+	[469] = "ELAD srl",
+	[470] = "G-wearables inc.",
+	[471] = "Squadrone Systems Inc.",
+	[472] = "Code Corporation",
+	[473] = "Savant Systems LLC",
+	[474] = "Logitech International SA",
+	[475] = "Innblue Consulting",
+	[476] = "iParking Ltd.",
+	[477] = "Koninklijke Philips Electronics N.V.",
+	[478] = "Minelab Electronics Pty Limited",
+	[479] = "Bison Group Ltd.",
+	[480] = "Widex A/S",
+	[481] = "Jolla Ltd",
+	[482] = "Lectronix, Inc.",
+	[483] = "Caterpillar Inc",
+	[484] = "Freedom Innovations",
+	[485] = "Dynamic Devices Ltd",
+	[486] = "Technology Solutions (UK) Ltd",
+	[487] = "IPS Group Inc.",
+	[488] = "STIR",
+	[489] = "Sano, Inc.",
+	[490] = "Advanced Application Design, Inc.",
+	[491] = "AutoMap LLC",
+	[492] = "Spreadtrum Communications Shanghai Ltd",
+	[493] = "CuteCircuit LTD",
+	[494] = "Valeo Service",
+	[495] = "Fullpower Technologies, Inc.",
+	[496] = "KloudNation",
+	[497] = "Zebra Technologies Corporation",
+	[498] = "Itron, Inc.",
+	[499] = "The University of Tokyo",
+	[500] = "UTC Fire and Security",
+	[501] = "Cool Webthings Limited",
+	[502] = "DJO Global",
+	[503] = "Gelliner Limited",
+	[504] = "Anyka (Guangzhou) Microelectronics Technology Co, LTD",
+	[505] = "Medtronic Inc.",
+	[506] = "Gozio Inc.",
+	[507] = "Form Lifting, LLC",
+	[508] = "Wahoo Fitness, LLC",
+	[509] = "Kontakt Micro-Location Sp. z o.o.",
+	[510] = "Radio Systems Corporation",
+	[511] = "Freescale Semiconductor, Inc.",
+	[512] = "Verifone Systems Pte Ltd. Taiwan Branch",
+	[513] = "AR Timing",
+	[514] = "Rigado LLC",
+	[515] = "Kemppi Oy",
+	[516] = "Tapcentive Inc.",
+	[517] = "Smartbotics Inc.",
+	[518] = "Otter Products, LLC",
+	[519] = "STEMP Inc.",
+	[520] = "LumiGeek LLC",
+	[521] = "InvisionHeart Inc.",
+	[522] = "Macnica Inc.",
+	[523] = "Jaguar Land Rover Limited",
+	[524] = "CoroWare Technologies, Inc",
+	[525] = "Simplo Technology Co., LTD",
+	[526] = "Omron Healthcare Co., LTD",
+	[527] = "Comodule GMBH",
+	[528] = "ikeGPS",
+	[529] = "Telink Semiconductor Co. Ltd",
+	[530] = "Interplan Co., Ltd",
+	[531] = "Wyler AG",
+	[532] = "IK Multimedia Production srl",
+	[533] = "Lukoton Experience Oy",
+	[534] = "MTI Ltd",
+	[535] = "Tech4home, Lda",
+	[536] = "Hiotech AB",
+	[537] = "DOTT Limited",
+	[538] = "Blue Speck Labs, LLC",
+	[539] = "Cisco Systems, Inc",
+	[540] = "Mobicomm Inc",
+	[541] = "Edamic",
+	[542] = "Goodnet, Ltd",
+	[543] = "Luster Leaf Products  Inc",
+	[544] = "Manus Machina BV",
+	[545] = "Mobiquity Networks Inc",
+	[546] = "Praxis Dynamics",
+	[547] = "Philip Morris Products S.A.",
+	[548] = "Comarch SA",
+	[549] = "Nestlé Nespresso S.A.",
+	[550] = "Merlinia A/S",
+	[551] = "LifeBEAM Technologies",
+	[552] = "Twocanoes Labs, LLC",
+	[553] = "Muoverti Limited",
+	[554] = "Stamer Musikanlagen GMBH",
+	[555] = "Tesla Motors",
+	[556] = "Pharynks Corporation",
+	[557] = "Lupine",
+	[558] = "Siemens AG",
+	[559] = "Huami (Shanghai) Culture Communication CO., LTD",
+	[560] = "Foster Electric Company, Ltd",
+	[561] = "ETA SA",
+	[562] = "x-Senso Solutions Kft",
+	[563] = "Shenzhen SuLong Communication Ltd",
+	[564] = "FengFan (BeiJing) Technology Co, Ltd",
+	[565] = "Qrio Inc",
+	[566] = "Pitpatpet Ltd",
+	[567] = "MSHeli s.r.l.",
+	[568] = "Trakm8 Ltd",
+	[569] = "JIN CO, Ltd",
+	[570] = "Alatech Tehnology",
+	[571] = "Beijing CarePulse Electronic Technology Co, Ltd",
+	[572] = "Awarepoint",
+	[573] = "ViCentra B.V.",
+	[574] = "Raven Industries",
+	[575] = "WaveWare Technologies Inc.",
+	[576] = "Argenox Technologies",
+	[577] = "Bragi GmbH",
+	[578] = "16Lab Inc",
+	[579] = "Masimo Corp",
+	[580] = "Iotera Inc",
+	[581] = "Endress+Hauser ",
+	[582] = "ACKme Networks, Inc.",
+	[583] = "FiftyThree Inc.",
+	[584] = "Parker Hannifin Corp",
+	[585] = "Transcranial Ltd",
+	[586] = "Uwatec AG",
+	[587] = "Orlan LLC",
+	[588] = "Blue Clover Devices",
+	[589] = "M-Way Solutions GmbH",
+	[590] = "Microtronics Engineering GmbH",
+	[591] = "Schneider Schreibgeräte GmbH",
+	[592] = "Sapphire Circuits LLC",
+	[593] = "Lumo Bodytech Inc.",
+	[594] = "UKC Technosolution",
+	[595] = "Xicato Inc.",
+	[596] = "Playbrush",
+	[597] = "Dai Nippon Printing Co., Ltd.",
+	[598] = "G24 Power Limited",
+	[599] = "AdBabble Local Commerce Inc.",
+	[600] = "Devialet SA",
+	[601] = "ALTYOR",
+	[602] = "University of Applied Sciences Valais/Haute Ecole Valaisanne",
+	[603] = "Five Interactive, LLC dba Zendo",
+	[604] = "NetEase（Hangzhou）Network co.Ltd.",
+	[605] = "Lexmark International Inc.",
+	[606] = "Fluke Corporation",
+	[607] = "Yardarm Technologies",
+	[608] = "SensaRx",
+	[609] = "SECVRE GmbH",
+	[610] = "Glacial Ridge Technologies",
+	[611] = "Identiv, Inc.",
+	[612] = "DDS, Inc.",
+	[613] = "SMK Corporation",
+	[614] = "Schawbel Technologies LLC",
+	[615] = "XMI Systems SA",
+	[616] = "Cerevo",
+	[617] = "Torrox GmbH & Co KG",
+	[618] = "Gemalto",
+	[619] = "DEKA Research & Development Corp.",
+	[620] = "Domster Tadeusz Szydlowski",
+	[621] = "Technogym SPA",
+	[622] = "FLEURBAEY BVBA",
+	[623] = "Aptcode Solutions",
+	[624] = "LSI ADL Technology",
+	[625] = "Animas Corp",
+	[626] = "Alps Electric Co., Ltd.",
+	[627] = "OCEASOFT",
+	[628] = "Motsai Research",
+	[629] = "Geotab",
+	[630] = "E.G.O. Elektro-Geraetebau GmbH",
+	[631] = "bewhere inc",
+	[632] = "Johnson Outdoors Inc",
+	[633] = "steute Schaltgerate GmbH & Co. KG",
+	[634] = "Ekomini inc.",
+	[635] = "DEFA AS",
+	[636] = "Aseptika Ltd",
+	[637] = "HUAWEI Technologies Co., Ltd.",
+	[638] = "HabitAware, LLC",
+	[639] = "ruwido austria gmbh",
+	[640] = "ITEC corporation",
+	[641] = "StoneL",
+	[642] = "Sonova AG",
+	[643] = "Maven Machines, Inc.",
+	[644] = "Synapse Electronics",
+	[645] = "Standard Innovation Inc.",
+	[646] = "RF Code, Inc.",
+	[647] = "Wally Ventures S.L.",
+	[648] = "Willowbank Electronics Ltd",
+	[649] = "SK Telecom",
+	[650] = "Jetro AS",
+	[651] = "Code Gears LTD",
+	[652] = "NANOLINK APS",
+	[653] = "IF, LLC",
+	[654] = "RF Digital Corp",
+	[655] = "Church & Dwight Co., Inc",
+	[656] = "Multibit Oy",
+	[657] = "CliniCloud Inc",
+	[658] = "SwiftSensors",
+	[659] = "Blue Bite",
+	[660] = "ELIAS GmbH",
+	[661] = "Sivantos GmbH",
+	[662] = "Petzl",
+	[663] = "storm power ltd",
+	[664] = "EISST Ltd",
+	[665] = "Inexess Technology Simma KG",
+	[666] = "Currant, Inc.",
+	[667] = "C2 Development, Inc.",
+	[668] = "Blue Sky Scientific, LLC",
+	[669] = "ALOTTAZS LABS, LLC",
+	[670] = "Kupson spol. s r.o.",
+	[671] = "Areus Engineering GmbH",
+	[672] = "Impossible Camera GmbH",
+	[673] = "InventureTrack Systems",
+	[674] = "LockedUp",
+	[675] = "Itude",
+	[676] = "Pacific Lock Company",
+	[677] = "Tendyron Corporation ( 天地融科技股份有限公司 )",
+	[678] = "Robert Bosch GmbH",
+	[679] = "Illuxtron international B.V.",
+	[680] = "miSport Ltd.",
+	[681] = "Chargelib",
+	[682] = "Doppler Lab",
+	[683] = "BBPOS Limited",
+	[684] = "RTB Elektronik GmbH & Co. KG",
+	[685] = "Rx Networks, Inc.",
+	[686] = "WeatherFlow, Inc.",
+	[687] = "Technicolor USA Inc.",
+	[688] = "Bestechnic(Shanghai),Ltd",
+	[689] = "Raden Inc",
+	[690] = "JouZen Oy",
+	[691] = "CLABER S.P.A.",
+	[692] = "Hyginex, Inc.",
+	[693] = "HANSHIN ELECTRIC RAILWAY CO.,LTD.",
+	[694] = "Schneider Electric",
+	[695] = "Oort Technologies LLC",
+	[696] = "Chrono Therapeutics",
+	[697] = "Rinnai Corporation",
+	[698] = "Swissprime Technologies AG",
+	[699] = "Koha.,Co.Ltd",
+	[700] = "Genevac Ltd",
+	[701] = "Chemtronics",
+	[702] = "Seguro Technology Sp. z o.o.",
+	[703] = "Redbird Flight Simulations",
+	[704] = "Dash Robotics",
+	[705] = "LINE Corporation",
+	[706] = "Guillemot Corporation",
+	[707] = "Techtronic Power Tools Technology Limited",
+	[708] = "Wilson Sporting Goods",
+	[709] = "Lenovo (Singapore) Pte Ltd. ( 联想（新加坡） )",
+	[710] = "Ayatan Sensors",
+	[711] = "Electronics Tomorrow Limited",
+	[712] = "VASCO Data Security International, Inc.",
+	[713] = "PayRange Inc.",
+	[714] = "ABOV Semiconductor",
+	[715] = "AINA-Wireless Inc.",
+	[716] = "Eijkelkamp Soil & Water",
+	[717] = "BMA ergonomics b.v.",
+	[718] = "Teva Branded Pharmaceutical Products R&D, Inc.",
+	[719] = "Anima",
+	[720] = "3M",
+	[721] = "Empatica Srl",
+	[722] = "Afero, Inc.",
+	[723] = "Powercast Corporation",
+	[724] = "Secuyou ApS",
+	[725] = "OMRON Corporation",
+	[726] = "Send Solutions",
+	[727] = "NIPPON SYSTEMWARE CO.,LTD.",
+	[728] = "Neosfar",
+	[729] = "Fliegl Agrartechnik GmbH",
+	[730] = "Gilvader",
+	[731] = "Digi International Inc (R)",
+	[732] = "DeWalch Technologies, Inc.",
+	[733] = "Flint Rehabilitation Devices, LLC",
+	[734] = "Samsung SDS Co., Ltd.",
+	[735] = "Blur Product Development",
+	[736] = "University of Michigan",
+	[737] = "Victron Energy BV",
+	[738] = "NTT docomo",
+	[739] = "Carmanah Technologies Corp.",
+	[740] = "Bytestorm Ltd.",
+	[741] = "Espressif Incorporated ( 乐鑫信息科技(上海)有限公司 )",
+	[742] = "Unwire",
+	[743] = "Connected Yard, Inc.",
+	[744] = "American Music Environments",
+	[745] = "Sensogram Technologies, Inc.",
+	[746] = "Fujitsu Limited",
+	[747] = "Ardic Technology",
+	[748] = "Delta Systems, Inc",
+	[749] = "HTC Corporation",
+	[750] = "Citizen Holdings Co., Ltd.",
+	[751] = "SMART-INNOVATION.inc",
+	[752] = "Blackrat Software",
+	[753] = "The Idea Cave, LLC",
+	[754] = "GoPro, Inc.",
+	[755] = "AuthAir, Inc",
+	[756] = "Vensi, Inc.",
+	[757] = "Indagem Tech LLC",
+	[758] = "Intemo Technologies",
+	[759] = "DreamVisions co., Ltd.",
+	[760] = "Runteq Oy Ltd",
+	[761] = "IMAGINATION TECHNOLOGIES LTD",
+	[762] = "CoSTAR Technologies",
+	[763] = "Clarius Mobile Health Corp.",
+	[764] = "Shanghai Frequen Microelectronics Co., Ltd.",
+	[765] = "Uwanna, Inc.",
+	[766] = "Lierda Science & Technology Group Co., Ltd.",
+	[767] = "Silicon Laboratories",
+	[768] = "World Moto Inc.",
+	[769] = "Giatec Scientific Inc.",
+	[770] = "Loop Devices, Inc",
+	[771] = "IACA electronique",
+	[772] = "Proxy Technologies, Inc.",
+	[773] = "Swipp ApS",
+	[774] = "Life Laboratory Inc.",
+	[775] = "FUJI INDUSTRIAL CO.,LTD.",
+	[776] = "Surefire, LLC",
+	[777] = "Dolby Labs",
+	[778] = "Ellisys",
+	[779] = "Magnitude Lighting Converters",
+	[780] = "Hilti AG",
+	[781] = "Devdata S.r.l.",
+	[782] = "Deviceworx",
+	[783] = "Shortcut Labs",
+	[784] = "SGL Italia S.r.l.",
+	[785] = "PEEQ DATA",
+	[786] = "Ducere Technologies Pvt Ltd",
+	[787] = "DiveNav, Inc.",
+	[788] = "RIIG AI Sp. z o.o.",
+	[789] = "Thermo Fisher Scientific",
+	[790] = "AG Measurematics Pvt. Ltd.",
+	[791] = "CHUO Electronics CO., LTD.",
+	[792] = "Aspenta International",
+	[793] = "Eugster Frismag AG",
+	[794] = "Amber wireless GmbH",
+	[795] = "HQ Inc",
+	[796] = "Lab Sensor Solutions",
+	[797] = "Enterlab ApS",
+	[798] = "Eyefi, Inc.",
+	[799] = "MetaSystem S.p.A",
+	[800] = "SONO ELECTRONICS. CO., LTD",
+	[801] = "Jewelbots",
+	[802] = "Compumedics Limited",
+	[803] = "Rotor Bike Components",
+	[804] = "Astro, Inc.",
+	[805] = "Amotus Solutions",
+	[806] = "Healthwear Technologies (Changzhou)Ltd",
+	[807] = "Essex Electronics",
+	[808] = "Grundfos A/S",
+	[809] = "Eargo, Inc.",
+	[810] = "Electronic Design Lab",
+	[811] = "ESYLUX",
+	[812] = "NIPPON SMT.CO.,Ltd",
+	[813] = "BM innovations GmbH",
+	[814] = "indoormap",
+	[815] = "OttoQ Inc",
+	[816] = "North Pole Engineering",
+	[817] = "3flares Technologies Inc.",
+	[818] = "Electrocompaniet A.S.",
+	[819] = "Mul-T-Lock",
+	[820] = "Corentium AS",
+	[821] = "Enlighted Inc",
+	[822] = "GISTIC",
+	[823] = "AJP2 Holdings, LLC",
+	[824] = "COBI GmbH",
+	[825] = "Blue Sky Scientific, LLC",
+	[826] = "Appception, Inc.",
+	[827] = "Courtney Thorne Limited",
+	[828] = "Virtuosys",
+	[829] = "TPV Technology Limited",
+	[830] = "Monitra SA",
+	[831] = "Automation Components, Inc.",
+	[832] = "Letsense s.r.l.",
+	[833] = "Etesian Technologies LLC",
+	[834] = "GERTEC BRASIL LTDA.",
+	[835] = "Drekker Development Pty. Ltd.",
+	[836] = "Whirl Inc",
+	[837] = "Locus Positioning",
+	[838] = "Acuity Brands Lighting, Inc",
+	[839] = "Prevent Biometrics",
+	[840] = "Arioneo",
+	[841] = "VersaMe",
+	[842] = "Vaddio",
+	[843] = "Libratone A/S",
+	[844] = "HM Electronics, Inc.",
+	[845] = "TASER International, Inc.",
+	[846] = "Safe Trust Inc.",
+	[847] = "Heartland Payment Systems",
+	[848] = "Bitstrata Systems Inc.",
+	[849] = "Pieps GmbH",
+	[850] = "iRiding(Xiamen)Technology Co.,Ltd.",
+	[851] = "Alpha Audiotronics, Inc.",
+	[852] = "TOPPAN FORMS CO.,LTD.",
+	[853] = "Sigma Designs, Inc.",
+	[854] = "Spectrum Brands, Inc.",
+	[855] = "Polymap Wireless",
+	[856] = "MagniWare Ltd.",
+	[857] = "Novotec Medical GmbH",
+	[858] = "Medicom Innovation Partner a/s",
+	[859] = "Matrix Inc.",
+	[860] = "Eaton Corporation",
+	[861] = "KYS",
+	[862] = "Naya Health, Inc.",
+	[863] = "Acromag",
+	[864] = "Insulet Corporation",
+	[865] = "Wellinks Inc.",
+	[866] = "ON Semiconductor",
+	[867] = "FREELAP SA",
+	[868] = "Favero Electronics Srl",
+	[869] = "BioMech Sensor LLC",
+	[870] = "BOLTT Sports technologies Private limited",
+	[871] = "Saphe International",
+	[872] = "Metormote AB",
+	[873] = "littleBits",
+	[874] = "SetPoint Medical",
+	[875] = "BRControls Products BV",
+	[876] = "Zipcar",
+	[877] = "AirBolt Pty Ltd",
+	[878] = "KeepTruckin Inc",
+	[879] = "Motiv, Inc.",
+	[880] = "Wazombi Labs OÜ",
+	[881] = "ORBCOMM",
+	[882] = "Nixie Labs, Inc.",
+	[883] = "AppNearMe Ltd",
+	[884] = "Holman Industries",
+	[885] = "Expain AS",
+	[886] = "Electronic Temperature Instruments Ltd",
+	[887] = "Plejd AB",
+	[888] = "Propeller Health",
+	[889] = "Shenzhen iMCO Electronic Technology Co.,Ltd",
+	[890] = "Algoria",
+	[891] = "Apption Labs Inc.",
+	[892] = "Cronologics Corporation",
+	[893] = "MICRODIA Ltd.",
+	[894] = "lulabytes S.L.",
+	[895] = "Société des Produits Nestlé S.A. (formerly Nestec S.A.)",
+	[896] = "LLC \"MEGA-F service\"",
+	[897] = "Sharp Corporation",
+	[898] = "Precision Outcomes Ltd",
+	[899] = "Kronos Incorporated",
+	[900] = "OCOSMOS Co., Ltd.",
+	[901] = "Embedded Electronic Solutions Ltd. dba e2Solutions",
+	[902] = "Aterica Inc.",
+	[903] = "BluStor PMC, Inc.",
+	[904] = "Kapsch TrafficCom AB",
+	[905] = "ActiveBlu Corporation",
+	[906] = "Kohler Mira Limited",
+	[907] = "Noke",
+	[908] = "Appion Inc.",
+	[909] = "Resmed Ltd",
+	[910] = "Crownstone B.V.",
+	[911] = "Xiaomi Inc.",
+	[912] = "INFOTECH s.r.o.",
+	[913] = "Thingsquare AB",
+	[914] = "T&D",
+	[915] = "LAVAZZA S.p.A.",
+	[916] = "Netclearance Systems, Inc.",
+	[917] = "SDATAWAY",
+	[918] = "BLOKS GmbH",
+	[919] = "LEGO System A/S",
+	[920] = "Thetatronics Ltd",
+	[921] = "Nikon Corporation",
+	[922] = "NeST",
+	[923] = "South Silicon Valley Microelectronics",
+	[924] = "ALE International",
+	[925] = "CareView Communications, Inc.",
+	[926] = "SchoolBoard Limited",
+	[927] = "Molex Corporation",
+	[928] = "IVT Wireless Limited",
+	[929] = "Alpine Labs LLC",
+	[930] = "Candura Instruments",
+	[931] = "SmartMovt Technology Co., Ltd",
+	[932] = "Token Zero Ltd",
+	[933] = "ACE CAD Enterprise Co., Ltd. (ACECAD)",
+	[934] = "Medela, Inc",
+	[935] = "AeroScout",
+	[936] = "Esrille Inc.",
+	[937] = "THINKERLY SRL",
+	[938] = "Exon Sp. z o.o.",
+	[939] = "Meizu Technology Co., Ltd.",
+	[940] = "Smablo LTD",
+	[941] = "XiQ",
+	[942] = "Allswell Inc.",
+	[943] = "Comm-N-Sense Corp DBA Verigo",
+	[944] = "VIBRADORM GmbH",
+	[945] = "Otodata Wireless Network Inc.",
+	[946] = "Propagation Systems Limited",
+	[947] = "Midwest Instruments & Controls",
+	[948] = "Alpha Nodus, inc.",
+	[949] = "petPOMM, Inc",
+	[950] = "Mattel",
+	[951] = "Airbly Inc.",
+	[952] = "A-Safe Limited",
+	[953] = "FREDERIQUE CONSTANT SA",
+	[954] = "Maxscend Microelectronics Company Limited",
+	[955] = "Abbott",
+	[956] = "ASB Bank Ltd",
+	[957] = "amadas",
+	[958] = "Applied Science, Inc.",
+	[959] = "iLumi Solutions Inc.",
+	[960] = "Arch Systems Inc.",
+	[961] = "Ember Technologies, Inc.",
+	[962] = "Snapchat Inc",
+	[963] = "Casambi Technologies Oy",
+	[964] = "Pico Technology Inc.",
+	[965] = "St. Jude Medical, Inc.",
+	[966] = "Intricon",
+	[967] = "Structural Health Systems, Inc.",
+	[968] = "Avvel International",
+	[969] = "Gallagher Group",
+	[970] = "In2things Automation Pvt. Ltd.",
+	[971] = "SYSDEV Srl",
+	[972] = "Vonkil Technologies Ltd",
+	[973] = "Wynd Technologies, Inc.",
+	[974] = "CONTRINEX S.A.",
+	[975] = "MIRA, Inc.",
+	[976] = "Watteam Ltd",
+	[977] = "Density Inc.",
+	[978] = "IOT Pot India Private Limited",
+	[979] = "Sigma Connectivity AB",
+	[980] = "PEG PEREGO SPA",
+	[981] = "Wyzelink Systems Inc.",
+	[982] = "Yota Devices LTD",
+	[983] = "FINSECUR",
+	[984] = "Zen-Me Labs Ltd",
+	[985] = "3IWare Co., Ltd.",
+	[986] = "EnOcean GmbH",
+	[987] = "Instabeat, Inc",
+	[988] = "Nima Labs",
+	[989] = "Andreas Stihl AG & Co. KG",
+	[990] = "Nathan Rhoades LLC",
+	[991] = "Grob Technologies, LLC",
+	[992] = "Actions (Zhuhai) Technology Co., Limited",
+	[993] = "SPD Development Company Ltd",
+	[994] = "Sensoan Oy",
+	[995] = "Qualcomm Life Inc",
+	[996] = "Chip-ing AG",
+	[997] = "ffly4u",
+	[998] = "IoT Instruments Oy",
+	[999] = "TRUE Fitness Technology",
+	[1000] = "Reiner Kartengeraete GmbH & Co. KG.",
+	[1001] = "SHENZHEN LEMONJOY TECHNOLOGY CO., LTD.",
+	[1002] = "Hello Inc.",
+	[1003] = "Evollve Inc.",
+	[1004] = "Jigowatts Inc.",
+	[1005] = "BASIC MICRO.COM,INC.",
+	[1006] = "CUBE TECHNOLOGIES",
+	[1007] = "foolography GmbH",
+	[1008] = "CLINK",
+	[1009] = "Hestan Smart Cooking Inc.",
+	[1010] = "WindowMaster A/S",
+	[1011] = "Flowscape AB",
+	[1012] = "PAL Technologies Ltd",
+	[1013] = "WHERE, Inc.",
+	[1014] = "Iton Technology Corp.",
+	[1015] = "Owl Labs Inc.",
+	[1016] = "Rockford Corp.",
+	[1017] = "Becon Technologies Co.,Ltd.",
+	[1018] = "Vyassoft Technologies Inc",
+	[1019] = "Nox Medical",
+	[1020] = "Kimberly-Clark",
+	[1021] = "Trimble Navigation Ltd.",
+	[1022] = "Littelfuse",
+	[1023] = "Withings",
+	[1024] = "i-developer IT Beratung UG",
+	[1025] = "Relations Inc.",
+	[1026] = "Sears Holdings Corporation",
+	[1027] = "Gantner Electronic GmbH",
+	[1028] = "Authomate Inc",
+	[1029] = "Vertex International, Inc.",
+	[1030] = "Airtago",
+	[1031] = "Swiss Audio SA",
+	[1032] = "ToGetHome Inc.",
+	[1033] = "AXIS",
+	[1034] = "Openmatics",
+	[1035] = "Jana Care Inc.",
+	[1036] = "Senix Corporation",
+	[1037] = "NorthStar Battery Company, LLC",
+	[1038] = "SKF (U.K.) Limited",
+	[1039] = "CO-AX Technology, Inc.",
+	[1040] = "Fender Musical Instruments",
+	[1041] = "Luidia Inc",
+	[1042] = "SEFAM",
+	[1043] = "Wireless Cables Inc",
+	[1044] = "Lightning Protection International Pty Ltd",
+	[1045] = "Uber Technologies Inc",
+	[1046] = "SODA GmbH",
+	[1047] = "Fatigue Science",
+	[1048] = "Alpine Electronics Inc.",
+	[1049] = "Novalogy LTD",
+	[1050] = "Friday Labs Limited",
+	[1051] = "OrthoAccel Technologies",
+	[1052] = "WaterGuru, Inc.",
+	[1053] = "Benning Elektrotechnik und Elektronik GmbH & Co. KG",
+	[1054] = "Dell Computer Corporation",
+	[1055] = "Kopin Corporation",
+	[1056] = "TecBakery GmbH",
+	[1057] = "Backbone Labs, Inc.",
+	[1058] = "DELSEY SA",
+	[1059] = "Chargifi Limited",
+	[1060] = "Trainesense Ltd.",
+	[1061] = "Unify Software and Solutions GmbH & Co. KG",
+	[1062] = "Husqvarna AB",
+	[1063] = "Focus fleet and fuel management inc",
+	[1064] = "SmallLoop, LLC",
+	[1065] = "Prolon Inc.",
+	[1066] = "BD Medical",
+	[1067] = "iMicroMed Incorporated",
+	[1068] = "Ticto N.V.",
+	[1069] = "Meshtech AS",
+	[1070] = "MemCachier Inc.",
+	[1071] = "Danfoss A/S",
+	[1072] = "SnapStyk Inc.",
+	[1073] = "Amway Corporation",
+	[1074] = "Silk Labs, Inc.",
+	[1075] = "Pillsy Inc.",
+	[1076] = "Hatch Baby, Inc.",
+	[1077] = "Blocks Wearables Ltd.",
+	[1078] = "Drayson Technologies (Europe) Limited",
+	[1079] = "eBest IOT Inc.",
+	[1080] = "Helvar Ltd",
+	[1081] = "Radiance Technologies",
+	[1082] = "Nuheara Limited",
+	[1083] = "Appside co., ltd.",
+	[1084] = "DeLaval",
+	[1085] = "Coiler Corporation",
+	[1086] = "Thermomedics, Inc.",
+	[1087] = "Tentacle Sync GmbH",
+	[1088] = "Valencell, Inc.",
+	[1089] = "iProtoXi Oy",
+	[1090] = "SECOM CO., LTD.",
+	[1091] = "Tucker International LLC",
+	[1092] = "Metanate Limited",
+	[1093] = "Kobian Canada Inc.",
+	[1094] = "NETGEAR, Inc.",
+	[1095] = "Fabtronics Australia Pty Ltd",
+	[1096] = "Grand Centrix GmbH",
+	[1097] = "1UP USA.com llc",
+	[1098] = "SHIMANO INC.",
+	[1099] = "Nain Inc.",
+	[1100] = "LifeStyle Lock, LLC",
+	[1101] = "VEGA Grieshaber KG",
+	[1102] = "Xtrava Inc.",
+	[1103] = "TTS Tooltechnic Systems AG & Co. KG",
+	[1104] = "Teenage Engineering AB",
+	[1105] = "Tunstall Nordic AB",
+	[1106] = "Svep Design Center AB",
+	[1107] = "GreenPeak Technologies BV",
+	[1108] = "Sphinx Electronics GmbH & Co KG",
+	[1109] = "Atomation",
+	[1110] = "Nemik Consulting Inc",
+	[1111] = "RF INNOVATION",
+	[1112] = "Mini Solution Co., Ltd.",
+	[1113] = "Lumenetix, Inc",
+	[1114] = "2048450 Ontario Inc",
+	[1115] = "SPACEEK LTD",
+	[1116] = "Delta T Corporation",
+	[1117] = "Boston Scientific Corporation",
+	[1118] = "Nuviz, Inc.",
+	[1119] = "Real Time Automation, Inc.",
+	[1120] = "Kolibree",
+	[1121] = "vhf elektronik GmbH",
+	[1122] = "Bonsai Systems GmbH",
+	[1123] = "Fathom Systems Inc.",
+	[1124] = "Bellman & Symfon",
+	[1125] = "International Forte Group LLC",
+	[1126] = "CycleLabs Solutions inc.",
+	[1127] = "Codenex Oy",
+	[1128] = "Kynesim Ltd",
+	[1129] = "Palago AB",
+	[1130] = "INSIGMA INC.",
+	[1131] = "PMD Solutions",
+	[1132] = "Qingdao Realtime Technology Co., Ltd.",
+	[1133] = "BEGA Gantenbrink-Leuchten KG",
+	[1134] = "Pambor Ltd.",
+	[1135] = "Develco Products A/S",
+	[1136] = "iDesign s.r.l.",
+	[1137] = "TiVo Corp",
+	[1138] = "Control-J Pty Ltd",
+	[1139] = "Steelcase, Inc.",
+	[1140] = "iApartment co., ltd.",
+	[1141] = "Icom inc.",
+	[1142] = "Oxstren Wearable Technologies Private Limited",
+	[1143] = "Blue Spark Technologies",
+	[1144] = "FarSite Communications Limited",
+	[1145] = "mywerk system GmbH",
+	[1146] = "Sinosun Technology Co., Ltd.",
+	[1147] = "MIYOSHI ELECTRONICS CORPORATION",
+	[1148] = "POWERMAT LTD",
+	[1149] = "Occly LLC",
+	[1150] = "OurHub Dev IvS",
+	[1151] = "Pro-Mark, Inc.",
+	[1152] = "Dynometrics Inc.",
+	[1153] = "Quintrax Limited",
+	[1154] = "POS Tuning Udo Vosshenrich GmbH & Co. KG",
+	[1155] = "Multi Care Systems B.V.",
+	[1156] = "Revol Technologies Inc",
+	[1157] = "SKIDATA AG",
+	[1158] = "DEV TECNOLOGIA INDUSTRIA, COMERCIO E MANUTENCAO DE EQUIPAMENTOS LTDA. - ME",
+	[1159] = "Centrica Connected Home",
+	[1160] = "Automotive Data Solutions Inc",
+	[1161] = "Igarashi Engineering",
+	[1162] = "Taelek Oy",
+	[1163] = "CP Electronics Limited",
+	[1164] = "Vectronix AG",
+	[1165] = "S-Labs Sp. z o.o.",
+	[1166] = "Companion Medical, Inc.",
+	[1167] = "BlueKitchen GmbH",
+	[1168] = "Matting AB",
+	[1169] = "SOREX - Wireless Solutions GmbH",
+	[1170] = "ADC Technology, Inc.",
+	[1171] = "Lynxemi Pte Ltd",
+	[1172] = "SENNHEISER electronic GmbH & Co. KG",
+	[1173] = "LMT Mercer Group, Inc",
+	[1174] = "Polymorphic Labs LLC",
+	[1175] = "Cochlear Limited",
+	[1176] = "METER Group, Inc. USA",
+	[1177] = "Ruuvi Innovations Ltd.",
+	[1178] = "Situne AS",
+	[1179] = "nVisti, LLC",
+	[1180] = "DyOcean",
+	[1181] = "Uhlmann & Zacher GmbH",
+	[1182] = "AND!XOR LLC",
+	[1183] = "tictote AB",
+	[1184] = "Vypin, LLC",
+	[1185] = "PNI Sensor Corporation",
+	[1186] = "ovrEngineered, LLC",
+	[1187] = "GT-tronics HK Ltd",
+	[1188] = "Herbert Waldmann GmbH & Co. KG",
+	[1189] = "Guangzhou FiiO Electronics Technology Co.,Ltd",
+	[1190] = "Vinetech Co., Ltd",
+	[1191] = "Dallas Logic Corporation",
+	[1192] = "BioTex, Inc.",
+	[1193] = "DISCOVERY SOUND TECHNOLOGY, LLC",
+	[1194] = "LINKIO SAS",
+	[1195] = "Harbortronics, Inc.",
+	[1196] = "Undagrid B.V.",
+	[1197] = "Shure Inc",
+	[1198] = "ERM Electronic Systems LTD",
+	[1199] = "BIOROWER Handelsagentur GmbH",
+	[1200] = "Weba Sport und Med. Artikel GmbH",
+	[1201] = "Kartographers Technologies Pvt. Ltd.",
+	[1202] = "The Shadow on the Moon",
+	[1203] = "mobike (Hong Kong) Limited",
+	[1204] = "Inuheat Group AB",
+	[1205] = "Swiftronix AB",
+	[1206] = "Diagnoptics Technologies",
+	[1207] = "Analog Devices, Inc.",
+	[1208] = "Soraa Inc.",
+	[1209] = "CSR Building Products Limited",
+	[1210] = "Crestron Electronics, Inc.",
+	[1211] = "Neatebox Ltd",
+	[1212] = "Draegerwerk AG & Co. KGaA",
+	[1213] = "AlbynMedical",
+	[1214] = "Averos FZCO",
+	[1215] = "VIT Initiative, LLC",
+	[1216] = "Statsports International",
+	[1217] = "Sospitas, s.r.o.",
+	[1218] = "Dmet Products Corp.",
+	[1219] = "Mantracourt Electronics Limited",
+	[1220] = "TeAM Hutchins AB",
+	[1221] = "Seibert Williams Glass, LLC",
+	[1222] = "Insta GmbH",
+	[1223] = "Svantek Sp. z o.o.",
+	[1224] = "Shanghai Flyco Electrical Appliance Co., Ltd.",
+	[1225] = "Thornwave Labs Inc",
+	[1226] = "Steiner-Optik GmbH",
+	[1227] = "Novo Nordisk A/S",
+	[1228] = "Enflux Inc.",
+	[1229] = "Safetech Products LLC",
+	[1230] = "GOOOLED S.R.L.",
+	[1231] = "DOM Sicherheitstechnik GmbH & Co. KG",
+	[1232] = "Olympus Corporation",
+	[1233] = "KTS GmbH",
+	[1234] = "Anloq Technologies Inc.",
+	[1235] = "Queercon, Inc",
+	[1236] = "5th Element Ltd",
+	[1237] = "Gooee Limited",
+	[1238] = "LUGLOC LLC",
+	[1239] = "Blincam, Inc.",
+	[1240] = "FUJIFILM Corporation",
+	[1241] = "RandMcNally",
+	[1242] = "Franceschi Marina snc",
+	[1243] = "Engineered Audio, LLC.",
+	[1244] = "IOTTIVE (OPC) PRIVATE LIMITED",
+	[1245] = "4MOD Technology",
+	[1246] = "Lutron Electronics Co., Inc.",
+	[1247] = "Emerson",
+	[1248] = "Guardtec, Inc.",
+	[1249] = "REACTEC LIMITED",
+	[1250] = "EllieGrid",
+	[1251] = "Under Armour",
+	[1252] = "Woodenshark",
+	[1253] = "Avack Oy",
+	[1254] = "Smart Solution Technology, Inc.",
+	[1255] = "REHABTRONICS INC.",
+	[1256] = "STABILO International",
+	[1257] = "Busch Jaeger Elektro GmbH",
+	[1258] = "Pacific Bioscience Laboratories, Inc",
+	[1259] = "Bird Home Automation GmbH",
+	[1260] = "Motorola Solutions",
+	[1261] = "R9 Technology, Inc.",
+	[1262] = "Auxivia",
+	[1263] = "DaisyWorks, Inc",
+	[1264] = "Kosi Limited",
+	[1265] = "Theben AG",
+	[1266] = "InDreamer Techsol Private Limited",
+	[1267] = "Cerevast Medical",
+	[1268] = "ZanCompute Inc.",
+	[1269] = "Pirelli Tyre S.P.A.",
+	[1270] = "McLear Limited",
+	[1271] = "Shenzhen Huiding Technology Co.,Ltd.",
+	[1272] = "Convergence Systems Limited",
+	[1273] = "Interactio",
+	[1274] = "Androtec GmbH",
+	[1275] = "Benchmark Drives GmbH & Co. KG",
+	[1276] = "SwingLync L. L. C.",
+	[1277] = "Tapkey GmbH",
+	[1278] = "Woosim Systems Inc.",
+	[1279] = "Microsemi Corporation",
+	[1280] = "Wiliot LTD.",
+	[1281] = "Polaris IND",
+	[1282] = "Specifi-Kali LLC",
+	[1283] = "Locoroll, Inc",
+	[1284] = "PHYPLUS Inc",
+	[1285] = "Inplay Technologies LLC",
+	[1286] = "Hager",
+	[1287] = "Yellowcog",
+	[1288] = "Axes System sp. z o. o.",
+	[1289] = "myLIFTER Inc.",
+	[1290] = "Shake-on B.V.",
+	[1291] = "Vibrissa Inc.",
+	[1292] = "OSRAM GmbH",
+	[1293] = "TRSystems GmbH",
+	[1294] = "Yichip Microelectronics (Hangzhou) Co.,Ltd.",
+	[1295] = "Foundation Engineering LLC",
+	[1296] = "UNI-ELECTRONICS, INC.",
+	[1297] = "Brookfield Equinox LLC",
+	[1298] = "Soprod SA",
+	[1299] = "9974091 Canada Inc.",
+	[1300] = "FIBRO GmbH",
+	[1301] = "RB Controls Co., Ltd.",
+	[1302] = "Footmarks",
+	[1303] = "Amtronic Sverige AB (formerly Amcore AB)",
+	[1304] = "MAMORIO.inc",
+	[1305] = "Tyto Life LLC",
+	[1306] = "Leica Camera AG",
+	[1307] = "Angee Technologies Ltd.",
+	[1308] = "EDPS",
+	[1309] = "OFF Line Co., Ltd.",
+	[1310] = "Detect Blue Limited",
+	[1311] = "Setec Pty Ltd",
+	[1312] = "Target Corporation",
+	[1313] = "IAI Corporation",
+	[1314] = "NS Tech, Inc.",
+	[1315] = "MTG Co., Ltd.",
+	[1316] = "Hangzhou iMagic Technology Co., Ltd",
+	[1317] = "HONGKONG NANO IC TECHNOLOGIES  CO., LIMITED",
+	[1318] = "Honeywell International Inc.",
+	[1319] = "Albrecht JUNG",
+	[1320] = "Lunera Lighting Inc.",
+	[1321] = "Lumen UAB",
+	[1322] = "Keynes Controls Ltd",
+	[1323] = "Novartis AG",
+	[1324] = "Geosatis SA",
+	[1325] = "EXFO, Inc.",
+	[1326] = "LEDVANCE GmbH",
+	[1327] = "Center ID Corp.",
+	[1328] = "Adolene, Inc.",
+	[1329] = "D&M Holdings Inc.",
+	[1330] = "CRESCO Wireless, Inc.",
+	[1331] = "Nura Operations Pty Ltd",
+	[1332] = "Frontiergadget, Inc.",
+	[1333] = "Smart Component Technologies Limited",
+	[1334] = "ZTR Control Systems LLC",
+	[1335] = "MetaLogics Corporation",
+	[1336] = "Medela AG",
+	[1337] = "OPPLE Lighting Co., Ltd",
+	[1338] = "Savitech Corp.,",
+	[1339] = "prodigy",
+	[1340] = "Screenovate Technologies Ltd",
+	[1341] = "TESA SA",
+	[1342] = "CLIM8 LIMITED",
+	[1343] = "Silergy Corp",
+	[1344] = "SilverPlus, Inc",
+	[1345] = "Sharknet srl",
+	[1346] = "Mist Systems, Inc.",
+	[1347] = "MIWA LOCK CO.,Ltd",
+	[1348] = "OrthoSensor, Inc.",
+	[1349] = "Candy Hoover Group s.r.l",
+	[1350] = "Apexar Technologies S.A.",
+	[1351] = "LOGICDATA d.o.o.",
+	[1352] = "Knick Elektronische Messgeraete GmbH & Co. KG",
+	[1353] = "Smart Technologies and Investment Limited",
+	[1354] = "Linough Inc.",
+	[1355] = "Advanced Electronic Designs, Inc.",
+	[1356] = "Carefree Scott Fetzer Co Inc",
+	[1357] = "Sensome",
+	[1358] = "FORTRONIK storitve d.o.o.",
+	[1359] = "Sinnoz",
+	[1360] = "Versa Networks, Inc.",
+	[1361] = "Sylero",
+	[1362] = "Avempace SARL",
+	[1363] = "Nintendo Co., Ltd.",
+	[1364] = "National Instruments",
+	[1365] = "KROHNE Messtechnik GmbH",
+	[1366] = "Otodynamics Ltd",
+	[1367] = "Arwin Technology Limited",
+	[1368] = "benegear, inc.",
+	[1369] = "Newcon Optik",
+	[1370] = "CANDY HOUSE, Inc.",
+	[1371] = "FRANKLIN TECHNOLOGY INC",
+	[1372] = "Lely",
+	[1373] = "Valve Corporation",
+	[1374] = "Hekatron Vertriebs GmbH",
+	[1375] = "PROTECH S.A.S. DI GIRARDI ANDREA & C.",
+	[1376] = "Sarita CareTech APS (formerly Sarita CareTech IVS)",
+	[1377] = "Finder S.p.A.",
+	[1378] = "Thalmic Labs Inc.",
+	[1379] = "Steinel Vertrieb GmbH",
+	[1380] = "Beghelli Spa",
+	[1381] = "Beijing Smartspace Technologies Inc.",
+	[1382] = "CORE TRANSPORT TECHNOLOGIES NZ LIMITED",
+	[1383] = "Xiamen Everesports Goods Co., Ltd",
+	[1384] = "Bodyport Inc.",
+	[1385] = "Audionics System, INC.",
+	[1386] = "Flipnavi Co.,Ltd.",
+	[1387] = "Rion Co., Ltd.",
+	[1388] = "Long Range Systems, LLC",
+	[1389] = "Redmond Industrial Group LLC",
+	[1390] = "VIZPIN INC.",
+	[1391] = "BikeFinder AS",
+	[1392] = "Consumer Sleep Solutions LLC",
+	[1393] = "PSIKICK, INC.",
+	[1394] = "AntTail.com",
+	[1395] = "Lighting Science Group Corp.",
+	[1396] = "AFFORDABLE ELECTRONICS INC",
+	[1397] = "Integral Memroy Plc",
+	[1398] = "Globalstar, Inc.",
+	[1399] = "True Wearables, Inc.",
+	[1400] = "Wellington Drive Technologies Ltd",
+	[1401] = "Ensemble Tech Private Limited",
+	[1402] = "OMNI Remotes",
+	[1403] = "Duracell U.S. Operations Inc.",
+	[1404] = "Toor Technologies LLC",
+	[1405] = "Instinct Performance",
+	[1406] = "Beco, Inc",
+	[1407] = "Scuf Gaming International, LLC",
+	[1408] = "ARANZ Medical Limited",
+	[1409] = "LYS TECHNOLOGIES LTD",
+	[1410] = "Breakwall Analytics, LLC",
+	[1411] = "Code Blue Communications",
+	[1412] = "Gira Giersiepen GmbH & Co. KG",
+	[1413] = "Hearing Lab Technology",
+	[1414] = "LEGRAND",
+	[1415] = "Derichs GmbH",
+	[1416] = "ALT-TEKNIK LLC",
+	[1417] = "Star Technologies",
+	[1418] = "START TODAY CO.,LTD.",
+	[1419] = "Maxim Integrated Products",
+	[1420] = "MERCK Kommanditgesellschaft auf Aktien",
+	[1421] = "Jungheinrich Aktiengesellschaft",
+	[1422] = "Oculus VR, LLC",
+	[1423] = "HENDON SEMICONDUCTORS PTY LTD",
+	[1424] = "Pur3 Ltd",
+	[1425] = "Viasat Group S.p.A.",
+	[1426] = "IZITHERM",
+	[1427] = "Spaulding Clinical Research",
+	[1428] = "Kohler Company",
+	[1429] = "Inor Process AB",
+	[1430] = "My Smart Blinds",
+	[1431] = "RadioPulse Inc",
+	[1432] = "rapitag GmbH",
+	[1433] = "Lazlo326, LLC.",
+	[1434] = "Teledyne Lecroy, Inc.",
+	[1435] = "Dataflow Systems Limited",
+	[1436] = "Macrogiga Electronics",
+	[1437] = "Tandem Diabetes Care",
+	[1438] = "Polycom, Inc.",
+	[1439] = "Fisher & Paykel Healthcare",
+	[1440] = "RCP Software Oy",
+	[1441] = "Shanghai Xiaoyi Technology Co.,Ltd.",
+	[1442] = "ADHERIUM(NZ) LIMITED",
+	[1443] = "Axiomware Systems Incorporated",
+	[1444] = "O. E. M. Controls, Inc.",
+	[1445] = "Kiiroo BV",
+	[1446] = "Telecon Mobile Limited",
+	[1447] = "Sonos Inc",
+	[1448] = "Tom Allebrandi Consulting",
+	[1449] = "Monidor",
+	[1450] = "Tramex Limited",
+	[1451] = "Nofence AS",
+	[1452] = "GoerTek Dynaudio Co., Ltd.",
+	[1453] = "INIA",
+	[1454] = "CARMATE MFG.CO.,LTD",
+	[1455] = "ONvocal",
+	[1456] = "NewTec GmbH",
+	[1457] = "Medallion Instrumentation Systems",
+	[1458] = "CAREL INDUSTRIES S.P.A.",
+	[1459] = "Parabit Systems, Inc.",
+	[1460] = "White Horse Scientific ltd",
+	[1461] = "verisilicon",
+	[1462] = "Elecs Industry Co.,Ltd.",
+	[1463] = "Beijing Pinecone Electronics Co.,Ltd.",
+	[1464] = "Ambystoma Labs Inc.",
+	[1465] = "Suzhou Pairlink Network Technology",
+	[1466] = "igloohome",
+	[1467] = "Oxford Metrics plc",
+	[1468] = "Leviton Mfg. Co., Inc.",
+	[1469] = "ULC Robotics Inc.",
+	[1470] = "RFID Global by Softwork SrL",
+	[1471] = "Real-World-Systems Corporation",
+	[1472] = "Nalu Medical, Inc.",
+	[1473] = "P.I.Engineering",
+	[1474] = "Grote Industries",
+	[1475] = "Runtime, Inc.",
+	[1476] = "Codecoup sp. z o.o. sp. k.",
+	[1477] = "SELVE GmbH & Co. KG",
+	[1478] = "Smart Animal Training Systems, LLC",
+	[1479] = "Lippert Components, INC",
+	[1480] = "SOMFY SAS",
+	[1481] = "TBS Electronics B.V.",
+	[1482] = "MHL Custom Inc",
+	[1483] = "LucentWear LLC",
+	[1484] = "WATTS ELECTRONICS",
+	[1485] = "RJ Brands LLC",
+	[1486] = "V-ZUG Ltd",
+	[1487] = "Biowatch SA",
+	[1488] = "Anova Applied Electronics",
+	[1489] = "Lindab AB",
+	[1490] = "frogblue TECHNOLOGY GmbH",
+	[1491] = "Acurable Limited",
+	[1492] = "LAMPLIGHT Co., Ltd.",
+	[1493] = "TEGAM, Inc.",
+	[1494] = "Zhuhai Jieli technology Co.,Ltd",
+	[1495] = "modum.io AG",
+	[1496] = "Farm Jenny LLC",
+	[1497] = "Toyo Electronics Corporation",
+	[1498] = "Applied Neural Research Corp",
+	[1499] = "Avid Identification Systems, Inc.",
+	[1500] = "Petronics Inc.",
+	[1501] = "essentim GmbH",
+	[1502] = "QT Medical INC.",
+	[1503] = "VIRTUALCLINIC.DIRECT LIMITED",
+	[1504] = "Viper Design LLC",
+	[1505] = "Human, Incorporated",
+	[1506] = "stAPPtronics GmbH",
+	[1507] = "Elemental Machines, Inc.",
+	[1508] = "Taiyo Yuden Co., Ltd",
+	[1509] = "INEO ENERGY& SYSTEMS",
+	[1510] = "Motion Instruments Inc.",
+	[1511] = "PressurePro",
+	[1512] = "COWBOY",
+	[1513] = "iconmobile GmbH",
+	[1514] = "ACS-Control-System GmbH",
+	[1515] = "Bayerische Motoren Werke AG",
+	[1516] = "Gycom Svenska AB",
+	[1517] = "Fuji Xerox Co., Ltd",
+	[1518] = "Glide Inc.",
+	[1519] = "SIKOM AS",
+	[1520] = "beken",
+	[1521] = "The Linux Foundation",
+	[1522] = "Try and E CO.,LTD.",
+	[1523] = "SeeScan",
+	[1524] = "Clearity, LLC",
+	[1525] = "GS TAG",
+	[1526] = "DPTechnics",
+	[1527] = "TRACMO, INC.",
+	[1528] = "Anki Inc.",
+	[1529] = "Hagleitner Hygiene International GmbH",
+	[1530] = "Konami Sports Life Co., Ltd.",
+	[1531] = "Arblet Inc.",
+	[1532] = "Masbando GmbH",
+	[1533] = "Innoseis",
+	[1534] = "Niko nv",
+	[1535] = "Wellnomics Ltd",
+	[1536] = "iRobot Corporation",
+	[1537] = "Schrader Electronics",
+	[1538] = "Geberit International AG",
+	[1539] = "Fourth Evolution Inc",
+	[1540] = "Cell2Jack LLC",
+	[1541] = "FMW electronic Futterer u. Maier-Wolf OHG",
+	[1542] = "John Deere",
+	[1543] = "Rookery Technology Ltd",
+	[1544] = "KeySafe-Cloud",
+	[1545] = "BUCHI Labortechnik AG",
+	[1546] = "IQAir AG",
+	[1547] = "Triax Technologies Inc",
+	[1548] = "Vuzix Corporation",
+	[1549] = "TDK Corporation",
+	[1550] = "Blueair AB",
+	[1551] = "Signify Netherlands",
+	[1552] = "ADH GUARDIAN USA LLC",
+	[1553] = "Beurer GmbH",
+	[1554] = "Playfinity AS",
+	[1555] = "Hans Dinslage GmbH",
+	[1556] = "OnAsset Intelligence, Inc.",
+	[1557] = "INTER ACTION Corporation",
+	[1558] = "OS42 UG (haftungsbeschraenkt)",
+	[1559] = "WIZCONNECTED COMPANY LIMITED",
+	[1560] = "Audio-Technica Corporation",
+	[1561] = "Six Guys Labs, s.r.o.",
+	[1562] = "R.W. Beckett Corporation",
+	[1563] = "silex technology, inc.",
+	[1564] = "Univations Limited",
+	[1565] = "SENS Innovation ApS",
+	[1566] = "Diamond Kinetics, Inc.",
+	[1567] = "Phrame Inc.",
+	[1568] = "Forciot Oy",
+	[1569] = "Noordung d.o.o.",
+	[1570] = "Beam Labs, LLC",
+	[1571] = "Philadelphia Scientific (U.K.) Limited",
+	[1572] = "Biovotion AG",
+	[1573] = "Square Panda, Inc.",
+	[1574] = "Amplifico",
+	[1575] = "WEG S.A.",
+	[1576] = "Ensto Oy",
+	[1577] = "PHONEPE PVT LTD",
+	[1578] = "Lunatico Astronomia SL",
+	[1579] = "MinebeaMitsumi Inc.",
+	[1580] = "ASPion GmbH",
+	[1581] = "Vossloh-Schwabe Deutschland GmbH",
+	[1582] = "Procept",
+	[1583] = "ONKYO Corporation",
+	[1584] = "Asthrea D.O.O.",
+	[1585] = "Fortiori Design LLC",
+	[1586] = "Hugo Muller GmbH & Co KG",
+	[1587] = "Wangi Lai PLT",
+	[1588] = "Fanstel Corp",
+	[1589] = "Crookwood",
+	[1590] = "ELECTRONICA INTEGRAL DE SONIDO S.A.",
+	[1591] = "GiP Innovation Tools GmbH",
+	[1592] = "LX SOLUTIONS PTY LIMITED",
+	[1593] = "Shenzhen Minew Technologies Co., Ltd.",
+	[1594] = "Prolojik Limited",
+	[1595] = "Kromek Group Plc",
+	[1596] = "Contec Medical Systems Co., Ltd.",
+	[1597] = "Xradio Technology Co.,Ltd.",
+	[1598] = "The Indoor Lab, LLC",
+	[1599] = "LDL TECHNOLOGY",
+	[1600] = "Parkifi",
+	[1601] = "Revenue Collection Systems FRANCE SAS",
+	[1602] = "Bluetrum Technology Co.,Ltd",
+	[1603] = "makita corporation",
+	[1604] = "Apogee Instruments",
+	[1605] = "BM3",
+	[1606] = "SGV Group Holding GmbH & Co. KG",
+	[1607] = "MED-EL",
+	[1608] = "Ultune Technologies",
+	[1609] = "Ryeex Technology Co.,Ltd.",
+	[1610] = "Open Research Institute, Inc.",
+	[1611] = "Scale-Tec, Ltd",
+	[1612] = "Zumtobel Group AG",
+	[1613] = "iLOQ Oy",
+	[1614] = "KRUXWorks Technologies Private Limited",
+	[1615] = "Digital Matter Pty Ltd",
+	[1616] = "Coravin, Inc.",
+	[1617] = "Stasis Labs, Inc.",
+	[1618] = "ITZ Innovations- und Technologiezentrum GmbH",
+	[1619] = "Meggitt SA",
+	[1620] = "Ledlenser GmbH & Co. KG",
+	[1621] = "Renishaw PLC",
+	[1622] = "ZhuHai AdvanPro Technology Company Limited",
+	[1623] = "Meshtronix Limited",
+	[1624] = "Payex Norge AS",
+	[1625] = "UnSeen Technologies Oy",
+	[1626] = "Zound Industries International AB",
+	[1627] = "Sesam Solutions BV",
+	[1628] = "PixArt Imaging Inc.",
+	[1629] = "Panduit Corp.",
+	[1630] = "Alo AB",
+	[1631] = "Ricoh Company Ltd",
+	[1632] = "RTC Industries, Inc.",
+	[1633] = "Mode Lighting Limited",
+	[1634] = "Particle Industries, Inc.",
+	[1635] = "Advanced Telemetry Systems, Inc.",
+	[1636] = "RHA TECHNOLOGIES LTD",
+	[1637] = "Pure International Limited",
+	[1638] = "WTO Werkzeug-Einrichtungen GmbH",
+	[1639] = "Spark Technology Labs Inc.",
+	[1640] = "Bleb Technology srl",
+	[1641] = "Livanova USA, Inc.",
+	[1642] = "Brady Worldwide Inc.",
+	[1643] = "DewertOkin GmbH",
+	[1644] = "Ztove ApS",
+	[1645] = "Venso EcoSolutions AB",
+	[1646] = "Eurotronik Kranj d.o.o.",
+	[1647] = "Hug Technology Ltd",
+	[1648] = "Gema Switzerland GmbH",
+	[1649] = "Buzz Products Ltd.",
+	[1650] = "Kopi",
+	[1651] = "Innova Ideas Limited",
+	[1652] = "BeSpoon",
+	[1653] = "Deco Enterprises, Inc.",
+	[1654] = "Expai Solutions Private Limited",
+	[1655] = "Innovation First, Inc.",
+	[1656] = "SABIK Offshore GmbH",
+	[1657] = "4iiii Innovations Inc.",
+	[1658] = "The Energy Conservatory, Inc.",
+	[1659] = "I.FARM, INC.",
+	[1660] = "Tile, Inc.",
+	[1661] = "Form Athletica Inc.",
+	[1662] = "MbientLab Inc",
+	[1663] = "NETGRID S.N.C. DI BISSOLI MATTEO, CAMPOREALE SIMONE, TOGNETTI FEDERICO",
+	[1664] = "Mannkind Corporation",
+	[1665] = "Trade FIDES a.s.",
+	[1666] = "Photron Limited",
+	[1667] = "Eltako GmbH",
+	[1668] = "Dermalapps, LLC",
+	[1669] = "Greenwald Industries",
+	[1670] = "inQs Co., Ltd.",
+	[1671] = "Cherry GmbH",
+	[1672] = "Amsted Digital Solutions Inc.",
+	[1673] = "Tacx b.v.",
+	[1674] = "Raytac Corporation",
+	[1675] = "Jiangsu Teranovo Tech Co., Ltd.",
+	[1676] = "Changzhou Sound Dragon Electronics and Acoustics Co., Ltd",
+	[1677] = "JetBeep Inc.",
+	[1678] = "Razer Inc.",
+	[1679] = "JRM Group Limited",
+	[1680] = "Eccrine Systems, Inc.",
+	[1681] = "Curie Point AB",
+	[1682] = "Georg Fischer AG",
+	[1683] = "Hach - Danaher",
+	[1684] = "T&A Laboratories LLC",
+	[1685] = "Koki Holdings Co., Ltd.",
+	[1686] = "Gunakar Private Limited",
+	[1687] = "Stemco Products Inc",
+	[1688] = "Wood IT Security, LLC",
+	[1689] = "RandomLab SAS",
+	[1690] = "Adero, Inc. (formerly as TrackR, Inc.)",
+	[1691] = "Dragonchip Limited",
+	[1692] = "Noomi AB",
+	[1693] = "Vakaros LLC",
+	[1694] = "Delta Electronics, Inc.",
+	[1695] = "FlowMotion Technologies AS",
+	[1696] = "OBIQ Location Technology Inc.",
+	[1697] = "Cardo Systems, Ltd",
+	[1698] = "Globalworx GmbH",
+	[1699] = "Nymbus, LLC",
+	[1700] = "Sanyo Techno Solutions Tottori Co., Ltd.",
+	[1701] = "TEKZITEL PTY LTD",
+	[1702] = "Roambee Corporation",
+	[1703] = "Chipsea Technologies (ShenZhen) Corp.",
+	[1704] = "GD Midea Air-Conditioning Equipment Co., Ltd.",
+	[1705] = "Soundmax Electronics Limited",
+	[1706] = "Produal Oy",
+	[1707] = "HMS Industrial Networks AB",
+	[1708] = "Ingchips Technology Co., Ltd.",
+	[1709] = "InnovaSea Systems Inc.",
+	[1710] = "SenseQ Inc.",
+	[1711] = "Shoof Technologies",
+	[1712] = "BRK Brands, Inc.",
+	[1713] = "SimpliSafe, Inc.",
+	[1714] = "Tussock Innovation 2013 Limited",
+	[1715] = "The Hablab ApS",
+	[1716] = "Sencilion Oy",
+	[1717] = "Wabilogic Ltd.",
+	[1718] = "Sociometric Solutions, Inc.",
+	[1719] = "iCOGNIZE GmbH",
+	[1720] = "ShadeCraft, Inc",
+	[1721] = "Beflex Inc.",
+	[1722] = "Beaconzone Ltd",
+	[1723] = "Leaftronix Analogic Solutions Private Limited",
+	[1724] = "TWS Srl",
+	[1725] = "ABB Oy",
+	[1726] = "HitSeed Oy",
+	[1727] = "Delcom Products Inc.",
+	[1728] = "CAME S.p.A.",
+	[1729] = "Alarm.com Holdings, Inc",
+	[1730] = "Measurlogic Inc.",
+	[1731] = "King I Electronics.Co.,Ltd",
+	[1732] = "Dream Labs GmbH",
+	[1733] = "Urban Compass, Inc",
+	[1734] = "Simm Tronic Limited",
+	[1735] = "Somatix Inc",
+	[1736] = "Storz & Bickel GmbH & Co. KG",
+	[1737] = "MYLAPS B.V.",
+	[1738] = "Shenzhen Zhongguang Infotech Technology Development Co., Ltd",
+	[1739] = "Dyeware, LLC",
+	[1740] = "Dongguan SmartAction Technology Co.,Ltd.",
+	[1741] = "DIG Corporation",
+	[1742] = "FIOR & GENTZ",
+	[1743] = "Belparts N.V.",
+	[1744] = "Etekcity Corporation",
+	[1745] = "Meyer Sound Laboratories, Incorporated",
+	[1746] = "CeoTronics AG",
+	[1747] = "TriTeq Lock and Security, LLC",
+	[1748] = "DYNAKODE TECHNOLOGY PRIVATE LIMITED",
+	[1749] = "Sensirion AG",
+	[1750] = "JCT Healthcare Pty Ltd",
+	[1751] = "FUBA Automotive Electronics GmbH",
+	[1752] = "AW Company",
+	[1753] = "Shanghai Mountain View Silicon Co.,Ltd.",
+	[1754] = "Zliide Technologies ApS",
+	[1755] = "Automatic Labs, Inc.",
+	[1756] = "Industrial Network Controls, LLC",
+	[1757] = "Intellithings Ltd.",
+	[1758] = "Navcast, Inc.",
+	[1759] = "Hubbell Lighting, Inc.",
+	[1760] = "Avaya ",
+	[1761] = "Milestone AV Technologies LLC",
+	[1762] = "Alango Technologies Ltd",
+	[1763] = "Spinlock Ltd",
+	[1764] = "Aluna",
+	[1765] = "OPTEX CO.,LTD.",
+	[1766] = "NIHON DENGYO KOUSAKU",
+	[1767] = "VELUX A/S",
+	[1768] = "Almendo Technologies GmbH",
+	[1769] = "Zmartfun Electronics, Inc.",
+	[1770] = "SafeLine Sweden AB",
+	[1771] = "Houston Radar LLC",
+	[1772] = "Sigur",
+	[1773] = "J Neades Ltd",
+	[1774] = "Avantis Systems Limited",
+	[1775] = "ALCARE Co., Ltd.",
+	[1776] = "Chargy Technologies, SL",
+	[1777] = "Shibutani Co., Ltd.",
+	[1778] = "Trapper Data AB",
+	[1779] = "Alfred International Inc.",
+	[1780] = "Near Field Solutions Ltd",
+	[1781] = "Vigil Technologies Inc.",
+	[1782] = "Vitulo Plus BV",
+	[1783] = "WILKA Schliesstechnik GmbH",
+	[1784] = "BodyPlus Technology Co.,Ltd",
+	[1785] = "happybrush GmbH",
+	[1786] = "Enequi AB",
+	[1787] = "Sartorius AG",
+	[1788] = "Tom Communication Industrial Co.,Ltd.",
+	[1789] = "ESS Embedded System Solutions Inc.",
+	[1790] = "Mahr GmbH",
+	[1791] = "Redpine Signals Inc",
+	[1792] = "TraqFreq LLC",
+	[1793] = "PAFERS TECH",
+	[1794] = "Akciju sabiedriba \"SAF TEHNIKA\"",
+	[1795] = "Beijing Jingdong Century Trading Co., Ltd.",
+	[1796] = "JBX Designs Inc.",
+	[1797] = "AB Electrolux",
+	[1798] = "Wernher von Braun Center for ASdvanced Research",
+	[1799] = "Essity Hygiene and Health Aktiebolag",
+	[1800] = "Be Interactive Co., Ltd",
+	[1801] = "Carewear Corp.",
+	[1802] = "Huf Hülsbeck & Fürst GmbH & Co. KG",
+	[1803] = "Element Products, Inc.",
+	[1804] = "Beijing Winner Microelectronics Co.,Ltd",
+	[1805] = "SmartSnugg Pty Ltd",
+	[1806] = "FiveCo Sarl",
+	[1807] = "California Things Inc.",
+	[1808] = "Audiodo AB",
+	[1809] = "ABAX AS",
+	[1810] = "Bull Group Company Limited",
+	[1811] = "Respiri Limited",
+	[1812] = "MindPeace Safety LLC",
+	[1813] = "Vgyan Solutions",
+	[1814] = "Altonics",
+	[1815] = "iQsquare BV",
+	[1816] = "IDIBAIX enginneering",
+	[1817] = "ECSG",
+	[1818] = "REVSMART WEARABLE HK CO LTD",
+	[1819] = "Precor",
+	[1820] = "F5 Sports, Inc",
+	[1821] = "exoTIC Systems",
+	[1822] = "DONGGUAN HELE ELECTRONICS CO., LTD",
+	[1823] = "Dongguan Liesheng Electronic Co.Ltd",
+	[1824] = "Oculeve, Inc.",
+	[1825] = "Clover Network, Inc.",
+	[1826] = "Xiamen Eholder Electronics Co.Ltd",
+	[1827] = "Ford Motor Company",
+	[1828] = "Guangzhou SuperSound Information Technology Co.,Ltd",
+	[1829] = "Tedee Sp. z o.o.",
+	[1830] = "PHC Corporation",
+	[1831] = "STALKIT AS",
+	[1832] = "Eli Lilly and Company",
+	[1833] = "SwaraLink Technologies",
+	[1834] = "JMR embedded systems GmbH",
+	[1835] = "Bitkey Inc.",
+	[1836] = "GWA Hygiene GmbH",
+	[1837] = "Safera Oy",
+	[1838] = "Open Platform Systems LLC",
+	[1839] = "OnePlus Electronics (Shenzhen) Co., Ltd.",
+	[1840] = "Wildlife Acoustics, Inc.",
+	[1841] = "ABLIC Inc.",
+	[1842] = "Dairy Tech, Inc.",
+	[1843] = "Iguanavation, Inc.",
+	[1844] = "DiUS Computing Pty Ltd",
+	[1845] = "UpRight Technologies LTD",
+	[1846] = "FrancisFund, LLC",
+	[1847] = "LLC Navitek",
+	[1848] = "Glass Security Pte Ltd",
+	[1849] = "Jiangsu Qinheng Co., Ltd.",
+	[1850] = "Chandler Systems Inc.",
+	[1851] = "Fantini Cosmi s.p.a.",
+	[1852] = "Acubit ApS",
+	[1853] = "Beijing Hao Heng Tian Tech Co., Ltd.",
+	[1854] = "Bluepack S.R.L.",
+	[1855] = "Beijing Unisoc Technologies Co., Ltd.",
+	[1856] = "HITIQ LIMITED",
+	[1857] = "MAC SRL",
+	[1858] = "DML LLC",
+	[1859] = "Sanofi",
+	[1860] = "SOCOMEC",
+	[1861] = "WIZNOVA, Inc.",
+	[1862] = "Seitec Elektronik GmbH",
+	[1863] = "OR Technologies Pty Ltd",
+	[1864] = "GuangZhou KuGou Computer Technology Co.Ltd",
+	[1865] = "DIAODIAO (Beijing) Technology Co., Ltd.",
+	[1866] = "Illusory Studios LLC",
+	[1867] = "Sarvavid Software Solutions LLP",
+	[1868] = "iopool s.a.",
+	[1869] = "Amtech Systems, LLC",
+	[1870] = "EAGLE DETECTION SA",
+	[1871] = "MEDIATECH S.R.L.",
+	[1872] = "Hamilton Professional Services of Canada Incorporated",
+	[1873] = "Changsha JEMO IC Design Co.,Ltd",
+	[1874] = "Elatec GmbH",
+	[1875] = "JLG Industries, Inc.",
+	[1876] = "Michael Parkin",
+	[1877] = "Brother Industries, Ltd",
+	[1878] = "Lumens For Less, Inc",
+	[1879] = "ELA Innovation",
+	[1880] = "umanSense AB",
+	[1881] = "Shanghai InGeek Cyber Security Co., Ltd.",
+	[1882] = "HARMAN CO.,LTD.",
+	[1883] = "Smart Sensor Devices AB",
+	[1884] = "Antitronics Inc.",
+	[1885] = "RHOMBUS SYSTEMS, INC.",
+	[1886] = "Katerra Inc.",
+	[1887] = "Remote Solution Co., LTD.",
+	[1888] = "Vimar SpA",
+	[1889] = "Mantis Tech LLC",
+	[1890] = "TerOpta Ltd",
+	[1891] = "PIKOLIN S.L.",
+	[1892] = "WWZN Information Technology Company Limited",
+	[1893] = "Voxx International",
+	[1894] = "ART AND PROGRAM, INC.",
+	[1895] = "NITTO DENKO ASIA TECHNICAL CENTRE PTE. LTD.",
+	[1896] = "Peloton Interactive Inc.",
+	[1897] = "Force Impact Technologies",
+	[1898] = "Dmac Mobile Developments, LLC",
+	[1899] = "Engineered Medical Technologies",
+	[1900] = "Noodle Technology inc",
+	[1901] = "Graesslin GmbH",
+	[1902] = "WuQi technologies, Inc.",
+	[1903] = "Successful Endeavours Pty Ltd",
+	[1904] = "InnoCon Medical ApS",
+	[1905] = "Corvex Connected Safety",
+	[1906] = "Thirdwayv Inc.",
+	[1907] = "Echoflex Solutions Inc.",
+	[1908] = "C-MAX Asia Limited",
+	[1909] = "4eBusiness GmbH",
+	[1910] = "Cyber Transport Control GmbH",
+	[1911] = "Cue",
+	[1912] = "KOAMTAC INC.",
+	[1913] = "Loopshore Oy",
+	[1914] = "Niruha Systems Private Limited",
+	[1915] = "AmaterZ, Inc.",
+	[1916] = "radius co., ltd.",
+	[1917] = "Sensority, s.r.o.",
+	[1918] = "Sparkage Inc.",
+	[1919] = "Glenview Software Corporation",
+	[1920] = "Finch Technologies Ltd.",
+	[1921] = "Qingping Technology (Beijing) Co., Ltd.",
+	[1922] = "DeviceDrive AS",
+	[1923] = "ESEMBER LIMITED LIABILITY COMPANY",
+	[1924] = "audifon GmbH & Co. KG",
+	[1925] = "O2 Micro, Inc.",
+	[1926] = "HLP Controls Pty Limited",
+	[1927] = "Pangaea Solution",
+	[1928] = "BubblyNet, LLC",
+	[1930] = "The Wildflower Foundation",
+	[1931] = "Optikam Tech Inc.",
+	[1932] = "MINIBREW HOLDING B.V",
+	[1933] = "Cybex GmbH",
+	[1934] = "FUJIMIC NIIGATA, INC.",
+	[1935] = "Hanna Instruments, Inc.",
+	[1936] = "KOMPAN A/S",
+	[1937] = "Scosche Industries, Inc.",
+	[1938] = "Provo Craft",
+	[1939] = "AEV spol. s r.o.",
+	[1940] = "The Coca-Cola Company",
+	[1941] = "GASTEC CORPORATION",
+	[1942] = "StarLeaf Ltd",
+	[1943] = "Water-i.d. GmbH",
+	[1944] = "HoloKit, Inc.",
+	[1945] = "PlantChoir Inc.",
+	[1946] = "GuangDong Oppo Mobile Telecommunications Corp., Ltd.",
+	[1947] = "CST ELECTRONICS (PROPRIETARY) LIMITED",
+	[1948] = "Sky UK Limited",
+	[1949] = "Digibale Pty Ltd",
+	[1950] = "Smartloxx GmbH",
+	[1951] = "Pune Scientific LLP",
+	[1952] = "Regent Beleuchtungskorper AG",
+	[1953] = "Apollo Neuroscience, Inc.",
+	[1954] = "Roku, Inc.",
+	[1955] = "Comcast Cable",
+	[1956] = "Xiamen Mage Information Technology Co., Ltd.",
+	[1957] = "RAB Lighting, Inc.",
+	[1958] = "Musen Connect, Inc.",
+	[1959] = "Zume, Inc.",
+	[1960] = "conbee GmbH",
+	[1961] = "Bruel & Kjaer Sound & Vibration",
+	[1962] = "The Kroger Co.",
+	[1963] = "Granite River Solutions, Inc.",
+	[1964] = "LoupeDeck Oy",
+	[1965] = "New H3C Technologies Co.,Ltd",
+	[1966] = "Aurea Solucoes Tecnologicas Ltda.",
+	[1967] = "Hong Kong Bouffalo Lab Limited",
+	[1968] = "GV Concepts Inc.",
+	[1969] = "Thomas Dynamics, LLC",
+	[1970] = "Moeco IOT Inc.",
+	[1971] = "2N TELEKOMUNIKACE a.s.",
+	[1972] = "Hormann KG Antriebstechnik",
+	[1973] = "CRONO CHIP, S.L.",
+	[1974] = "Soundbrenner Limited",
+	[1975] = "ETABLISSEMENTS GEORGES RENAULT",
+	[1976] = "iSwip",
+	[1977] = "Epona Biotec Limited",
+	[1978] = "Battery-Biz Inc.",
+	[1979] = "EPIC S.R.L.",
+	[1980] = "KD CIRCUITS LLC",
+	[1981] = "Genedrive Diagnostics Ltd",
+	[1982] = "Axentia Technologies AB",
+	[1983] = "REGULA Ltd.",
+	[1984] = "Biral AG",
+	[1985] = "A.W. Chesterton Company",
+	[1986] = "Radinn AB",
+	[1987] = "CIMTechniques, Inc.",
+	[1988] = "Johnson Health Tech NA",
+	[1989] = "June Life, Inc.",
+	[1990] = "Bluenetics GmbH",
+	[1991] = "iaconicDesign Inc.",
+	[1992] = "WRLDS Creations AB",
+	[1993] = "Skullcandy, Inc.",
+	[1994] = "Modul-System HH AB",
+	[1995] = "West Pharmaceutical Services, Inc.",
+	[1996] = "Barnacle Systems Inc.",
+	[1997] = "Smart Wave Technologies Canada Inc",
+	[1998] = "Shanghai Top-Chip Microelectronics Tech. Co., LTD",
+	[1999] = "NeoSensory, Inc.",
+	[2000] = "Hangzhou Tuya Information  Technology Co., Ltd",
+	[2001] = "Shanghai Panchip Microelectronics Co., Ltd",
+	[2002] = "React Accessibility Limited",
+	[2003] = "LIVNEX Co.,Ltd.",
+	[2004] = "Kano Computing Limited",
+	[2005] = "hoots classic GmbH",
+	[2006] = "ecobee Inc.",
+	[2007] = "Nanjing Qinheng Microelectronics Co., Ltd",
+	[2008] = "SOLUTIONS AMBRA INC.",
+	[2009] = "Micro-Design, Inc.",
+	[2010] = "STARLITE Co., Ltd.",
+	[2011] = "Remedee Labs",
+	[2012] = "ThingOS GmbH",
+	[2013] = "Linear Circuits",
+	[2014] = "Unlimited Engineering SL",
+	[2015] = "Snap-on Incorporated",
+	[2016] = "Edifier International Limited",
+	[2017] = "Lucie Labs",
+	[2018] = "Alfred Kaercher SE & Co. KG",
+	[2019] = "Audiowise Technology Inc.",
+	[2020] = "Geeksme S.L.",
+	[2021] = "Minut, Inc.",
+	[2022] = "Autogrow Systems Limited",
+	[2023] = "Komfort IQ, Inc.",
+	[2024] = "Packetcraft, Inc.",
+	[2025] = "Häfele GmbH & Co KG",
+	[2026] = "ShapeLog, Inc.",
+	[2027] = "NOVABASE S.R.L.",
+	[2028] = "Frecce LLC",
+	[2029] = "Joule IQ, INC.",
+	[2030] = "KidzTek LLC",
+	[2031] = "Aktiebolaget Sandvik Coromant",
+	[2032] = "e-moola.com Pty Ltd",
+	[2033] = "GSM Innovations Pty Ltd",
+	[2034] = "SERENE GROUP, INC",
+	[2035] = "DIGISINE ENERGYTECH CO. LTD.",
+	[2036] = "MEDIRLAB Orvosbiologiai Fejleszto Korlatolt Felelossegu Tarsasag",
+	[2037] = "Byton North America Corporation",
+	[2038] = "Shenzhen TonliScience and Technology Development Co.,Ltd",
+	[2039] = "Cesar Systems Ltd.",
+	[2040] = "quip NYC Inc.",
+	[2041] = "Direct Communication Solutions, Inc.",
+	[2042] = "Klipsch Group, Inc.",
+	[2043] = "Access Co., Ltd",
+	[2044] = "Renault SA",
+	[2045] = "JSK CO., LTD.",
+	[2046] = "BIROTA",
+	[2047] = "maxon motor ltd.",
+	[2048] = "Optek",
+	[2049] = "CRONUS ELECTRONICS LTD",
+	[2050] = "NantSound, Inc.",
+	[2051] = "Domintell s.a.",
+	[2052] = "Andon Health Co.,Ltd",
+	[2053] = "Urbanminded Ltd",
+	[2054] = "TYRI Sweden AB",
+	[2055] = "ECD Electronic Components GmbH Dresden",
+	[2056] = "SISTEMAS KERN, SOCIEDAD ANÓMINA",
+	[2057] = "Trulli Audio",
+	[2058] = "Altaneos",
+	[2059] = "Nanoleaf Canada Limited",
+	[2060] = "Ingy B.V.",
+	[2061] = "Azbil Co.",
+	[2062] = "TATTCOM LLC",
+	[2063] = "Paradox Engineering SA",
+	[2064] = "LECO Corporation",
+	[2065] = "Becker Antriebe GmbH",
+	[2066] = "Mstream Technologies., Inc.",
+	[2067] = "Flextronics International USA Inc.",
+	[2068] = "Ossur hf.",
+	[2069] = "SKC Inc",
+	[2070] = "SPICA SYSTEMS LLC",
+	[2071] = "Wangs Alliance Corporation",
+	[2072] = "tatwah SA",
+	[2073] = "Hunter Douglas Inc",
+	[2074] = "Shenzhen Conex",
+	[2075] = "DIM3",
+	[2076] = "Bobrick Washroom Equipment, Inc.",
+	[2077] = "Potrykus Holdings and Development LLC",
+	[2078] = "iNFORM Technology GmbH",
+	[2079] = "eSenseLab LTD",
+	[2080] = "Brilliant Home Technology, Inc.",
+	[2081] = "INOVA Geophysical, Inc.",
+	[2082] = "adafruit industries",
+	[2083] = "Nexite Ltd",
+	[2084] = "8Power Limited",
+	[2085] = "CME PTE. LTD.",
+	[2086] = "Hyundai Motor Company",
+	[2087] = "Kickmaker",
+	[2088] = "Shanghai Suisheng Information Technology Co., Ltd.",
+	[2089] = "HEXAGON",
+	[2090] = "Mitutoyo Corporation",
+	[2091] = "shenzhen fitcare electronics Co.,Ltd",
+	[2092] = "INGICS TECHNOLOGY CO., LTD.",
+	[2093] = "INCUS PERFORMANCE LTD.",
+	[2094] = "ABB S.p.A.",
+	[2095] = "Blippit AB",
+	[2096] = "Core Health and Fitness LLC",
+	[2097] = "Foxble, LLC",
+	[2098] = "Intermotive,Inc.",
+	[2099] = "Conneqtech B.V.",
+	[2100] = "RIKEN KEIKI CO., LTD.,",
+	[2101] = "Canopy Growth Corporation",
+	[2102] = "Bitwards Oy",
+	[2103] = "vivo Mobile Communication Co., Ltd.",
+	[2104] = "Etymotic Research, Inc.",
+	[2105] = "A puissance 3",
+	[2106] = "BPW Bergische Achsen Kommanditgesellschaft",
+	[2107] = "Piaggio Fast Forward",
+	[2108] = "BeerTech LTD",
+	[2109] = "Tokenize, Inc.",
+	[2110] = "Zorachka LTD",
+	[2111] = "D-Link Corp.",
+	[2112] = "Down Range Systems LLC",
+	[2113] = "General Luminaire (Shanghai) Co., Ltd.",
+	[2114] = "Tangshan HongJia electronic technology co., LTD.",
+	[2115] = "FRAGRANCE DELIVERY TECHNOLOGIES LTD",
+	[2116] = "Pepperl + Fuchs GmbH",
+	[2117] = "Dometic Corporation",
+	[2118] = "USound GmbH",
+	[2119] = "DNANUDGE LIMITED",
+	[2120] = "JUJU JOINTS CANADA CORP.",
+	[2121] = "Dopple Technologies B.V.",
+	[2122] = "ARCOM",
+	[2123] = "Biotechware SRL",
+	[2124] = "ORSO Inc.",
+	[2125] = "SafePort",
+	[2126] = "Carol Cole Company",
+	[2127] = "Embedded Fitness B.V.",
+	[2128] = "Yealink (Xiamen) Network Technology Co.,LTD",
+	[2129] = "Subeca, Inc.",
+	[2130] = "Cognosos, Inc.",
+	[2131] = "Pektron Group Limited",
+	[2132] = "Tap Sound System",
+	[2133] = "Helios Hockey, Inc.",
+	[2134] = "Canopy Growth Corporation",
+	[2135] = "Parsyl Inc",
+	[2136] = "SOUNDBOKS",
+	[2137] = "BlueUp",
+	[2138] = "DAKATECH",
+	[2139] = "RICOH ELECTRONIC DEVICES CO., LTD.",
+	[2140] = "ACOS CO.,LTD.",
+	[2141] = "Guilin Zhishen Information Technology Co.,Ltd.",
+	[2142] = "Krog Systems LLC",
+	[2143] = "COMPEGPS TEAM,SOCIEDAD LIMITADA",
+	[2144] = "Alflex Products B.V.",
+	[2145] = "SmartSensor Labs Ltd",
+	[2146] = "SmartDrive Inc.",
+	[2147] = "Yo-tronics Technology Co., Ltd.",
+	[2148] = "Rafaelmicro",
+	[2149] = "Emergency Lighting Products Limited",
+	[2150] = "LAONZ Co.,Ltd",
+	[2151] = "Western Digital Techologies, Inc.",
+	[2152] = "WIOsense GmbH & Co. KG",
+	[2153] = "EVVA Sicherheitstechnologie GmbH",
+	[2154] = "Odic Incorporated",
+	[2155] = "Pacific Track, LLC",
+	[2156] = "Revvo Technologies, Inc.",
+	[2157] = "Biometrika d.o.o.",
+	[2158] = "Vorwerk Elektrowerke GmbH & Co. KG",
+	[2159] = "Trackunit A/S",
+	[2160] = "Wyze Labs, Inc",
+	[2161] = "Dension Elektronikai Kft. (formerly: Dension Audio Systems Ltd.)",
+	[2162] = "11 Health & Technologies Limited",
+	[2163] = "Innophase Incorporated",
+	[2164] = "Treegreen Limited",
+	[2165] = "Berner International LLC",
+	[2166] = "SmartResQ ApS",
+	[2167] = "Tome, Inc.",
+	[2168] = "The Chamberlain Group, Inc.",
+	[2169] = "MIZUNO Corporation",
+	[2170] = "ZRF, LLC",
+	[2171] = "BYSTAMP",
+	[2172] = "Crosscan GmbH",
+	[2173] = "Konftel AB",
+	[2174] = "1bar.net Limited",
+	[2175] = "Phillips Connect Technologies LLC",
+	[2176] = "imagiLabs AB",
+	[2177] = "Optalert",
+	[2178] = "PSYONIC, Inc.",
+	[2179] = "Wintersteiger AG",
+	[2180] = "Controlid Industria, Comercio de Hardware e Servicos de Tecnologia Ltda",
+	[2181] = "LEVOLOR, INC.",
+	[2182] = "Xsens Technologies B.V.",
+	[2183] = "Hydro-Gear Limited Partnership",
+	[2184] = "EnPointe Fencing Pty Ltd",
+	[2185] = "XANTHIO",
+	[2186] = "sclak s.r.l.",
+	[2187] = "Tricorder Arraay Technologies LLC",
+	[2188] = "GB Solution co.,Ltd",
+	[2189] = "Soliton Systems K.K.",
+	[2190] = "GIGA-TMS INC",
+	[2191] = "Tait International Limited",
+	[2192] = "NICHIEI INTEC CO., LTD.",
+	[2193] = "SmartWireless GmbH & Co. KG",
+	[2194] = "Ingenieurbuero Birnfeld UG (haftungsbeschraenkt)",
+	[2195] = "Maytronics Ltd",
+	[2196] = "EPIFIT",
+	[2197] = "Gimer medical",
+	[2198] = "Nokian Renkaat Oyj",
+	[2199] = "Current Lighting Solutions LLC",
+	[2200] = "Sensibo, Inc.",
+	[2201] = "SFS unimarket AG",
+	[2202] = "Private limited company \"Teltonika\"",
+	[2203] = "Saucon Technologies",
+	[2204] = "Embedded Devices Co. Company",
+	[2205] = "J-J.A.D.E. Enterprise LLC",
+	[2206] = "i-SENS, inc.",
+	[2207] = "Witschi Electronic Ltd",
+	[2208] = "Aclara Technologies LLC",
+	[2209] = "EXEO TECH CORPORATION",
+	[2210] = "Epic Systems Co., Ltd.",
+	[2211] = "Hoffmann SE",
+	[2212] = "Realme Chongqing Mobile Telecommunications Corp., Ltd.",
+	[2213] = "UMEHEAL Ltd",
+	[2214] = "Intelligenceworks Inc.",
+	[2215] = "TGR 1.618 Limited",
+	[2216] = "Shanghai Kfcube Inc",
+	[2217] = "Fraunhofer IIS",
+	[2218] = "SZ DJI TECHNOLOGY CO.,LTD",
+	[2219] = "Coburn Technology, LLC",
+	[2220] = "Topre Corporation",
+	[2221] = "Kayamatics Limited",
+	[2222] = "Moticon ReGo AG",
+	[2223] = "Polidea Sp. z o.o.",
+	[2224] = "Trivedi Advanced Technologies LLC",
+	[2225] = "CORE|vision BV",
+	[2226] = "PF SCHWEISSTECHNOLOGIE GMBH",
+	[2227] = "IONIQ Skincare GmbH & Co. KG",
+	[2228] = "Sengled Co., Ltd.",
+	[2229] = "TransferFi",
+	[2230] = "Boehringer Ingelheim Vetmedica GmbH",
+	[2231] = "ABB Inc",
+	[2232] = "Check Technology Solutions LLC",
+	[2233] = "U-Shin Ltd.",
+	[2234] = "HYPER ICE, INC.",
+	[2235] = "Tokai-rika co.,ltd.",
+	[2236] = "Prevayl Limited",
+	[2237] = "bf1systems limited",
+	[2238] = "ubisys technologies GmbH",
+	[2239] = "SIRC Co., Ltd.",
+	[2240] = "Accent Advanced Systems SLU",
+	[2241] = "Rayden.Earth LTD",
+	[2242] = "Lindinvent AB",
+	[2243] = "CHIPOLO d.o.o.",
+	[2244] = "CellAssist, LLC",
+	[2245] = "J. Wagner GmbH",
+	[2246] = "Integra Optics Inc",
+	[2247] = "Monadnock Systems Ltd.",
+	[2248] = "Liteboxer Technologies Inc.",
+	[2249] = "Noventa AG",
+	[2250] = "Nubia Technology Co.,Ltd.",
+	[2251] = "JT INNOVATIONS LIMITED",
+	[2252] = "TGM TECHNOLOGY CO., LTD.",
+	[2253] = "ifly",
+	[2254] = "ZIMI CORPORATION",
+	[2255] = "betternotstealmybike UG (with limited liability)",
+	[2256] = "ESTOM Infotech Kft.",
+	[2257] = "Sensovium Inc.",
+	[2258] = "Virscient Limited",
+	[2259] = "Novel Bits, LLC",
+	[2260] = "ADATA Technology Co., LTD.",
+	[2261] = "KEYes",
+	[2262] = "Nome Oy",
+	[2263] = "Inovonics Corp",
+	[2264] = "WARES",
+	[2265] = "Pointr Labs Limited",
+	[2266] = "Miridia Technology Incorporated",
+	[2267] = "Tertium Technology",
+	[2268] = "SHENZHEN AUKEY E BUSINESS CO., LTD",
+	[2269] = "code-Q",
+	[2270] = "Tyco Electronics Corporation a TE Connectivity Ltd Company",
+	[2271] = "IRIS OHYAMA CO.,LTD.",
+	[2272] = "Philia Technology",
+	[2273] = "KOZO KEIKAKU ENGINEERING Inc.",
+	[2274] = "Shenzhen Simo Technology co. LTD",
+	[2275] = "Republic Wireless, Inc.",
+	[2276] = "Rashidov ltd",
+	[2277] = "Crowd Connected Ltd",
+	[2278] = "Eneso Tecnologia de Adaptacion S.L.",
+	[2279] = "Barrot Technology Limited",
+	[2280] = "Naonext",
+	[2281] = "Taiwan Intelligent Home Corp.",
+	[2282] = "COWBELL ENGINEERING CO.,LTD.",
+	[2283] = "Beijing Big Moment Technology Co., Ltd.",
+	[2284] = "Denso Corporation",
+	[2285] = "IMI Hydronic Engineering International SA",
+	[2286] = "ASKEY",
+	[2287] = "Cumulus Digital Systems, Inc",
+	[2288] = "Joovv, Inc.",
+	[2289] = "The L.S. Starrett Company",
+	[2290] = "Microoled",
+	[2291] = "PSP - Pauli Services & Products GmbH",
+	[2292] = "Kodimo Technologies Company Limited",
+	[2293] = "Tymtix Technologies Private Limited",
+	[2294] = "Dermal Photonics Corporation",
+	[2295] = "MTD Products Inc & Affiliates",
+	[2296] = "instagrid GmbH",
+	[2297] = "Spacelabs Medical Inc.",
+	[2298] = "Troo Corporation",
+	[2299] = "Darkglass Electronics Oy",
+	[2300] = "Hill-Rom",
+	[2301] = "BioIntelliSense, Inc.",
+	[2302] = "Ketronixs Sdn Bhd",
+	[2308] = "SUNCORPORATION",
+	[2309] = "Yandex Services AG",
+	[2310] = "Scope Logistical Solutions",
+	[2311] = "User Hello, LLC",
+	[2312] = "Pinpoint Innovations Limited",
+	[2313] = "70mai Co.,Ltd.",
+	[2314] = "Zhuhai Hoksi Technology CO.,LTD",
+	[2315] = "EMBR labs, INC",
+	[2316] = "Radiawave Technologies Co.,Ltd.",
+	[2317] = "IOT Invent GmbH",
+	[2318] = "OPTIMUSIOT TECH LLP",
+	[2319] = "VC Inc.",
+	[2320] = "ASR Microelectronics (Shanghai) Co., Ltd.",
+	[2321] = "Douglas Lighting Controls Inc.",
+	[2322] = "Nerbio Medical Software Platforms Inc",
+	[2323] = "Braveheart Wireless, Inc.",
+	[2324] = "INEO-SENSE",
+	[2325] = "Honda Motor Co., Ltd.",
+	[2326] = "Ambient Sensors LLC",
+	[2327] = "ASR Microelectronics(ShenZhen)Co., Ltd.",
+	[2328] = "Technosphere Labs Pvt. Ltd.",
+	[2329] = "NO SMD LIMITED",
+	[2330] = "Albertronic BV",
+	[2331] = "Luminostics, Inc.",
+	[2332] = "Oblamatik AG",
+	[2333] = "Innokind, Inc.",
+	[2334] = "Melbot Studios, Sociedad Limitada",
+	[2335] = "Myzee Technology",
+	[2336] = "Omnisense Limited",
+	[2337] = "KAHA PTE. LTD.",
+	[2338] = "Shanghai MXCHIP Information Technology Co., Ltd.",
+	[2339] = "JSB TECH PTE LTD",
+	[2340] = "Fundacion Tecnalia Research and Innovation",
+	[2341] = "Yukai Engineering Inc.",
+	[2342] = "Gooligum Technologies Pty Ltd",
+	[2343] = "ROOQ GmbH",
+	[2344] = "AiRISTA",
+	[2345] = "Qingdao Haier Technology Co., Ltd.",
+	[2346] = "Sappl Verwaltungs- und Betriebs GmbH",
+	[2347] = "TekHome",
+	[2348] = "PCI Private Limited",
+	[2349] = "Leggett & Platt, Incorporated",
+	[2350] = "PS GmbH",
+	[2351] = "C.O.B.O. SpA",
+	[2352] = "James Walker RotaBolt Limited",
+	[2353] = "BREATHINGS Co., Ltd.",
+	[2354] = "BarVision, LLC",
+	[2355] = "SRAM",
+	[2356] = "KiteSpring Inc.",
+	[2357] = "Reconnect, Inc.",
+	[2358] = "Elekon AG",
+	[2359] = "RealThingks GmbH",
+	[2360] = "Henway Technologies, LTD.",
+	[2361] = "ASTEM Co.,Ltd.",
+	[2362] = "LinkedSemi Microelectronics (Xiamen) Co., Ltd",
+	[2363] = "ENSESO LLC",
+	[2364] = "Xenoma Inc.",
+	[2365] = "Adolf Wuerth GmbH & Co KG",
+	[2366] = "Catalyft Labs, Inc.",
+	[2367] = "JEPICO Corporation",
+	[2368] = "Hero Workout GmbH",
+	[2369] = "Rivian Automotive, LLC",
+	[2370] = "TRANSSION HOLDINGS LIMITED",
+	[2371] = "Inovonics Corp.",
+	[2372] = "Agitron d.o.o.",
+	[2373] = "Globe (Jiangsu) Co., Ltd",
+	[2374] = "AMC International Alfa Metalcraft Corporation AG",
+	[2375] = "First Light Technologies Ltd.",
+	[2376] = "Wearable Link Limited",
+	[2377] = "Metronom Health Europe",
+	[2378] = "Zwift, Inc.",
+	[2379] = "Kindeva Drug Delivery L.P.",
+	[2380] = "GimmiSys GmbH",
+	[2381] = "tkLABS INC.",
+	[2382] = "PassiveBolt, Inc.",
+	[2383] = "Limited Liability Company \"Mikrotikls\"",
+	[2384] = "Capetech",
+	[2385] = "PPRS",
+	[2386] = "Apptricity Corporation",
+	[2387] = "LogiLube, LLC",
+	[2388] = "Julbo",
+	[2389] = "Breville Group",
+	[2390] = "Kerlink",
+	[2391] = "Ohsung Electronics",
+	[2392] = "ZTE Corporation",
+};
+
 const char *bt_compidtostr(int compid)
 {
-	switch (compid) {
-	case 0:
-		return "Ericsson Technology Licensing";
-	case 1:
-		return "Nokia Mobile Phones";
-	case 2:
-		return "Intel Corp.";
-	case 3:
-		return "IBM Corp.";
-	case 4:
-		return "Toshiba Corp.";
-	case 5:
-		return "3Com";
-	case 6:
-		return "Microsoft";
-	case 7:
-		return "Lucent";
-	case 8:
-		return "Motorola";
-	case 9:
-		return "Infineon Technologies AG";
-	case 10:
-		return "Cambridge Silicon Radio";
-	case 11:
-		return "Silicon Wave";
-	case 12:
-		return "Digianswer A/S";
-	case 13:
-		return "Texas Instruments Inc.";
-	case 14:
-		return "Parthus Technologies Inc.";
-	case 15:
-		return "Broadcom Corporation";
-	case 16:
-		return "Mitel Semiconductor";
-	case 17:
-		return "Widcomm, Inc.";
-	case 18:
-		return "Zeevo, Inc.";
-	case 19:
-		return "Atmel Corporation";
-	case 20:
-		return "Mitsubishi Electric Corporation";
-	case 21:
-		return "RTX Telecom A/S";
-	case 22:
-		return "KC Technology Inc.";
-	case 23:
-		return "Newlogic";
-	case 24:
-		return "Transilica, Inc.";
-	case 25:
-		return "Rohde & Schwarz GmbH & Co. KG";
-	case 26:
-		return "TTPCom Limited";
-	case 27:
-		return "Signia Technologies, Inc.";
-	case 28:
-		return "Conexant Systems Inc.";
-	case 29:
-		return "Qualcomm";
-	case 30:
-		return "Inventel";
-	case 31:
-		return "AVM Berlin";
-	case 32:
-		return "BandSpeed, Inc.";
-	case 33:
-		return "Mansella Ltd";
-	case 34:
-		return "NEC Corporation";
-	case 35:
-		return "WavePlus Technology Co., Ltd.";
-	case 36:
-		return "Alcatel";
-	case 37:
-		return "NXP Semiconductors (formerly Philips Semiconductors)";
-	case 38:
-		return "C Technologies";
-	case 39:
-		return "Open Interface";
-	case 40:
-		return "R F Micro Devices";
-	case 41:
-		return "Hitachi Ltd";
-	case 42:
-		return "Symbol Technologies, Inc.";
-	case 43:
-		return "Tenovis";
-	case 44:
-		return "Macronix International Co. Ltd.";
-	case 45:
-		return "GCT Semiconductor";
-	case 46:
-		return "Norwood Systems";
-	case 47:
-		return "MewTel Technology Inc.";
-	case 48:
-		return "ST Microelectronics";
-	case 49:
-		return "Synopsys, Inc.";
-	case 50:
-		return "Red-M (Communications) Ltd";
-	case 51:
-		return "Commil Ltd";
-	case 52:
-		return "Computer Access Technology Corporation (CATC)";
-	case 53:
-		return "Eclipse (HQ Espana) S.L.";
-	case 54:
-		return "Renesas Electronics Corporation";
-	case 55:
-		return "Mobilian Corporation";
-	case 56:
-		return "Syntronix Corporation";
-	case 57:
-		return "Integrated System Solution Corp.";
-	case 58:
-		return "Panasonic Corporation (formerly Matsushita Electric Industrial Co., Ltd.)";
-	case 59:
-		return "Gennum Corporation";
-	case 60:
-		return "BlackBerry Limited (formerly Research In Motion)";
-	case 61:
-		return "IPextreme, Inc.";
-	case 62:
-		return "Systems and Chips, Inc";
-	case 63:
-		return "Bluetooth SIG, Inc";
-	case 64:
-		return "Seiko Epson Corporation";
-	case 65:
-		return "Integrated Silicon Solution Taiwan, Inc.";
-	case 66:
-		return "CONWISE Technology Corporation Ltd";
-	case 67:
-		return "PARROT AUTOMOTIVE SAS";
-	case 68:
-		return "Socket Mobile";
-	case 69:
-		return "Atheros Communications, Inc.";
-	case 70:
-		return "MediaTek, Inc.";
-	case 71:
-		return "Bluegiga";
-	case 72:
-		return "Marvell Technology Group Ltd.";
-	case 73:
-		return "3DSP Corporation";
-	case 74:
-		return "Accel Semiconductor Ltd.";
-	case 75:
-		return "Continental Automotive Systems";
-	case 76:
-		return "Apple, Inc.";
-	case 77:
-		return "Staccato Communications, Inc.";
-	case 78:
-		return "Avago Technologies";
-	case 79:
-		return "APT Ltd.";
-	case 80:
-		return "SiRF Technology, Inc.";
-	case 81:
-		return "Tzero Technologies, Inc.";
-	case 82:
-		return "J&M Corporation";
-	case 83:
-		return "Free2move AB";
-	case 84:
-		return "3DiJoy Corporation";
-	case 85:
-		return "Plantronics, Inc.";
-	case 86:
-		return "Sony Ericsson Mobile Communications";
-	case 87:
-		return "Harman International Industries, Inc.";
-	case 88:
-		return "Vizio, Inc.";
-	case 89:
-		return "Nordic Semiconductor ASA";
-	case 90:
-		return "EM Microelectronic-Marin SA";
-	case 91:
-		return "Ralink Technology Corporation";
-	case 92:
-		return "Belkin International, Inc.";
-	case 93:
-		return "Realtek Semiconductor Corporation";
-	case 94:
-		return "Stonestreet One, LLC";
-	case 95:
-		return "Wicentric, Inc.";
-	case 96:
-		return "RivieraWaves S.A.S";
-	case 97:
-		return "RDA Microelectronics";
-	case 98:
-		return "Gibson Guitars";
-	case 99:
-		return "MiCommand Inc.";
-	case 100:
-		return "Band XI International, LLC";
-	case 101:
-		return "Hewlett-Packard Company";
-	case 102:
-		return "9Solutions Oy";
-	case 103:
-		return "GN Netcom A/S";
-	case 104:
-		return "General Motors";
-	case 105:
-		return "A&D Engineering, Inc.";
-	case 106:
-		return "MindTree Ltd.";
-	case 107:
-		return "Polar Electro OY";
-	case 108:
-		return "Beautiful Enterprise Co., Ltd.";
-	case 109:
-		return "BriarTek, Inc";
-	case 110:
-		return "Summit Data Communications, Inc.";
-	case 111:
-		return "Sound ID";
-	case 112:
-		return "Monster, LLC";
-	case 113:
-		return "connectBlue AB";
-	case 114:
-		return "ShangHai Super Smart Electronics Co. Ltd.";
-	case 115:
-		return "Group Sense Ltd.";
-	case 116:
-		return "Zomm, LLC";
-	case 117:
-		return "Samsung Electronics Co. Ltd.";
-	case 118:
-		return "Creative Technology Ltd.";
-	case 119:
-		return "Laird Technologies";
-	case 120:
-		return "Nike, Inc.";
-	case 121:
-		return "lesswire AG";
-	case 122:
-		return "MStar Semiconductor, Inc.";
-	case 123:
-		return "Hanlynn Technologies";
-	case 124:
-		return "A & R Cambridge";
-	case 125:
-		return "Seers Technology Co., Ltd.";
-	case 126:
-		return "Sports Tracking Technologies Ltd.";
-	case 127:
-		return "Autonet Mobile";
-	case 128:
-		return "DeLorme Publishing Company, Inc.";
-	case 129:
-		return "WuXi Vimicro";
-	case 130:
-		return "Sennheiser Communications A/S";
-	case 131:
-		return "TimeKeeping Systems, Inc.";
-	case 132:
-		return "Ludus Helsinki Ltd.";
-	case 133:
-		return "BlueRadios, Inc.";
-	case 134:
-		return "Equinux AG";
-	case 135:
-		return "Garmin International, Inc.";
-	case 136:
-		return "Ecotest";
-	case 137:
-		return "GN ReSound A/S";
-	case 138:
-		return "Jawbone";
-	case 139:
-		return "Topcon Positioning Systems, LLC";
-	case 140:
-		return "Gimbal Inc. (formerly Qualcomm Labs, Inc. and Qualcomm Retail Solutions, Inc.)";
-	case 141:
-		return "Zscan Software";
-	case 142:
-		return "Quintic Corp";
-	case 143:
-		return "Telit Wireless Solutions GmbH (formerly Stollmann E+V GmbH)";
-	case 144:
-		return "Funai Electric Co., Ltd.";
-	case 145:
-		return "Advanced PANMOBIL systems GmbH & Co. KG";
-	case 146:
-		return "ThinkOptics, Inc.";
-	case 147:
-		return "Universal Electronics, Inc.";
-	case 148:
-		return "Airoha Technology Corp.";
-	case 149:
-		return "NEC Lighting, Ltd.";
-	case 150:
-		return "ODM Technology, Inc.";
-	case 151:
-		return "ConnecteDevice Ltd.";
-	case 152:
-		return "zero1.tv GmbH";
-	case 153:
-		return "i.Tech Dynamic Global Distribution Ltd.";
-	case 154:
-		return "Alpwise";
-	case 155:
-		return "Jiangsu Toppower Automotive Electronics Co., Ltd.";
-	case 156:
-		return "Colorfy, Inc.";
-	case 157:
-		return "Geoforce Inc.";
-	case 158:
-		return "Bose Corporation";
-	case 159:
-		return "Suunto Oy";
-	case 160:
-		return "Kensington Computer Products Group";
-	case 161:
-		return "SR-Medizinelektronik";
-	case 162:
-		return "Vertu Corporation Limited";
-	case 163:
-		return "Meta Watch Ltd.";
-	case 164:
-		return "LINAK A/S";
-	case 165:
-		return "OTL Dynamics LLC";
-	case 166:
-		return "Panda Ocean Inc.";
-	case 167:
-		return "Visteon Corporation";
-	case 168:
-		return "ARP Devices Limited";
-	case 169:
-		return "MARELLI EUROPE S.P.A. (formerly Magneti Marelli S.p.A.)";
-	case 170:
-		return "CAEN RFID srl";
-	case 171:
-		return "Ingenieur-Systemgruppe Zahn GmbH";
-	case 172:
-		return "Green Throttle Games";
-	case 173:
-		return "Peter Systemtechnik GmbH";
-	case 174:
-		return "Omegawave Oy";
-	case 175:
-		return "Cinetix";
-	case 176:
-		return "Passif Semiconductor Corp";
-	case 177:
-		return "Saris Cycling Group, Inc";
-	case 178:
-		return "Bekey A/S";
-	case 179:
-		return "Clarinox Technologies Pty. Ltd.";
-	case 180:
-		return "BDE Technology Co., Ltd.";
-	case 181:
-		return "Swirl Networks";
-	case 182:
-		return "Meso international";
-	case 183:
-		return "TreLab Ltd";
-	case 184:
-		return "Qualcomm Innovation Center, Inc. (QuIC)";
-	case 185:
-		return "Johnson Controls, Inc.";
-	case 186:
-		return "Starkey Laboratories Inc.";
-	case 187:
-		return "S-Power Electronics Limited";
-	case 188:
-		return "Ace Sensor Inc";
-	case 189:
-		return "Aplix Corporation";
-	case 190:
-		return "AAMP of America";
-	case 191:
-		return "Stalmart Technology Limited";
-	case 192:
-		return "AMICCOM Electronics Corporation";
-	case 193:
-		return "Shenzhen Excelsecu Data Technology Co.,Ltd";
-	case 194:
-		return "Geneq Inc.";
-	case 195:
-		return "adidas AG";
-	case 196:
-		return "LG Electronics";
-	case 197:
-		return "Onset Computer Corporation";
-	case 198:
-		return "Selfly BV";
-	case 199:
-		return "Quuppa Oy.";
-	case 200:
-		return "GeLo Inc";
-	case 201:
-		return "Evluma";
-	case 202:
-		return "MC10";
-	case 203:
-		return "Binauric SE";
-	case 204:
-		return "Beats Electronics";
-	case 205:
-		return "Microchip Technology Inc.";
-	case 206:
-		return "Elgato Systems GmbH";
-	case 207:
-		return "ARCHOS SA";
-	case 208:
-		return "Dexcom, Inc.";
-	case 209:
-		return "Polar Electro Europe B.V.";
-	case 210:
-		return "Dialog Semiconductor B.V.";
-	case 211:
-		return "Taixingbang Technology (HK) Co,. LTD.";
-	case 212:
-		return "Kawantech";
-	case 213:
-		return "Austco Communication Systems";
-	case 214:
-		return "Timex Group USA, Inc.";
-	case 215:
-		return "Qualcomm Technologies, Inc.";
-	case 216:
-		return "Qualcomm Connected Experiences, Inc.";
-	case 217:
-		return "Voyetra Turtle Beach";
-	case 218:
-		return "txtr GmbH";
-	case 219:
-		return "Biosentronics";
-	case 220:
-		return "Procter & Gamble";
-	case 221:
-		return "Hosiden Corporation";
-	case 222:
-		return "Muzik LLC";
-	case 223:
-		return "Misfit Wearables Corp";
-	case 224:
-		return "Google";
-	case 225:
-		return "Danlers Ltd";
-	case 226:
-		return "Semilink Inc";
-	case 227:
-		return "inMusic Brands, Inc";
-	case 228:
-		return "L.S. Research Inc.";
-	case 229:
-		return "Eden Software Consultants Ltd.";
-	case 230:
-		return "Freshtemp";
-	case 231:
-		return "KS Technologies";
-	case 232:
-		return "ACTS Technologies";
-	case 233:
-		return "Vtrack Systems";
-	case 234:
-		return "Nielsen-Kellerman Company";
-	case 235:
-		return "Server Technology Inc.";
-	case 236:
-		return "BioResearch Associates";
-	case 237:
-		return "Jolly Logic, LLC";
-	case 238:
-		return "Above Average Outcomes, Inc.";
-	case 239:
-		return "Bitsplitters GmbH";
-	case 240:
-		return "PayPal, Inc.";
-	case 241:
-		return "Witron Technology Limited";
-	case 242:
-		return "Morse Project Inc.";
-	case 243:
-		return "Kent Displays Inc.";
-	case 244:
-		return "Nautilus Inc.";
-	case 245:
-		return "Smartifier Oy";
-	case 246:
-		return "Elcometer Limited";
-	case 247:
-		return "VSN Technologies, Inc.";
-	case 248:
-		return "AceUni Corp., Ltd.";
-	case 249:
-		return "StickNFind";
-	case 250:
-		return "Crystal Code AB";
-	case 251:
-		return "KOUKAAM a.s.";
-	case 252:
-		return "Delphi Corporation";
-	case 253:
-		return "ValenceTech Limited";
-	case 254:
-		return "Stanley Black and Decker";
-	case 255:
-		return "Typo Products, LLC";
-	case 256:
-		return "TomTom International BV";
-	case 257:
-		return "Fugoo, Inc.";
-	case 258:
-		return "Keiser Corporation";
-	case 259:
-		return "Bang & Olufsen A/S";
-	case 260:
-		return "PLUS Location Systems Pty Ltd";
-	case 261:
-		return "Ubiquitous Computing Technology Corporation";
-	case 262:
-		return "Innovative Yachtter Solutions";
-	case 263:
-		return "William Demant Holding A/S";
-	case 264:
-		return "Chicony Electronics Co., Ltd.";
-	case 265:
-		return "Atus BV";
-	case 266:
-		return "Codegate Ltd";
-	case 267:
-		return "ERi, Inc";
-	case 268:
-		return "Transducers Direct, LLC";
-	case 269:
-		return "DENSO TEN LIMITED (formerly Fujitsu Ten LImited)";
-	case 270:
-		return "Audi AG";
-	case 271:
-		return "HiSilicon Technologies CO., LIMITED";
-	case 272:
-		return "Nippon Seiki Co., Ltd.";
-	case 273:
-		return "Steelseries ApS";
-	case 274:
-		return "Visybl Inc.";
-	case 275:
-		return "Openbrain Technologies, Co., Ltd.";
-	case 276:
-		return "Xensr";
-	case 277:
-		return "e.solutions";
-	case 278:
-		return "10AK Technologies";
-	case 279:
-		return "Wimoto Technologies Inc";
-	case 280:
-		return "Radius Networks, Inc.";
-	case 281:
-		return "Wize Technology Co., Ltd.";
-	case 282:
-		return "Qualcomm Labs, Inc.";
-	case 283:
-		return "Aruba Networks";
-	case 284:
-		return "Baidu";
-	case 285:
-		return "Arendi AG";
-	case 286:
-		return "Skoda Auto a.s.";
-	case 287:
-		return "Volkswagen AG";
-	case 288:
-		return "Porsche AG";
-	case 289:
-		return "Sino Wealth Electronic Ltd.";
-	case 290:
-		return "AirTurn, Inc.";
-	case 291:
-		return "Kinsa, Inc";
-	case 292:
-		return "HID Global";
-	case 293:
-		return "SEAT es";
-	case 294:
-		return "Promethean Ltd.";
-	case 295:
-		return "Salutica Allied Solutions";
-	case 296:
-		return "GPSI Group Pty Ltd";
-	case 297:
-		return "Nimble Devices Oy";
-	case 298:
-		return "Changzhou Yongse Infotech  Co., Ltd.";
-	case 299:
-		return "SportIQ";
-	case 300:
-		return "TEMEC Instruments B.V.";
-	case 301:
-		return "Sony Corporation";
-	case 302:
-		return "ASSA ABLOY";
-	case 303:
-		return "Clarion Co. Inc.";
-	case 304:
-		return "Warehouse Innovations";
-	case 305:
-		return "Cypress Semiconductor";
-	case 306:
-		return "MADS Inc";
-	case 307:
-		return "Blue Maestro Limited";
-	case 308:
-		return "Resolution Products, Ltd.";
-	case 309:
-		return "Aireware LLC";
-	case 310:
-		return "Silvair, Inc.";
-	case 311:
-		return "Prestigio Plaza Ltd.";
-	case 312:
-		return "NTEO Inc.";
-	case 313:
-		return "Focus Systems Corporation";
-	case 314:
-		return "Tencent Holdings Ltd.";
-	case 315:
-		return "Allegion";
-	case 316:
-		return "Murata Manufacturing Co., Ltd.";
-	case 317:
-		return "WirelessWERX";
-	case 318:
-		return "Nod, Inc.";
-	case 319:
-		return "B&B Manufacturing Company";
-	case 320:
-		return "Alpine Electronics (China) Co., Ltd";
-	case 321:
-		return "FedEx Services";
-	case 322:
-		return "Grape Systems Inc.";
-	case 323:
-		return "Bkon Connect";
-	case 324:
-		return "Lintech GmbH";
-	case 325:
-		return "Novatel Wireless";
-	case 326:
-		return "Ciright";
-	case 327:
-		return "Mighty Cast, Inc.";
-	case 328:
-		return "Ambimat Electronics";
-	case 329:
-		return "Perytons Ltd.";
-	case 330:
-		return "Tivoli Audio, LLC";
-	case 331:
-		return "Master Lock";
-	case 332:
-		return "Mesh-Net Ltd";
-	case 333:
-		return "HUIZHOU DESAY SV AUTOMOTIVE CO., LTD.";
-	case 334:
-		return "Tangerine, Inc.";
-	case 335:
-		return "B&W Group Ltd.";
-	case 336:
-		return "Pioneer Corporation";
-	case 337:
-		return "OnBeep";
-	case 338:
-		return "Vernier Software & Technology";
-	case 339:
-		return "ROL Ergo";
-	case 340:
-		return "Pebble Technology";
-	case 341:
-		return "NETATMO";
-	case 342:
-		return "Accumulate AB";
-	case 343:
-		return "Anhui Huami Information Technology Co., Ltd.";
-	case 344:
-		return "Inmite s.r.o.";
-	case 345:
-		return "ChefSteps, Inc.";
-	case 346:
-		return "micas AG";
-	case 347:
-		return "Biomedical Research Ltd.";
-	case 348:
-		return "Pitius Tec S.L.";
-	case 349:
-		return "Estimote, Inc.";
-	case 350:
-		return "Unikey Technologies, Inc.";
-	case 351:
-		return "Timer Cap Co.";
-	case 352:
-		return "AwoX";
-	case 353:
-		return "yikes";
-	case 354:
-		return "MADSGlobalNZ Ltd.";
-	case 355:
-		return "PCH International";
-	case 356:
-		return "Qingdao Yeelink Information Technology Co., Ltd.";
-	case 357:
-		return "Milwaukee Tool (Formally Milwaukee Electric Tools)";
-	case 358:
-		return "MISHIK Pte Ltd";
-	case 359:
-		return "Ascensia Diabetes Care US Inc.";
-	case 360:
-		return "Spicebox LLC";
-	case 361:
-		return "emberlight";
-	case 362:
-		return "Cooper-Atkins Corporation";
-	case 363:
-		return "Qblinks";
-	case 364:
-		return "MYSPHERA";
-	case 365:
-		return "LifeScan Inc";
-	case 366:
-		return "Volantic AB";
-	case 367:
-		return "Podo Labs, Inc";
-	case 368:
-		return "Roche Diabetes Care AG";
-	case 369:
-		return "Amazon.com Services, LLC (formerly Amazon Fulfillment Service)";
-	case 370:
-		return "Connovate Technology Private Limited";
-	case 371:
-		return "Kocomojo, LLC";
-	case 372:
-		return "Everykey Inc.";
-	case 373:
-		return "Dynamic Controls";
-	case 374:
-		return "SentriLock";
-	case 375:
-		return "I-SYST inc.";
-	case 376:
-		return "CASIO COMPUTER CO., LTD.";
-	case 377:
-		return "LAPIS Semiconductor Co., Ltd.";
-	case 378:
-		return "Telemonitor, Inc.";
-	case 379:
-		return "taskit GmbH";
-	case 380:
-		return "Daimler AG";
-	case 381:
-		return "BatAndCat";
-	case 382:
-		return "BluDotz Ltd";
-	case 383:
-		return "XTel Wireless ApS";
-	case 384:
-		return "Gigaset Communications GmbH";
-	case 385:
-		return "Gecko Health Innovations, Inc.";
-	case 386:
-		return "HOP Ubiquitous";
-	case 387:
-		return "Walt Disney";
-	case 388:
-		return "Nectar";
-	case 389:
-		return "bel'apps LLC";
-	case 390:
-		return "CORE Lighting Ltd";
-	case 391:
-		return "Seraphim Sense Ltd";
-	case 392:
-		return "Unico RBC";
-	case 393:
-		return "Physical Enterprises Inc.";
-	case 394:
-		return "Able Trend Technology Limited";
-	case 395:
-		return "Konica Minolta, Inc.";
-	case 396:
-		return "Wilo SE";
-	case 397:
-		return "Extron Design Services";
-	case 398:
-		return "Fitbit, Inc.";
-	case 399:
-		return "Fireflies Systems";
-	case 400:
-		return "Intelletto Technologies Inc.";
-	case 401:
-		return "FDK CORPORATION";
-	case 402:
-		return "Cloudleaf, Inc";
-	case 403:
-		return "Maveric Automation LLC";
-	case 404:
-		return "Acoustic Stream Corporation";
-	case 405:
-		return "Zuli";
-	case 406:
-		return "Paxton Access Ltd";
-	case 407:
-		return "WiSilica Inc.";
-	case 408:
-		return "VENGIT Korlatolt Felelossegu Tarsasag";
-	case 409:
-		return "SALTO SYSTEMS S.L.";
-	case 410:
-		return "TRON Forum (formerly T-Engine Forum)";
-	case 411:
-		return "CUBETECH s.r.o.";
-	case 412:
-		return "Cokiya Incorporated";
-	case 413:
-		return "CVS Health";
-	case 414:
-		return "Ceruus";
-	case 415:
-		return "Strainstall Ltd";
-	case 416:
-		return "Channel Enterprises (HK) Ltd.";
-	case 417:
-		return "FIAMM";
-	case 418:
-		return "GIGALANE.CO.,LTD";
-	case 419:
-		return "EROAD";
-	case 420:
-		return "Mine Safety Appliances";
-	case 421:
-		return "Icon Health and Fitness";
-	case 422:
-		return "Wille Engineering (formely as Asandoo GmbH)";
-	case 423:
-		return "ENERGOUS CORPORATION";
-	case 424:
-		return "Taobao";
-	case 425:
-		return "Canon Inc.";
-	case 426:
-		return "Geophysical Technology Inc.";
-	case 427:
-		return "Facebook, Inc.";
-	case 428:
-		return "Trividia Health, Inc.";
-	case 429:
-		return "FlightSafety International";
-	case 430:
-		return "Earlens Corporation";
-	case 431:
-		return "Sunrise Micro Devices, Inc.";
-	case 432:
-		return "Star Micronics Co., Ltd.";
-	case 433:
-		return "Netizens Sp. z o.o.";
-	case 434:
-		return "Nymi Inc.";
-	case 435:
-		return "Nytec, Inc.";
-	case 436:
-		return "Trineo Sp. z o.o.";
-	case 437:
-		return "Nest Labs Inc.";
-	case 438:
-		return "LM Technologies Ltd";
-	case 439:
-		return "General Electric Company";
-	case 440:
-		return "i+D3 S.L.";
-	case 441:
-		return "HANA Micron";
-	case 442:
-		return "Stages Cycling LLC";
-	case 443:
-		return "Cochlear Bone Anchored Solutions AB";
-	case 444:
-		return "SenionLab AB";
-	case 445:
-		return "Syszone Co., Ltd";
-	case 446:
-		return "Pulsate Mobile Ltd.";
-	case 447:
-		return "Hong Kong HunterSun Electronic Limited";
-	case 448:
-		return "pironex GmbH";
-	case 449:
-		return "BRADATECH Corp.";
-	case 450:
-		return "Transenergooil AG";
-	case 451:
-		return "Bunch";
-	case 452:
-		return "DME Microelectronics";
-	case 453:
-		return "Bitcraze AB";
-	case 454:
-		return "HASWARE Inc.";
-	case 455:
-		return "Abiogenix Inc.";
-	case 456:
-		return "Poly-Control ApS";
-	case 457:
-		return "Avi-on";
-	case 458:
-		return "Laerdal Medical AS";
-	case 459:
-		return "Fetch My Pet";
-	case 460:
-		return "Sam Labs Ltd.";
-	case 461:
-		return "Chengdu Synwing Technology Ltd";
-	case 462:
-		return "HOUWA SYSTEM DESIGN, k.k.";
-	case 463:
-		return "BSH";
-	case 464:
-		return "Primus Inter Pares Ltd";
-	case 465:
-		return "August Home, Inc";
-	case 466:
-		return "Gill Electronics";
-	case 467:
-		return "Sky Wave Design";
-	case 468:
-		return "Newlab S.r.l.";
-	case 469:
-		return "ELAD srl";
-	case 470:
-		return "G-wearables inc.";
-	case 471:
-		return "Squadrone Systems Inc.";
-	case 472:
-		return "Code Corporation";
-	case 473:
-		return "Savant Systems LLC";
-	case 474:
-		return "Logitech International SA";
-	case 475:
-		return "Innblue Consulting";
-	case 476:
-		return "iParking Ltd.";
-	case 477:
-		return "Koninklijke Philips Electronics N.V.";
-	case 478:
-		return "Minelab Electronics Pty Limited";
-	case 479:
-		return "Bison Group Ltd.";
-	case 480:
-		return "Widex A/S";
-	case 481:
-		return "Jolla Ltd";
-	case 482:
-		return "Lectronix, Inc.";
-	case 483:
-		return "Caterpillar Inc";
-	case 484:
-		return "Freedom Innovations";
-	case 485:
-		return "Dynamic Devices Ltd";
-	case 486:
-		return "Technology Solutions (UK) Ltd";
-	case 487:
-		return "IPS Group Inc.";
-	case 488:
-		return "STIR";
-	case 489:
-		return "Sano, Inc.";
-	case 490:
-		return "Advanced Application Design, Inc.";
-	case 491:
-		return "AutoMap LLC";
-	case 492:
-		return "Spreadtrum Communications Shanghai Ltd";
-	case 493:
-		return "CuteCircuit LTD";
-	case 494:
-		return "Valeo Service";
-	case 495:
-		return "Fullpower Technologies, Inc.";
-	case 496:
-		return "KloudNation";
-	case 497:
-		return "Zebra Technologies Corporation";
-	case 498:
-		return "Itron, Inc.";
-	case 499:
-		return "The University of Tokyo";
-	case 500:
-		return "UTC Fire and Security";
-	case 501:
-		return "Cool Webthings Limited";
-	case 502:
-		return "DJO Global";
-	case 503:
-		return "Gelliner Limited";
-	case 504:
-		return "Anyka (Guangzhou) Microelectronics Technology Co, LTD";
-	case 505:
-		return "Medtronic Inc.";
-	case 506:
-		return "Gozio Inc.";
-	case 507:
-		return "Form Lifting, LLC";
-	case 508:
-		return "Wahoo Fitness, LLC";
-	case 509:
-		return "Kontakt Micro-Location Sp. z o.o.";
-	case 510:
-		return "Radio Systems Corporation";
-	case 511:
-		return "Freescale Semiconductor, Inc.";
-	case 512:
-		return "Verifone Systems Pte Ltd. Taiwan Branch";
-	case 513:
-		return "AR Timing";
-	case 514:
-		return "Rigado LLC";
-	case 515:
-		return "Kemppi Oy";
-	case 516:
-		return "Tapcentive Inc.";
-	case 517:
-		return "Smartbotics Inc.";
-	case 518:
-		return "Otter Products, LLC";
-	case 519:
-		return "STEMP Inc.";
-	case 520:
-		return "LumiGeek LLC";
-	case 521:
-		return "InvisionHeart Inc.";
-	case 522:
-		return "Macnica Inc.";
-	case 523:
-		return "Jaguar Land Rover Limited";
-	case 524:
-		return "CoroWare Technologies, Inc";
-	case 525:
-		return "Simplo Technology Co., LTD";
-	case 526:
-		return "Omron Healthcare Co., LTD";
-	case 527:
-		return "Comodule GMBH";
-	case 528:
-		return "ikeGPS";
-	case 529:
-		return "Telink Semiconductor Co. Ltd";
-	case 530:
-		return "Interplan Co., Ltd";
-	case 531:
-		return "Wyler AG";
-	case 532:
-		return "IK Multimedia Production srl";
-	case 533:
-		return "Lukoton Experience Oy";
-	case 534:
-		return "MTI Ltd";
-	case 535:
-		return "Tech4home, Lda";
-	case 536:
-		return "Hiotech AB";
-	case 537:
-		return "DOTT Limited";
-	case 538:
-		return "Blue Speck Labs, LLC";
-	case 539:
-		return "Cisco Systems, Inc";
-	case 540:
-		return "Mobicomm Inc";
-	case 541:
-		return "Edamic";
-	case 542:
-		return "Goodnet, Ltd";
-	case 543:
-		return "Luster Leaf Products  Inc";
-	case 544:
-		return "Manus Machina BV";
-	case 545:
-		return "Mobiquity Networks Inc";
-	case 546:
-		return "Praxis Dynamics";
-	case 547:
-		return "Philip Morris Products S.A.";
-	case 548:
-		return "Comarch SA";
-	case 549:
-		return "Nestlé Nespresso S.A.";
-	case 550:
-		return "Merlinia A/S";
-	case 551:
-		return "LifeBEAM Technologies";
-	case 552:
-		return "Twocanoes Labs, LLC";
-	case 553:
-		return "Muoverti Limited";
-	case 554:
-		return "Stamer Musikanlagen GMBH";
-	case 555:
-		return "Tesla Motors";
-	case 556:
-		return "Pharynks Corporation";
-	case 557:
-		return "Lupine";
-	case 558:
-		return "Siemens AG";
-	case 559:
-		return "Huami (Shanghai) Culture Communication CO., LTD";
-	case 560:
-		return "Foster Electric Company, Ltd";
-	case 561:
-		return "ETA SA";
-	case 562:
-		return "x-Senso Solutions Kft";
-	case 563:
-		return "Shenzhen SuLong Communication Ltd";
-	case 564:
-		return "FengFan (BeiJing) Technology Co, Ltd";
-	case 565:
-		return "Qrio Inc";
-	case 566:
-		return "Pitpatpet Ltd";
-	case 567:
-		return "MSHeli s.r.l.";
-	case 568:
-		return "Trakm8 Ltd";
-	case 569:
-		return "JIN CO, Ltd";
-	case 570:
-		return "Alatech Tehnology";
-	case 571:
-		return "Beijing CarePulse Electronic Technology Co, Ltd";
-	case 572:
-		return "Awarepoint";
-	case 573:
-		return "ViCentra B.V.";
-	case 574:
-		return "Raven Industries";
-	case 575:
-		return "WaveWare Technologies Inc.";
-	case 576:
-		return "Argenox Technologies";
-	case 577:
-		return "Bragi GmbH";
-	case 578:
-		return "16Lab Inc";
-	case 579:
-		return "Masimo Corp";
-	case 580:
-		return "Iotera Inc";
-	case 581:
-		return "Endress+Hauser ";
-	case 582:
-		return "ACKme Networks, Inc.";
-	case 583:
-		return "FiftyThree Inc.";
-	case 584:
-		return "Parker Hannifin Corp";
-	case 585:
-		return "Transcranial Ltd";
-	case 586:
-		return "Uwatec AG";
-	case 587:
-		return "Orlan LLC";
-	case 588:
-		return "Blue Clover Devices";
-	case 589:
-		return "M-Way Solutions GmbH";
-	case 590:
-		return "Microtronics Engineering GmbH";
-	case 591:
-		return "Schneider Schreibgeräte GmbH";
-	case 592:
-		return "Sapphire Circuits LLC";
-	case 593:
-		return "Lumo Bodytech Inc.";
-	case 594:
-		return "UKC Technosolution";
-	case 595:
-		return "Xicato Inc.";
-	case 596:
-		return "Playbrush";
-	case 597:
-		return "Dai Nippon Printing Co., Ltd.";
-	case 598:
-		return "G24 Power Limited";
-	case 599:
-		return "AdBabble Local Commerce Inc.";
-	case 600:
-		return "Devialet SA";
-	case 601:
-		return "ALTYOR";
-	case 602:
-		return "University of Applied Sciences Valais/Haute Ecole Valaisanne";
-	case 603:
-		return "Five Interactive, LLC dba Zendo";
-	case 604:
-		return "NetEase（Hangzhou）Network co.Ltd.";
-	case 605:
-		return "Lexmark International Inc.";
-	case 606:
-		return "Fluke Corporation";
-	case 607:
-		return "Yardarm Technologies";
-	case 608:
-		return "SensaRx";
-	case 609:
-		return "SECVRE GmbH";
-	case 610:
-		return "Glacial Ridge Technologies";
-	case 611:
-		return "Identiv, Inc.";
-	case 612:
-		return "DDS, Inc.";
-	case 613:
-		return "SMK Corporation";
-	case 614:
-		return "Schawbel Technologies LLC";
-	case 615:
-		return "XMI Systems SA";
-	case 616:
-		return "Cerevo";
-	case 617:
-		return "Torrox GmbH & Co KG";
-	case 618:
-		return "Gemalto";
-	case 619:
-		return "DEKA Research & Development Corp.";
-	case 620:
-		return "Domster Tadeusz Szydlowski";
-	case 621:
-		return "Technogym SPA";
-	case 622:
-		return "FLEURBAEY BVBA";
-	case 623:
-		return "Aptcode Solutions";
-	case 624:
-		return "LSI ADL Technology";
-	case 625:
-		return "Animas Corp";
-	case 626:
-		return "Alps Electric Co., Ltd.";
-	case 627:
-		return "OCEASOFT";
-	case 628:
-		return "Motsai Research";
-	case 629:
-		return "Geotab";
-	case 630:
-		return "E.G.O. Elektro-Geraetebau GmbH";
-	case 631:
-		return "bewhere inc";
-	case 632:
-		return "Johnson Outdoors Inc";
-	case 633:
-		return "steute Schaltgerate GmbH & Co. KG";
-	case 634:
-		return "Ekomini inc.";
-	case 635:
-		return "DEFA AS";
-	case 636:
-		return "Aseptika Ltd";
-	case 637:
-		return "HUAWEI Technologies Co., Ltd.";
-	case 638:
-		return "HabitAware, LLC";
-	case 639:
-		return "ruwido austria gmbh";
-	case 640:
-		return "ITEC corporation";
-	case 641:
-		return "StoneL";
-	case 642:
-		return "Sonova AG";
-	case 643:
-		return "Maven Machines, Inc.";
-	case 644:
-		return "Synapse Electronics";
-	case 645:
-		return "Standard Innovation Inc.";
-	case 646:
-		return "RF Code, Inc.";
-	case 647:
-		return "Wally Ventures S.L.";
-	case 648:
-		return "Willowbank Electronics Ltd";
-	case 649:
-		return "SK Telecom";
-	case 650:
-		return "Jetro AS";
-	case 651:
-		return "Code Gears LTD";
-	case 652:
-		return "NANOLINK APS";
-	case 653:
-		return "IF, LLC";
-	case 654:
-		return "RF Digital Corp";
-	case 655:
-		return "Church & Dwight Co., Inc";
-	case 656:
-		return "Multibit Oy";
-	case 657:
-		return "CliniCloud Inc";
-	case 658:
-		return "SwiftSensors";
-	case 659:
-		return "Blue Bite";
-	case 660:
-		return "ELIAS GmbH";
-	case 661:
-		return "Sivantos GmbH";
-	case 662:
-		return "Petzl";
-	case 663:
-		return "storm power ltd";
-	case 664:
-		return "EISST Ltd";
-	case 665:
-		return "Inexess Technology Simma KG";
-	case 666:
-		return "Currant, Inc.";
-	case 667:
-		return "C2 Development, Inc.";
-	case 668:
-		return "Blue Sky Scientific, LLC";
-	case 669:
-		return "ALOTTAZS LABS, LLC";
-	case 670:
-		return "Kupson spol. s r.o.";
-	case 671:
-		return "Areus Engineering GmbH";
-	case 672:
-		return "Impossible Camera GmbH";
-	case 673:
-		return "InventureTrack Systems";
-	case 674:
-		return "LockedUp";
-	case 675:
-		return "Itude";
-	case 676:
-		return "Pacific Lock Company";
-	case 677:
-		return "Tendyron Corporation ( 天地融科技股份有限公司 )";
-	case 678:
-		return "Robert Bosch GmbH";
-	case 679:
-		return "Illuxtron international B.V.";
-	case 680:
-		return "miSport Ltd.";
-	case 681:
-		return "Chargelib";
-	case 682:
-		return "Doppler Lab";
-	case 683:
-		return "BBPOS Limited";
-	case 684:
-		return "RTB Elektronik GmbH & Co. KG";
-	case 685:
-		return "Rx Networks, Inc.";
-	case 686:
-		return "WeatherFlow, Inc.";
-	case 687:
-		return "Technicolor USA Inc.";
-	case 688:
-		return "Bestechnic(Shanghai),Ltd";
-	case 689:
-		return "Raden Inc";
-	case 690:
-		return "JouZen Oy";
-	case 691:
-		return "CLABER S.P.A.";
-	case 692:
-		return "Hyginex, Inc.";
-	case 693:
-		return "HANSHIN ELECTRIC RAILWAY CO.,LTD.";
-	case 694:
-		return "Schneider Electric";
-	case 695:
-		return "Oort Technologies LLC";
-	case 696:
-		return "Chrono Therapeutics";
-	case 697:
-		return "Rinnai Corporation";
-	case 698:
-		return "Swissprime Technologies AG";
-	case 699:
-		return "Koha.,Co.Ltd";
-	case 700:
-		return "Genevac Ltd";
-	case 701:
-		return "Chemtronics";
-	case 702:
-		return "Seguro Technology Sp. z o.o.";
-	case 703:
-		return "Redbird Flight Simulations";
-	case 704:
-		return "Dash Robotics";
-	case 705:
-		return "LINE Corporation";
-	case 706:
-		return "Guillemot Corporation";
-	case 707:
-		return "Techtronic Power Tools Technology Limited";
-	case 708:
-		return "Wilson Sporting Goods";
-	case 709:
-		return "Lenovo (Singapore) Pte Ltd. ( 联想（新加坡） )";
-	case 710:
-		return "Ayatan Sensors";
-	case 711:
-		return "Electronics Tomorrow Limited";
-	case 712:
-		return "VASCO Data Security International, Inc.";
-	case 713:
-		return "PayRange Inc.";
-	case 714:
-		return "ABOV Semiconductor";
-	case 715:
-		return "AINA-Wireless Inc.";
-	case 716:
-		return "Eijkelkamp Soil & Water";
-	case 717:
-		return "BMA ergonomics b.v.";
-	case 718:
-		return "Teva Branded Pharmaceutical Products R&D, Inc.";
-	case 719:
-		return "Anima";
-	case 720:
-		return "3M";
-	case 721:
-		return "Empatica Srl";
-	case 722:
-		return "Afero, Inc.";
-	case 723:
-		return "Powercast Corporation";
-	case 724:
-		return "Secuyou ApS";
-	case 725:
-		return "OMRON Corporation";
-	case 726:
-		return "Send Solutions";
-	case 727:
-		return "NIPPON SYSTEMWARE CO.,LTD.";
-	case 728:
-		return "Neosfar";
-	case 729:
-		return "Fliegl Agrartechnik GmbH";
-	case 730:
-		return "Gilvader";
-	case 731:
-		return "Digi International Inc (R)";
-	case 732:
-		return "DeWalch Technologies, Inc.";
-	case 733:
-		return "Flint Rehabilitation Devices, LLC";
-	case 734:
-		return "Samsung SDS Co., Ltd.";
-	case 735:
-		return "Blur Product Development";
-	case 736:
-		return "University of Michigan";
-	case 737:
-		return "Victron Energy BV";
-	case 738:
-		return "NTT docomo";
-	case 739:
-		return "Carmanah Technologies Corp.";
-	case 740:
-		return "Bytestorm Ltd.";
-	case 741:
-		return "Espressif Incorporated ( 乐鑫信息科技(上海)有限公司 )";
-	case 742:
-		return "Unwire";
-	case 743:
-		return "Connected Yard, Inc.";
-	case 744:
-		return "American Music Environments";
-	case 745:
-		return "Sensogram Technologies, Inc.";
-	case 746:
-		return "Fujitsu Limited";
-	case 747:
-		return "Ardic Technology";
-	case 748:
-		return "Delta Systems, Inc";
-	case 749:
-		return "HTC Corporation";
-	case 750:
-		return "Citizen Holdings Co., Ltd.";
-	case 751:
-		return "SMART-INNOVATION.inc";
-	case 752:
-		return "Blackrat Software";
-	case 753:
-		return "The Idea Cave, LLC";
-	case 754:
-		return "GoPro, Inc.";
-	case 755:
-		return "AuthAir, Inc";
-	case 756:
-		return "Vensi, Inc.";
-	case 757:
-		return "Indagem Tech LLC";
-	case 758:
-		return "Intemo Technologies";
-	case 759:
-		return "DreamVisions co., Ltd.";
-	case 760:
-		return "Runteq Oy Ltd";
-	case 761:
-		return "IMAGINATION TECHNOLOGIES LTD";
-	case 762:
-		return "CoSTAR Technologies";
-	case 763:
-		return "Clarius Mobile Health Corp.";
-	case 764:
-		return "Shanghai Frequen Microelectronics Co., Ltd.";
-	case 765:
-		return "Uwanna, Inc.";
-	case 766:
-		return "Lierda Science & Technology Group Co., Ltd.";
-	case 767:
-		return "Silicon Laboratories";
-	case 768:
-		return "World Moto Inc.";
-	case 769:
-		return "Giatec Scientific Inc.";
-	case 770:
-		return "Loop Devices, Inc";
-	case 771:
-		return "IACA electronique";
-	case 772:
-		return "Proxy Technologies, Inc.";
-	case 773:
-		return "Swipp ApS";
-	case 774:
-		return "Life Laboratory Inc.";
-	case 775:
-		return "FUJI INDUSTRIAL CO.,LTD.";
-	case 776:
-		return "Surefire, LLC";
-	case 777:
-		return "Dolby Labs";
-	case 778:
-		return "Ellisys";
-	case 779:
-		return "Magnitude Lighting Converters";
-	case 780:
-		return "Hilti AG";
-	case 781:
-		return "Devdata S.r.l.";
-	case 782:
-		return "Deviceworx";
-	case 783:
-		return "Shortcut Labs";
-	case 784:
-		return "SGL Italia S.r.l.";
-	case 785:
-		return "PEEQ DATA";
-	case 786:
-		return "Ducere Technologies Pvt Ltd";
-	case 787:
-		return "DiveNav, Inc.";
-	case 788:
-		return "RIIG AI Sp. z o.o.";
-	case 789:
-		return "Thermo Fisher Scientific";
-	case 790:
-		return "AG Measurematics Pvt. Ltd.";
-	case 791:
-		return "CHUO Electronics CO., LTD.";
-	case 792:
-		return "Aspenta International";
-	case 793:
-		return "Eugster Frismag AG";
-	case 794:
-		return "Amber wireless GmbH";
-	case 795:
-		return "HQ Inc";
-	case 796:
-		return "Lab Sensor Solutions";
-	case 797:
-		return "Enterlab ApS";
-	case 798:
-		return "Eyefi, Inc.";
-	case 799:
-		return "MetaSystem S.p.A";
-	case 800:
-		return "SONO ELECTRONICS. CO., LTD";
-	case 801:
-		return "Jewelbots";
-	case 802:
-		return "Compumedics Limited";
-	case 803:
-		return "Rotor Bike Components";
-	case 804:
-		return "Astro, Inc.";
-	case 805:
-		return "Amotus Solutions";
-	case 806:
-		return "Healthwear Technologies (Changzhou)Ltd";
-	case 807:
-		return "Essex Electronics";
-	case 808:
-		return "Grundfos A/S";
-	case 809:
-		return "Eargo, Inc.";
-	case 810:
-		return "Electronic Design Lab";
-	case 811:
-		return "ESYLUX";
-	case 812:
-		return "NIPPON SMT.CO.,Ltd";
-	case 813:
-		return "BM innovations GmbH";
-	case 814:
-		return "indoormap";
-	case 815:
-		return "OttoQ Inc";
-	case 816:
-		return "North Pole Engineering";
-	case 817:
-		return "3flares Technologies Inc.";
-	case 818:
-		return "Electrocompaniet A.S.";
-	case 819:
-		return "Mul-T-Lock";
-	case 820:
-		return "Corentium AS";
-	case 821:
-		return "Enlighted Inc";
-	case 822:
-		return "GISTIC";
-	case 823:
-		return "AJP2 Holdings, LLC";
-	case 824:
-		return "COBI GmbH";
-	case 825:
-		return "Blue Sky Scientific, LLC";
-	case 826:
-		return "Appception, Inc.";
-	case 827:
-		return "Courtney Thorne Limited";
-	case 828:
-		return "Virtuosys";
-	case 829:
-		return "TPV Technology Limited";
-	case 830:
-		return "Monitra SA";
-	case 831:
-		return "Automation Components, Inc.";
-	case 832:
-		return "Letsense s.r.l.";
-	case 833:
-		return "Etesian Technologies LLC";
-	case 834:
-		return "GERTEC BRASIL LTDA.";
-	case 835:
-		return "Drekker Development Pty. Ltd.";
-	case 836:
-		return "Whirl Inc";
-	case 837:
-		return "Locus Positioning";
-	case 838:
-		return "Acuity Brands Lighting, Inc";
-	case 839:
-		return "Prevent Biometrics";
-	case 840:
-		return "Arioneo";
-	case 841:
-		return "VersaMe";
-	case 842:
-		return "Vaddio";
-	case 843:
-		return "Libratone A/S";
-	case 844:
-		return "HM Electronics, Inc.";
-	case 845:
-		return "TASER International, Inc.";
-	case 846:
-		return "Safe Trust Inc.";
-	case 847:
-		return "Heartland Payment Systems";
-	case 848:
-		return "Bitstrata Systems Inc.";
-	case 849:
-		return "Pieps GmbH";
-	case 850:
-		return "iRiding(Xiamen)Technology Co.,Ltd.";
-	case 851:
-		return "Alpha Audiotronics, Inc.";
-	case 852:
-		return "TOPPAN FORMS CO.,LTD.";
-	case 853:
-		return "Sigma Designs, Inc.";
-	case 854:
-		return "Spectrum Brands, Inc.";
-	case 855:
-		return "Polymap Wireless";
-	case 856:
-		return "MagniWare Ltd.";
-	case 857:
-		return "Novotec Medical GmbH";
-	case 858:
-		return "Medicom Innovation Partner a/s";
-	case 859:
-		return "Matrix Inc.";
-	case 860:
-		return "Eaton Corporation";
-	case 861:
-		return "KYS";
-	case 862:
-		return "Naya Health, Inc.";
-	case 863:
-		return "Acromag";
-	case 864:
-		return "Insulet Corporation";
-	case 865:
-		return "Wellinks Inc.";
-	case 866:
-		return "ON Semiconductor";
-	case 867:
-		return "FREELAP SA";
-	case 868:
-		return "Favero Electronics Srl";
-	case 869:
-		return "BioMech Sensor LLC";
-	case 870:
-		return "BOLTT Sports technologies Private limited";
-	case 871:
-		return "Saphe International";
-	case 872:
-		return "Metormote AB";
-	case 873:
-		return "littleBits";
-	case 874:
-		return "SetPoint Medical";
-	case 875:
-		return "BRControls Products BV";
-	case 876:
-		return "Zipcar";
-	case 877:
-		return "AirBolt Pty Ltd";
-	case 878:
-		return "KeepTruckin Inc";
-	case 879:
-		return "Motiv, Inc.";
-	case 880:
-		return "Wazombi Labs OÜ";
-	case 881:
-		return "ORBCOMM";
-	case 882:
-		return "Nixie Labs, Inc.";
-	case 883:
-		return "AppNearMe Ltd";
-	case 884:
-		return "Holman Industries";
-	case 885:
-		return "Expain AS";
-	case 886:
-		return "Electronic Temperature Instruments Ltd";
-	case 887:
-		return "Plejd AB";
-	case 888:
-		return "Propeller Health";
-	case 889:
-		return "Shenzhen iMCO Electronic Technology Co.,Ltd";
-	case 890:
-		return "Algoria";
-	case 891:
-		return "Apption Labs Inc.";
-	case 892:
-		return "Cronologics Corporation";
-	case 893:
-		return "MICRODIA Ltd.";
-	case 894:
-		return "lulabytes S.L.";
-	case 895:
-		return "Société des Produits Nestlé S.A. (formerly Nestec S.A.)";
-	case 896:
-		return "LLC \"MEGA-F service\"";
-	case 897:
-		return "Sharp Corporation";
-	case 898:
-		return "Precision Outcomes Ltd";
-	case 899:
-		return "Kronos Incorporated";
-	case 900:
-		return "OCOSMOS Co., Ltd.";
-	case 901:
-		return "Embedded Electronic Solutions Ltd. dba e2Solutions";
-	case 902:
-		return "Aterica Inc.";
-	case 903:
-		return "BluStor PMC, Inc.";
-	case 904:
-		return "Kapsch TrafficCom AB";
-	case 905:
-		return "ActiveBlu Corporation";
-	case 906:
-		return "Kohler Mira Limited";
-	case 907:
-		return "Noke";
-	case 908:
-		return "Appion Inc.";
-	case 909:
-		return "Resmed Ltd";
-	case 910:
-		return "Crownstone B.V.";
-	case 911:
-		return "Xiaomi Inc.";
-	case 912:
-		return "INFOTECH s.r.o.";
-	case 913:
-		return "Thingsquare AB";
-	case 914:
-		return "T&D";
-	case 915:
-		return "LAVAZZA S.p.A.";
-	case 916:
-		return "Netclearance Systems, Inc.";
-	case 917:
-		return "SDATAWAY";
-	case 918:
-		return "BLOKS GmbH";
-	case 919:
-		return "LEGO System A/S";
-	case 920:
-		return "Thetatronics Ltd";
-	case 921:
-		return "Nikon Corporation";
-	case 922:
-		return "NeST";
-	case 923:
-		return "South Silicon Valley Microelectronics";
-	case 924:
-		return "ALE International";
-	case 925:
-		return "CareView Communications, Inc.";
-	case 926:
-		return "SchoolBoard Limited";
-	case 927:
-		return "Molex Corporation";
-	case 928:
-		return "IVT Wireless Limited";
-	case 929:
-		return "Alpine Labs LLC";
-	case 930:
-		return "Candura Instruments";
-	case 931:
-		return "SmartMovt Technology Co., Ltd";
-	case 932:
-		return "Token Zero Ltd";
-	case 933:
-		return "ACE CAD Enterprise Co., Ltd. (ACECAD)";
-	case 934:
-		return "Medela, Inc";
-	case 935:
-		return "AeroScout";
-	case 936:
-		return "Esrille Inc.";
-	case 937:
-		return "THINKERLY SRL";
-	case 938:
-		return "Exon Sp. z o.o.";
-	case 939:
-		return "Meizu Technology Co., Ltd.";
-	case 940:
-		return "Smablo LTD";
-	case 941:
-		return "XiQ";
-	case 942:
-		return "Allswell Inc.";
-	case 943:
-		return "Comm-N-Sense Corp DBA Verigo";
-	case 944:
-		return "VIBRADORM GmbH";
-	case 945:
-		return "Otodata Wireless Network Inc.";
-	case 946:
-		return "Propagation Systems Limited";
-	case 947:
-		return "Midwest Instruments & Controls";
-	case 948:
-		return "Alpha Nodus, inc.";
-	case 949:
-		return "petPOMM, Inc";
-	case 950:
-		return "Mattel";
-	case 951:
-		return "Airbly Inc.";
-	case 952:
-		return "A-Safe Limited";
-	case 953:
-		return "FREDERIQUE CONSTANT SA";
-	case 954:
-		return "Maxscend Microelectronics Company Limited";
-	case 955:
-		return "Abbott";
-	case 956:
-		return "ASB Bank Ltd";
-	case 957:
-		return "amadas";
-	case 958:
-		return "Applied Science, Inc.";
-	case 959:
-		return "iLumi Solutions Inc.";
-	case 960:
-		return "Arch Systems Inc.";
-	case 961:
-		return "Ember Technologies, Inc.";
-	case 962:
-		return "Snapchat Inc";
-	case 963:
-		return "Casambi Technologies Oy";
-	case 964:
-		return "Pico Technology Inc.";
-	case 965:
-		return "St. Jude Medical, Inc.";
-	case 966:
-		return "Intricon";
-	case 967:
-		return "Structural Health Systems, Inc.";
-	case 968:
-		return "Avvel International";
-	case 969:
-		return "Gallagher Group";
-	case 970:
-		return "In2things Automation Pvt. Ltd.";
-	case 971:
-		return "SYSDEV Srl";
-	case 972:
-		return "Vonkil Technologies Ltd";
-	case 973:
-		return "Wynd Technologies, Inc.";
-	case 974:
-		return "CONTRINEX S.A.";
-	case 975:
-		return "MIRA, Inc.";
-	case 976:
-		return "Watteam Ltd";
-	case 977:
-		return "Density Inc.";
-	case 978:
-		return "IOT Pot India Private Limited";
-	case 979:
-		return "Sigma Connectivity AB";
-	case 980:
-		return "PEG PEREGO SPA";
-	case 981:
-		return "Wyzelink Systems Inc.";
-	case 982:
-		return "Yota Devices LTD";
-	case 983:
-		return "FINSECUR";
-	case 984:
-		return "Zen-Me Labs Ltd";
-	case 985:
-		return "3IWare Co., Ltd.";
-	case 986:
-		return "EnOcean GmbH";
-	case 987:
-		return "Instabeat, Inc";
-	case 988:
-		return "Nima Labs";
-	case 989:
-		return "Andreas Stihl AG & Co. KG";
-	case 990:
-		return "Nathan Rhoades LLC";
-	case 991:
-		return "Grob Technologies, LLC";
-	case 992:
-		return "Actions (Zhuhai) Technology Co., Limited";
-	case 993:
-		return "SPD Development Company Ltd";
-	case 994:
-		return "Sensoan Oy";
-	case 995:
-		return "Qualcomm Life Inc";
-	case 996:
-		return "Chip-ing AG";
-	case 997:
-		return "ffly4u";
-	case 998:
-		return "IoT Instruments Oy";
-	case 999:
-		return "TRUE Fitness Technology";
-	case 1000:
-		return "Reiner Kartengeraete GmbH & Co. KG.";
-	case 1001:
-		return "SHENZHEN LEMONJOY TECHNOLOGY CO., LTD.";
-	case 1002:
-		return "Hello Inc.";
-	case 1003:
-		return "Evollve Inc.";
-	case 1004:
-		return "Jigowatts Inc.";
-	case 1005:
-		return "BASIC MICRO.COM,INC.";
-	case 1006:
-		return "CUBE TECHNOLOGIES";
-	case 1007:
-		return "foolography GmbH";
-	case 1008:
-		return "CLINK";
-	case 1009:
-		return "Hestan Smart Cooking Inc.";
-	case 1010:
-		return "WindowMaster A/S";
-	case 1011:
-		return "Flowscape AB";
-	case 1012:
-		return "PAL Technologies Ltd";
-	case 1013:
-		return "WHERE, Inc.";
-	case 1014:
-		return "Iton Technology Corp.";
-	case 1015:
-		return "Owl Labs Inc.";
-	case 1016:
-		return "Rockford Corp.";
-	case 1017:
-		return "Becon Technologies Co.,Ltd.";
-	case 1018:
-		return "Vyassoft Technologies Inc";
-	case 1019:
-		return "Nox Medical";
-	case 1020:
-		return "Kimberly-Clark";
-	case 1021:
-		return "Trimble Navigation Ltd.";
-	case 1022:
-		return "Littelfuse";
-	case 1023:
-		return "Withings";
-	case 1024:
-		return "i-developer IT Beratung UG";
-	case 1025:
-		return "Relations Inc.";
-	case 1026:
-		return "Sears Holdings Corporation";
-	case 1027:
-		return "Gantner Electronic GmbH";
-	case 1028:
-		return "Authomate Inc";
-	case 1029:
-		return "Vertex International, Inc.";
-	case 1030:
-		return "Airtago";
-	case 1031:
-		return "Swiss Audio SA";
-	case 1032:
-		return "ToGetHome Inc.";
-	case 1033:
-		return "AXIS";
-	case 1034:
-		return "Openmatics";
-	case 1035:
-		return "Jana Care Inc.";
-	case 1036:
-		return "Senix Corporation";
-	case 1037:
-		return "NorthStar Battery Company, LLC";
-	case 1038:
-		return "SKF (U.K.) Limited";
-	case 1039:
-		return "CO-AX Technology, Inc.";
-	case 1040:
-		return "Fender Musical Instruments";
-	case 1041:
-		return "Luidia Inc";
-	case 1042:
-		return "SEFAM";
-	case 1043:
-		return "Wireless Cables Inc";
-	case 1044:
-		return "Lightning Protection International Pty Ltd";
-	case 1045:
-		return "Uber Technologies Inc";
-	case 1046:
-		return "SODA GmbH";
-	case 1047:
-		return "Fatigue Science";
-	case 1048:
-		return "Alpine Electronics Inc.";
-	case 1049:
-		return "Novalogy LTD";
-	case 1050:
-		return "Friday Labs Limited";
-	case 1051:
-		return "OrthoAccel Technologies";
-	case 1052:
-		return "WaterGuru, Inc.";
-	case 1053:
-		return "Benning Elektrotechnik und Elektronik GmbH & Co. KG";
-	case 1054:
-		return "Dell Computer Corporation";
-	case 1055:
-		return "Kopin Corporation";
-	case 1056:
-		return "TecBakery GmbH";
-	case 1057:
-		return "Backbone Labs, Inc.";
-	case 1058:
-		return "DELSEY SA";
-	case 1059:
-		return "Chargifi Limited";
-	case 1060:
-		return "Trainesense Ltd.";
-	case 1061:
-		return "Unify Software and Solutions GmbH & Co. KG";
-	case 1062:
-		return "Husqvarna AB";
-	case 1063:
-		return "Focus fleet and fuel management inc";
-	case 1064:
-		return "SmallLoop, LLC";
-	case 1065:
-		return "Prolon Inc.";
-	case 1066:
-		return "BD Medical";
-	case 1067:
-		return "iMicroMed Incorporated";
-	case 1068:
-		return "Ticto N.V.";
-	case 1069:
-		return "Meshtech AS";
-	case 1070:
-		return "MemCachier Inc.";
-	case 1071:
-		return "Danfoss A/S";
-	case 1072:
-		return "SnapStyk Inc.";
-	case 1073:
-		return "Amway Corporation";
-	case 1074:
-		return "Silk Labs, Inc.";
-	case 1075:
-		return "Pillsy Inc.";
-	case 1076:
-		return "Hatch Baby, Inc.";
-	case 1077:
-		return "Blocks Wearables Ltd.";
-	case 1078:
-		return "Drayson Technologies (Europe) Limited";
-	case 1079:
-		return "eBest IOT Inc.";
-	case 1080:
-		return "Helvar Ltd";
-	case 1081:
-		return "Radiance Technologies";
-	case 1082:
-		return "Nuheara Limited";
-	case 1083:
-		return "Appside co., ltd.";
-	case 1084:
-		return "DeLaval";
-	case 1085:
-		return "Coiler Corporation";
-	case 1086:
-		return "Thermomedics, Inc.";
-	case 1087:
-		return "Tentacle Sync GmbH";
-	case 1088:
-		return "Valencell, Inc.";
-	case 1089:
-		return "iProtoXi Oy";
-	case 1090:
-		return "SECOM CO., LTD.";
-	case 1091:
-		return "Tucker International LLC";
-	case 1092:
-		return "Metanate Limited";
-	case 1093:
-		return "Kobian Canada Inc.";
-	case 1094:
-		return "NETGEAR, Inc.";
-	case 1095:
-		return "Fabtronics Australia Pty Ltd";
-	case 1096:
-		return "Grand Centrix GmbH";
-	case 1097:
-		return "1UP USA.com llc";
-	case 1098:
-		return "SHIMANO INC.";
-	case 1099:
-		return "Nain Inc.";
-	case 1100:
-		return "LifeStyle Lock, LLC";
-	case 1101:
-		return "VEGA Grieshaber KG";
-	case 1102:
-		return "Xtrava Inc.";
-	case 1103:
-		return "TTS Tooltechnic Systems AG & Co. KG";
-	case 1104:
-		return "Teenage Engineering AB";
-	case 1105:
-		return "Tunstall Nordic AB";
-	case 1106:
-		return "Svep Design Center AB";
-	case 1107:
-		return "GreenPeak Technologies BV";
-	case 1108:
-		return "Sphinx Electronics GmbH & Co KG";
-	case 1109:
-		return "Atomation";
-	case 1110:
-		return "Nemik Consulting Inc";
-	case 1111:
-		return "RF INNOVATION";
-	case 1112:
-		return "Mini Solution Co., Ltd.";
-	case 1113:
-		return "Lumenetix, Inc";
-	case 1114:
-		return "2048450 Ontario Inc";
-	case 1115:
-		return "SPACEEK LTD";
-	case 1116:
-		return "Delta T Corporation";
-	case 1117:
-		return "Boston Scientific Corporation";
-	case 1118:
-		return "Nuviz, Inc.";
-	case 1119:
-		return "Real Time Automation, Inc.";
-	case 1120:
-		return "Kolibree";
-	case 1121:
-		return "vhf elektronik GmbH";
-	case 1122:
-		return "Bonsai Systems GmbH";
-	case 1123:
-		return "Fathom Systems Inc.";
-	case 1124:
-		return "Bellman & Symfon";
-	case 1125:
-		return "International Forte Group LLC";
-	case 1126:
-		return "CycleLabs Solutions inc.";
-	case 1127:
-		return "Codenex Oy";
-	case 1128:
-		return "Kynesim Ltd";
-	case 1129:
-		return "Palago AB";
-	case 1130:
-		return "INSIGMA INC.";
-	case 1131:
-		return "PMD Solutions";
-	case 1132:
-		return "Qingdao Realtime Technology Co., Ltd.";
-	case 1133:
-		return "BEGA Gantenbrink-Leuchten KG";
-	case 1134:
-		return "Pambor Ltd.";
-	case 1135:
-		return "Develco Products A/S";
-	case 1136:
-		return "iDesign s.r.l.";
-	case 1137:
-		return "TiVo Corp";
-	case 1138:
-		return "Control-J Pty Ltd";
-	case 1139:
-		return "Steelcase, Inc.";
-	case 1140:
-		return "iApartment co., ltd.";
-	case 1141:
-		return "Icom inc.";
-	case 1142:
-		return "Oxstren Wearable Technologies Private Limited";
-	case 1143:
-		return "Blue Spark Technologies";
-	case 1144:
-		return "FarSite Communications Limited";
-	case 1145:
-		return "mywerk system GmbH";
-	case 1146:
-		return "Sinosun Technology Co., Ltd.";
-	case 1147:
-		return "MIYOSHI ELECTRONICS CORPORATION";
-	case 1148:
-		return "POWERMAT LTD";
-	case 1149:
-		return "Occly LLC";
-	case 1150:
-		return "OurHub Dev IvS";
-	case 1151:
-		return "Pro-Mark, Inc.";
-	case 1152:
-		return "Dynometrics Inc.";
-	case 1153:
-		return "Quintrax Limited";
-	case 1154:
-		return "POS Tuning Udo Vosshenrich GmbH & Co. KG";
-	case 1155:
-		return "Multi Care Systems B.V.";
-	case 1156:
-		return "Revol Technologies Inc";
-	case 1157:
-		return "SKIDATA AG";
-	case 1158:
-		return "DEV TECNOLOGIA INDUSTRIA, COMERCIO E MANUTENCAO DE EQUIPAMENTOS LTDA. - ME";
-	case 1159:
-		return "Centrica Connected Home";
-	case 1160:
-		return "Automotive Data Solutions Inc";
-	case 1161:
-		return "Igarashi Engineering";
-	case 1162:
-		return "Taelek Oy";
-	case 1163:
-		return "CP Electronics Limited";
-	case 1164:
-		return "Vectronix AG";
-	case 1165:
-		return "S-Labs Sp. z o.o.";
-	case 1166:
-		return "Companion Medical, Inc.";
-	case 1167:
-		return "BlueKitchen GmbH";
-	case 1168:
-		return "Matting AB";
-	case 1169:
-		return "SOREX - Wireless Solutions GmbH";
-	case 1170:
-		return "ADC Technology, Inc.";
-	case 1171:
-		return "Lynxemi Pte Ltd";
-	case 1172:
-		return "SENNHEISER electronic GmbH & Co. KG";
-	case 1173:
-		return "LMT Mercer Group, Inc";
-	case 1174:
-		return "Polymorphic Labs LLC";
-	case 1175:
-		return "Cochlear Limited";
-	case 1176:
-		return "METER Group, Inc. USA";
-	case 1177:
-		return "Ruuvi Innovations Ltd.";
-	case 1178:
-		return "Situne AS";
-	case 1179:
-		return "nVisti, LLC";
-	case 1180:
-		return "DyOcean";
-	case 1181:
-		return "Uhlmann & Zacher GmbH";
-	case 1182:
-		return "AND!XOR LLC";
-	case 1183:
-		return "tictote AB";
-	case 1184:
-		return "Vypin, LLC";
-	case 1185:
-		return "PNI Sensor Corporation";
-	case 1186:
-		return "ovrEngineered, LLC";
-	case 1187:
-		return "GT-tronics HK Ltd";
-	case 1188:
-		return "Herbert Waldmann GmbH & Co. KG";
-	case 1189:
-		return "Guangzhou FiiO Electronics Technology Co.,Ltd";
-	case 1190:
-		return "Vinetech Co., Ltd";
-	case 1191:
-		return "Dallas Logic Corporation";
-	case 1192:
-		return "BioTex, Inc.";
-	case 1193:
-		return "DISCOVERY SOUND TECHNOLOGY, LLC";
-	case 1194:
-		return "LINKIO SAS";
-	case 1195:
-		return "Harbortronics, Inc.";
-	case 1196:
-		return "Undagrid B.V.";
-	case 1197:
-		return "Shure Inc";
-	case 1198:
-		return "ERM Electronic Systems LTD";
-	case 1199:
-		return "BIOROWER Handelsagentur GmbH";
-	case 1200:
-		return "Weba Sport und Med. Artikel GmbH";
-	case 1201:
-		return "Kartographers Technologies Pvt. Ltd.";
-	case 1202:
-		return "The Shadow on the Moon";
-	case 1203:
-		return "mobike (Hong Kong) Limited";
-	case 1204:
-		return "Inuheat Group AB";
-	case 1205:
-		return "Swiftronix AB";
-	case 1206:
-		return "Diagnoptics Technologies";
-	case 1207:
-		return "Analog Devices, Inc.";
-	case 1208:
-		return "Soraa Inc.";
-	case 1209:
-		return "CSR Building Products Limited";
-	case 1210:
-		return "Crestron Electronics, Inc.";
-	case 1211:
-		return "Neatebox Ltd";
-	case 1212:
-		return "Draegerwerk AG & Co. KGaA";
-	case 1213:
-		return "AlbynMedical";
-	case 1214:
-		return "Averos FZCO";
-	case 1215:
-		return "VIT Initiative, LLC";
-	case 1216:
-		return "Statsports International";
-	case 1217:
-		return "Sospitas, s.r.o.";
-	case 1218:
-		return "Dmet Products Corp.";
-	case 1219:
-		return "Mantracourt Electronics Limited";
-	case 1220:
-		return "TeAM Hutchins AB";
-	case 1221:
-		return "Seibert Williams Glass, LLC";
-	case 1222:
-		return "Insta GmbH";
-	case 1223:
-		return "Svantek Sp. z o.o.";
-	case 1224:
-		return "Shanghai Flyco Electrical Appliance Co., Ltd.";
-	case 1225:
-		return "Thornwave Labs Inc";
-	case 1226:
-		return "Steiner-Optik GmbH";
-	case 1227:
-		return "Novo Nordisk A/S";
-	case 1228:
-		return "Enflux Inc.";
-	case 1229:
-		return "Safetech Products LLC";
-	case 1230:
-		return "GOOOLED S.R.L.";
-	case 1231:
-		return "DOM Sicherheitstechnik GmbH & Co. KG";
-	case 1232:
-		return "Olympus Corporation";
-	case 1233:
-		return "KTS GmbH";
-	case 1234:
-		return "Anloq Technologies Inc.";
-	case 1235:
-		return "Queercon, Inc";
-	case 1236:
-		return "5th Element Ltd";
-	case 1237:
-		return "Gooee Limited";
-	case 1238:
-		return "LUGLOC LLC";
-	case 1239:
-		return "Blincam, Inc.";
-	case 1240:
-		return "FUJIFILM Corporation";
-	case 1241:
-		return "RandMcNally";
-	case 1242:
-		return "Franceschi Marina snc";
-	case 1243:
-		return "Engineered Audio, LLC.";
-	case 1244:
-		return "IOTTIVE (OPC) PRIVATE LIMITED";
-	case 1245:
-		return "4MOD Technology";
-	case 1246:
-		return "Lutron Electronics Co., Inc.";
-	case 1247:
-		return "Emerson";
-	case 1248:
-		return "Guardtec, Inc.";
-	case 1249:
-		return "REACTEC LIMITED";
-	case 1250:
-		return "EllieGrid";
-	case 1251:
-		return "Under Armour";
-	case 1252:
-		return "Woodenshark";
-	case 1253:
-		return "Avack Oy";
-	case 1254:
-		return "Smart Solution Technology, Inc.";
-	case 1255:
-		return "REHABTRONICS INC.";
-	case 1256:
-		return "STABILO International";
-	case 1257:
-		return "Busch Jaeger Elektro GmbH";
-	case 1258:
-		return "Pacific Bioscience Laboratories, Inc";
-	case 1259:
-		return "Bird Home Automation GmbH";
-	case 1260:
-		return "Motorola Solutions";
-	case 1261:
-		return "R9 Technology, Inc.";
-	case 1262:
-		return "Auxivia";
-	case 1263:
-		return "DaisyWorks, Inc";
-	case 1264:
-		return "Kosi Limited";
-	case 1265:
-		return "Theben AG";
-	case 1266:
-		return "InDreamer Techsol Private Limited";
-	case 1267:
-		return "Cerevast Medical";
-	case 1268:
-		return "ZanCompute Inc.";
-	case 1269:
-		return "Pirelli Tyre S.P.A.";
-	case 1270:
-		return "McLear Limited";
-	case 1271:
-		return "Shenzhen Huiding Technology Co.,Ltd.";
-	case 1272:
-		return "Convergence Systems Limited";
-	case 1273:
-		return "Interactio";
-	case 1274:
-		return "Androtec GmbH";
-	case 1275:
-		return "Benchmark Drives GmbH & Co. KG";
-	case 1276:
-		return "SwingLync L. L. C.";
-	case 1277:
-		return "Tapkey GmbH";
-	case 1278:
-		return "Woosim Systems Inc.";
-	case 1279:
-		return "Microsemi Corporation";
-	case 1280:
-		return "Wiliot LTD.";
-	case 1281:
-		return "Polaris IND";
-	case 1282:
-		return "Specifi-Kali LLC";
-	case 1283:
-		return "Locoroll, Inc";
-	case 1284:
-		return "PHYPLUS Inc";
-	case 1285:
-		return "Inplay Technologies LLC";
-	case 1286:
-		return "Hager";
-	case 1287:
-		return "Yellowcog";
-	case 1288:
-		return "Axes System sp. z o. o.";
-	case 1289:
-		return "myLIFTER Inc.";
-	case 1290:
-		return "Shake-on B.V.";
-	case 1291:
-		return "Vibrissa Inc.";
-	case 1292:
-		return "OSRAM GmbH";
-	case 1293:
-		return "TRSystems GmbH";
-	case 1294:
-		return "Yichip Microelectronics (Hangzhou) Co.,Ltd.";
-	case 1295:
-		return "Foundation Engineering LLC";
-	case 1296:
-		return "UNI-ELECTRONICS, INC.";
-	case 1297:
-		return "Brookfield Equinox LLC";
-	case 1298:
-		return "Soprod SA";
-	case 1299:
-		return "9974091 Canada Inc.";
-	case 1300:
-		return "FIBRO GmbH";
-	case 1301:
-		return "RB Controls Co., Ltd.";
-	case 1302:
-		return "Footmarks";
-	case 1303:
-		return "Amtronic Sverige AB (formerly Amcore AB)";
-	case 1304:
-		return "MAMORIO.inc";
-	case 1305:
-		return "Tyto Life LLC";
-	case 1306:
-		return "Leica Camera AG";
-	case 1307:
-		return "Angee Technologies Ltd.";
-	case 1308:
-		return "EDPS";
-	case 1309:
-		return "OFF Line Co., Ltd.";
-	case 1310:
-		return "Detect Blue Limited";
-	case 1311:
-		return "Setec Pty Ltd";
-	case 1312:
-		return "Target Corporation";
-	case 1313:
-		return "IAI Corporation";
-	case 1314:
-		return "NS Tech, Inc.";
-	case 1315:
-		return "MTG Co., Ltd.";
-	case 1316:
-		return "Hangzhou iMagic Technology Co., Ltd";
-	case 1317:
-		return "HONGKONG NANO IC TECHNOLOGIES  CO., LIMITED";
-	case 1318:
-		return "Honeywell International Inc.";
-	case 1319:
-		return "Albrecht JUNG";
-	case 1320:
-		return "Lunera Lighting Inc.";
-	case 1321:
-		return "Lumen UAB";
-	case 1322:
-		return "Keynes Controls Ltd";
-	case 1323:
-		return "Novartis AG";
-	case 1324:
-		return "Geosatis SA";
-	case 1325:
-		return "EXFO, Inc.";
-	case 1326:
-		return "LEDVANCE GmbH";
-	case 1327:
-		return "Center ID Corp.";
-	case 1328:
-		return "Adolene, Inc.";
-	case 1329:
-		return "D&M Holdings Inc.";
-	case 1330:
-		return "CRESCO Wireless, Inc.";
-	case 1331:
-		return "Nura Operations Pty Ltd";
-	case 1332:
-		return "Frontiergadget, Inc.";
-	case 1333:
-		return "Smart Component Technologies Limited";
-	case 1334:
-		return "ZTR Control Systems LLC";
-	case 1335:
-		return "MetaLogics Corporation";
-	case 1336:
-		return "Medela AG";
-	case 1337:
-		return "OPPLE Lighting Co., Ltd";
-	case 1338:
-		return "Savitech Corp.,";
-	case 1339:
-		return "prodigy";
-	case 1340:
-		return "Screenovate Technologies Ltd";
-	case 1341:
-		return "TESA SA";
-	case 1342:
-		return "CLIM8 LIMITED";
-	case 1343:
-		return "Silergy Corp";
-	case 1344:
-		return "SilverPlus, Inc";
-	case 1345:
-		return "Sharknet srl";
-	case 1346:
-		return "Mist Systems, Inc.";
-	case 1347:
-		return "MIWA LOCK CO.,Ltd";
-	case 1348:
-		return "OrthoSensor, Inc.";
-	case 1349:
-		return "Candy Hoover Group s.r.l";
-	case 1350:
-		return "Apexar Technologies S.A.";
-	case 1351:
-		return "LOGICDATA d.o.o.";
-	case 1352:
-		return "Knick Elektronische Messgeraete GmbH & Co. KG";
-	case 1353:
-		return "Smart Technologies and Investment Limited";
-	case 1354:
-		return "Linough Inc.";
-	case 1355:
-		return "Advanced Electronic Designs, Inc.";
-	case 1356:
-		return "Carefree Scott Fetzer Co Inc";
-	case 1357:
-		return "Sensome";
-	case 1358:
-		return "FORTRONIK storitve d.o.o.";
-	case 1359:
-		return "Sinnoz";
-	case 1360:
-		return "Versa Networks, Inc.";
-	case 1361:
-		return "Sylero";
-	case 1362:
-		return "Avempace SARL";
-	case 1363:
-		return "Nintendo Co., Ltd.";
-	case 1364:
-		return "National Instruments";
-	case 1365:
-		return "KROHNE Messtechnik GmbH";
-	case 1366:
-		return "Otodynamics Ltd";
-	case 1367:
-		return "Arwin Technology Limited";
-	case 1368:
-		return "benegear, inc.";
-	case 1369:
-		return "Newcon Optik";
-	case 1370:
-		return "CANDY HOUSE, Inc.";
-	case 1371:
-		return "FRANKLIN TECHNOLOGY INC";
-	case 1372:
-		return "Lely";
-	case 1373:
-		return "Valve Corporation";
-	case 1374:
-		return "Hekatron Vertriebs GmbH";
-	case 1375:
-		return "PROTECH S.A.S. DI GIRARDI ANDREA & C.";
-	case 1376:
-		return "Sarita CareTech APS (formerly Sarita CareTech IVS)";
-	case 1377:
-		return "Finder S.p.A.";
-	case 1378:
-		return "Thalmic Labs Inc.";
-	case 1379:
-		return "Steinel Vertrieb GmbH";
-	case 1380:
-		return "Beghelli Spa";
-	case 1381:
-		return "Beijing Smartspace Technologies Inc.";
-	case 1382:
-		return "CORE TRANSPORT TECHNOLOGIES NZ LIMITED";
-	case 1383:
-		return "Xiamen Everesports Goods Co., Ltd";
-	case 1384:
-		return "Bodyport Inc.";
-	case 1385:
-		return "Audionics System, INC.";
-	case 1386:
-		return "Flipnavi Co.,Ltd.";
-	case 1387:
-		return "Rion Co., Ltd.";
-	case 1388:
-		return "Long Range Systems, LLC";
-	case 1389:
-		return "Redmond Industrial Group LLC";
-	case 1390:
-		return "VIZPIN INC.";
-	case 1391:
-		return "BikeFinder AS";
-	case 1392:
-		return "Consumer Sleep Solutions LLC";
-	case 1393:
-		return "PSIKICK, INC.";
-	case 1394:
-		return "AntTail.com";
-	case 1395:
-		return "Lighting Science Group Corp.";
-	case 1396:
-		return "AFFORDABLE ELECTRONICS INC";
-	case 1397:
-		return "Integral Memroy Plc";
-	case 1398:
-		return "Globalstar, Inc.";
-	case 1399:
-		return "True Wearables, Inc.";
-	case 1400:
-		return "Wellington Drive Technologies Ltd";
-	case 1401:
-		return "Ensemble Tech Private Limited";
-	case 1402:
-		return "OMNI Remotes";
-	case 1403:
-		return "Duracell U.S. Operations Inc.";
-	case 1404:
-		return "Toor Technologies LLC";
-	case 1405:
-		return "Instinct Performance";
-	case 1406:
-		return "Beco, Inc";
-	case 1407:
-		return "Scuf Gaming International, LLC";
-	case 1408:
-		return "ARANZ Medical Limited";
-	case 1409:
-		return "LYS TECHNOLOGIES LTD";
-	case 1410:
-		return "Breakwall Analytics, LLC";
-	case 1411:
-		return "Code Blue Communications";
-	case 1412:
-		return "Gira Giersiepen GmbH & Co. KG";
-	case 1413:
-		return "Hearing Lab Technology";
-	case 1414:
-		return "LEGRAND";
-	case 1415:
-		return "Derichs GmbH";
-	case 1416:
-		return "ALT-TEKNIK LLC";
-	case 1417:
-		return "Star Technologies";
-	case 1418:
-		return "START TODAY CO.,LTD.";
-	case 1419:
-		return "Maxim Integrated Products";
-	case 1420:
-		return "MERCK Kommanditgesellschaft auf Aktien";
-	case 1421:
-		return "Jungheinrich Aktiengesellschaft";
-	case 1422:
-		return "Oculus VR, LLC";
-	case 1423:
-		return "HENDON SEMICONDUCTORS PTY LTD";
-	case 1424:
-		return "Pur3 Ltd";
-	case 1425:
-		return "Viasat Group S.p.A.";
-	case 1426:
-		return "IZITHERM";
-	case 1427:
-		return "Spaulding Clinical Research";
-	case 1428:
-		return "Kohler Company";
-	case 1429:
-		return "Inor Process AB";
-	case 1430:
-		return "My Smart Blinds";
-	case 1431:
-		return "RadioPulse Inc";
-	case 1432:
-		return "rapitag GmbH";
-	case 1433:
-		return "Lazlo326, LLC.";
-	case 1434:
-		return "Teledyne Lecroy, Inc.";
-	case 1435:
-		return "Dataflow Systems Limited";
-	case 1436:
-		return "Macrogiga Electronics";
-	case 1437:
-		return "Tandem Diabetes Care";
-	case 1438:
-		return "Polycom, Inc.";
-	case 1439:
-		return "Fisher & Paykel Healthcare";
-	case 1440:
-		return "RCP Software Oy";
-	case 1441:
-		return "Shanghai Xiaoyi Technology Co.,Ltd.";
-	case 1442:
-		return "ADHERIUM(NZ) LIMITED";
-	case 1443:
-		return "Axiomware Systems Incorporated";
-	case 1444:
-		return "O. E. M. Controls, Inc.";
-	case 1445:
-		return "Kiiroo BV";
-	case 1446:
-		return "Telecon Mobile Limited";
-	case 1447:
-		return "Sonos Inc";
-	case 1448:
-		return "Tom Allebrandi Consulting";
-	case 1449:
-		return "Monidor";
-	case 1450:
-		return "Tramex Limited";
-	case 1451:
-		return "Nofence AS";
-	case 1452:
-		return "GoerTek Dynaudio Co., Ltd.";
-	case 1453:
-		return "INIA";
-	case 1454:
-		return "CARMATE MFG.CO.,LTD";
-	case 1455:
-		return "ONvocal";
-	case 1456:
-		return "NewTec GmbH";
-	case 1457:
-		return "Medallion Instrumentation Systems";
-	case 1458:
-		return "CAREL INDUSTRIES S.P.A.";
-	case 1459:
-		return "Parabit Systems, Inc.";
-	case 1460:
-		return "White Horse Scientific ltd";
-	case 1461:
-		return "verisilicon";
-	case 1462:
-		return "Elecs Industry Co.,Ltd.";
-	case 1463:
-		return "Beijing Pinecone Electronics Co.,Ltd.";
-	case 1464:
-		return "Ambystoma Labs Inc.";
-	case 1465:
-		return "Suzhou Pairlink Network Technology";
-	case 1466:
-		return "igloohome";
-	case 1467:
-		return "Oxford Metrics plc";
-	case 1468:
-		return "Leviton Mfg. Co., Inc.";
-	case 1469:
-		return "ULC Robotics Inc.";
-	case 1470:
-		return "RFID Global by Softwork SrL";
-	case 1471:
-		return "Real-World-Systems Corporation";
-	case 1472:
-		return "Nalu Medical, Inc.";
-	case 1473:
-		return "P.I.Engineering";
-	case 1474:
-		return "Grote Industries";
-	case 1475:
-		return "Runtime, Inc.";
-	case 1476:
-		return "Codecoup sp. z o.o. sp. k.";
-	case 1477:
-		return "SELVE GmbH & Co. KG";
-	case 1478:
-		return "Smart Animal Training Systems, LLC";
-	case 1479:
-		return "Lippert Components, INC";
-	case 1480:
-		return "SOMFY SAS";
-	case 1481:
-		return "TBS Electronics B.V.";
-	case 1482:
-		return "MHL Custom Inc";
-	case 1483:
-		return "LucentWear LLC";
-	case 1484:
-		return "WATTS ELECTRONICS";
-	case 1485:
-		return "RJ Brands LLC";
-	case 1486:
-		return "V-ZUG Ltd";
-	case 1487:
-		return "Biowatch SA";
-	case 1488:
-		return "Anova Applied Electronics";
-	case 1489:
-		return "Lindab AB";
-	case 1490:
-		return "frogblue TECHNOLOGY GmbH";
-	case 1491:
-		return "Acurable Limited";
-	case 1492:
-		return "LAMPLIGHT Co., Ltd.";
-	case 1493:
-		return "TEGAM, Inc.";
-	case 1494:
-		return "Zhuhai Jieli technology Co.,Ltd";
-	case 1495:
-		return "modum.io AG";
-	case 1496:
-		return "Farm Jenny LLC";
-	case 1497:
-		return "Toyo Electronics Corporation";
-	case 1498:
-		return "Applied Neural Research Corp";
-	case 1499:
-		return "Avid Identification Systems, Inc.";
-	case 1500:
-		return "Petronics Inc.";
-	case 1501:
-		return "essentim GmbH";
-	case 1502:
-		return "QT Medical INC.";
-	case 1503:
-		return "VIRTUALCLINIC.DIRECT LIMITED";
-	case 1504:
-		return "Viper Design LLC";
-	case 1505:
-		return "Human, Incorporated";
-	case 1506:
-		return "stAPPtronics GmbH";
-	case 1507:
-		return "Elemental Machines, Inc.";
-	case 1508:
-		return "Taiyo Yuden Co., Ltd";
-	case 1509:
-		return "INEO ENERGY& SYSTEMS";
-	case 1510:
-		return "Motion Instruments Inc.";
-	case 1511:
-		return "PressurePro";
-	case 1512:
-		return "COWBOY";
-	case 1513:
-		return "iconmobile GmbH";
-	case 1514:
-		return "ACS-Control-System GmbH";
-	case 1515:
-		return "Bayerische Motoren Werke AG";
-	case 1516:
-		return "Gycom Svenska AB";
-	case 1517:
-		return "Fuji Xerox Co., Ltd";
-	case 1518:
-		return "Glide Inc.";
-	case 1519:
-		return "SIKOM AS";
-	case 1520:
-		return "beken";
-	case 1521:
-		return "The Linux Foundation";
-	case 1522:
-		return "Try and E CO.,LTD.";
-	case 1523:
-		return "SeeScan";
-	case 1524:
-		return "Clearity, LLC";
-	case 1525:
-		return "GS TAG";
-	case 1526:
-		return "DPTechnics";
-	case 1527:
-		return "TRACMO, INC.";
-	case 1528:
-		return "Anki Inc.";
-	case 1529:
-		return "Hagleitner Hygiene International GmbH";
-	case 1530:
-		return "Konami Sports Life Co., Ltd.";
-	case 1531:
-		return "Arblet Inc.";
-	case 1532:
-		return "Masbando GmbH";
-	case 1533:
-		return "Innoseis";
-	case 1534:
-		return "Niko nv";
-	case 1535:
-		return "Wellnomics Ltd";
-	case 1536:
-		return "iRobot Corporation";
-	case 1537:
-		return "Schrader Electronics";
-	case 1538:
-		return "Geberit International AG";
-	case 1539:
-		return "Fourth Evolution Inc";
-	case 1540:
-		return "Cell2Jack LLC";
-	case 1541:
-		return "FMW electronic Futterer u. Maier-Wolf OHG";
-	case 1542:
-		return "John Deere";
-	case 1543:
-		return "Rookery Technology Ltd";
-	case 1544:
-		return "KeySafe-Cloud";
-	case 1545:
-		return "BUCHI Labortechnik AG";
-	case 1546:
-		return "IQAir AG";
-	case 1547:
-		return "Triax Technologies Inc";
-	case 1548:
-		return "Vuzix Corporation";
-	case 1549:
-		return "TDK Corporation";
-	case 1550:
-		return "Blueair AB";
-	case 1551:
-		return "Signify Netherlands";
-	case 1552:
-		return "ADH GUARDIAN USA LLC";
-	case 1553:
-		return "Beurer GmbH";
-	case 1554:
-		return "Playfinity AS";
-	case 1555:
-		return "Hans Dinslage GmbH";
-	case 1556:
-		return "OnAsset Intelligence, Inc.";
-	case 1557:
-		return "INTER ACTION Corporation";
-	case 1558:
-		return "OS42 UG (haftungsbeschraenkt)";
-	case 1559:
-		return "WIZCONNECTED COMPANY LIMITED";
-	case 1560:
-		return "Audio-Technica Corporation";
-	case 1561:
-		return "Six Guys Labs, s.r.o.";
-	case 1562:
-		return "R.W. Beckett Corporation";
-	case 1563:
-		return "silex technology, inc.";
-	case 1564:
-		return "Univations Limited";
-	case 1565:
-		return "SENS Innovation ApS";
-	case 1566:
-		return "Diamond Kinetics, Inc.";
-	case 1567:
-		return "Phrame Inc.";
-	case 1568:
-		return "Forciot Oy";
-	case 1569:
-		return "Noordung d.o.o.";
-	case 1570:
-		return "Beam Labs, LLC";
-	case 1571:
-		return "Philadelphia Scientific (U.K.) Limited";
-	case 1572:
-		return "Biovotion AG";
-	case 1573:
-		return "Square Panda, Inc.";
-	case 1574:
-		return "Amplifico";
-	case 1575:
-		return "WEG S.A.";
-	case 1576:
-		return "Ensto Oy";
-	case 1577:
-		return "PHONEPE PVT LTD";
-	case 1578:
-		return "Lunatico Astronomia SL";
-	case 1579:
-		return "MinebeaMitsumi Inc.";
-	case 1580:
-		return "ASPion GmbH";
-	case 1581:
-		return "Vossloh-Schwabe Deutschland GmbH";
-	case 1582:
-		return "Procept";
-	case 1583:
-		return "ONKYO Corporation";
-	case 1584:
-		return "Asthrea D.O.O.";
-	case 1585:
-		return "Fortiori Design LLC";
-	case 1586:
-		return "Hugo Muller GmbH & Co KG";
-	case 1587:
-		return "Wangi Lai PLT";
-	case 1588:
-		return "Fanstel Corp";
-	case 1589:
-		return "Crookwood";
-	case 1590:
-		return "ELECTRONICA INTEGRAL DE SONIDO S.A.";
-	case 1591:
-		return "GiP Innovation Tools GmbH";
-	case 1592:
-		return "LX SOLUTIONS PTY LIMITED";
-	case 1593:
-		return "Shenzhen Minew Technologies Co., Ltd.";
-	case 1594:
-		return "Prolojik Limited";
-	case 1595:
-		return "Kromek Group Plc";
-	case 1596:
-		return "Contec Medical Systems Co., Ltd.";
-	case 1597:
-		return "Xradio Technology Co.,Ltd.";
-	case 1598:
-		return "The Indoor Lab, LLC";
-	case 1599:
-		return "LDL TECHNOLOGY";
-	case 1600:
-		return "Parkifi";
-	case 1601:
-		return "Revenue Collection Systems FRANCE SAS";
-	case 1602:
-		return "Bluetrum Technology Co.,Ltd";
-	case 1603:
-		return "makita corporation";
-	case 1604:
-		return "Apogee Instruments";
-	case 1605:
-		return "BM3";
-	case 1606:
-		return "SGV Group Holding GmbH & Co. KG";
-	case 1607:
-		return "MED-EL";
-	case 1608:
-		return "Ultune Technologies";
-	case 1609:
-		return "Ryeex Technology Co.,Ltd.";
-	case 1610:
-		return "Open Research Institute, Inc.";
-	case 1611:
-		return "Scale-Tec, Ltd";
-	case 1612:
-		return "Zumtobel Group AG";
-	case 1613:
-		return "iLOQ Oy";
-	case 1614:
-		return "KRUXWorks Technologies Private Limited";
-	case 1615:
-		return "Digital Matter Pty Ltd";
-	case 1616:
-		return "Coravin, Inc.";
-	case 1617:
-		return "Stasis Labs, Inc.";
-	case 1618:
-		return "ITZ Innovations- und Technologiezentrum GmbH";
-	case 1619:
-		return "Meggitt SA";
-	case 1620:
-		return "Ledlenser GmbH & Co. KG";
-	case 1621:
-		return "Renishaw PLC";
-	case 1622:
-		return "ZhuHai AdvanPro Technology Company Limited";
-	case 1623:
-		return "Meshtronix Limited";
-	case 1624:
-		return "Payex Norge AS";
-	case 1625:
-		return "UnSeen Technologies Oy";
-	case 1626:
-		return "Zound Industries International AB";
-	case 1627:
-		return "Sesam Solutions BV";
-	case 1628:
-		return "PixArt Imaging Inc.";
-	case 1629:
-		return "Panduit Corp.";
-	case 1630:
-		return "Alo AB";
-	case 1631:
-		return "Ricoh Company Ltd";
-	case 1632:
-		return "RTC Industries, Inc.";
-	case 1633:
-		return "Mode Lighting Limited";
-	case 1634:
-		return "Particle Industries, Inc.";
-	case 1635:
-		return "Advanced Telemetry Systems, Inc.";
-	case 1636:
-		return "RHA TECHNOLOGIES LTD";
-	case 1637:
-		return "Pure International Limited";
-	case 1638:
-		return "WTO Werkzeug-Einrichtungen GmbH";
-	case 1639:
-		return "Spark Technology Labs Inc.";
-	case 1640:
-		return "Bleb Technology srl";
-	case 1641:
-		return "Livanova USA, Inc.";
-	case 1642:
-		return "Brady Worldwide Inc.";
-	case 1643:
-		return "DewertOkin GmbH";
-	case 1644:
-		return "Ztove ApS";
-	case 1645:
-		return "Venso EcoSolutions AB";
-	case 1646:
-		return "Eurotronik Kranj d.o.o.";
-	case 1647:
-		return "Hug Technology Ltd";
-	case 1648:
-		return "Gema Switzerland GmbH";
-	case 1649:
-		return "Buzz Products Ltd.";
-	case 1650:
-		return "Kopi";
-	case 1651:
-		return "Innova Ideas Limited";
-	case 1652:
-		return "BeSpoon";
-	case 1653:
-		return "Deco Enterprises, Inc.";
-	case 1654:
-		return "Expai Solutions Private Limited";
-	case 1655:
-		return "Innovation First, Inc.";
-	case 1656:
-		return "SABIK Offshore GmbH";
-	case 1657:
-		return "4iiii Innovations Inc.";
-	case 1658:
-		return "The Energy Conservatory, Inc.";
-	case 1659:
-		return "I.FARM, INC.";
-	case 1660:
-		return "Tile, Inc.";
-	case 1661:
-		return "Form Athletica Inc.";
-	case 1662:
-		return "MbientLab Inc";
-	case 1663:
-		return "NETGRID S.N.C. DI BISSOLI MATTEO, CAMPOREALE SIMONE, TOGNETTI FEDERICO";
-	case 1664:
-		return "Mannkind Corporation";
-	case 1665:
-		return "Trade FIDES a.s.";
-	case 1666:
-		return "Photron Limited";
-	case 1667:
-		return "Eltako GmbH";
-	case 1668:
-		return "Dermalapps, LLC";
-	case 1669:
-		return "Greenwald Industries";
-	case 1670:
-		return "inQs Co., Ltd.";
-	case 1671:
-		return "Cherry GmbH";
-	case 1672:
-		return "Amsted Digital Solutions Inc.";
-	case 1673:
-		return "Tacx b.v.";
-	case 1674:
-		return "Raytac Corporation";
-	case 1675:
-		return "Jiangsu Teranovo Tech Co., Ltd.";
-	case 1676:
-		return "Changzhou Sound Dragon Electronics and Acoustics Co., Ltd";
-	case 1677:
-		return "JetBeep Inc.";
-	case 1678:
-		return "Razer Inc.";
-	case 1679:
-		return "JRM Group Limited";
-	case 1680:
-		return "Eccrine Systems, Inc.";
-	case 1681:
-		return "Curie Point AB";
-	case 1682:
-		return "Georg Fischer AG";
-	case 1683:
-		return "Hach - Danaher";
-	case 1684:
-		return "T&A Laboratories LLC";
-	case 1685:
-		return "Koki Holdings Co., Ltd.";
-	case 1686:
-		return "Gunakar Private Limited";
-	case 1687:
-		return "Stemco Products Inc";
-	case 1688:
-		return "Wood IT Security, LLC";
-	case 1689:
-		return "RandomLab SAS";
-	case 1690:
-		return "Adero, Inc. (formerly as TrackR, Inc.)";
-	case 1691:
-		return "Dragonchip Limited";
-	case 1692:
-		return "Noomi AB";
-	case 1693:
-		return "Vakaros LLC";
-	case 1694:
-		return "Delta Electronics, Inc.";
-	case 1695:
-		return "FlowMotion Technologies AS";
-	case 1696:
-		return "OBIQ Location Technology Inc.";
-	case 1697:
-		return "Cardo Systems, Ltd";
-	case 1698:
-		return "Globalworx GmbH";
-	case 1699:
-		return "Nymbus, LLC";
-	case 1700:
-		return "Sanyo Techno Solutions Tottori Co., Ltd.";
-	case 1701:
-		return "TEKZITEL PTY LTD";
-	case 1702:
-		return "Roambee Corporation";
-	case 1703:
-		return "Chipsea Technologies (ShenZhen) Corp.";
-	case 1704:
-		return "GD Midea Air-Conditioning Equipment Co., Ltd.";
-	case 1705:
-		return "Soundmax Electronics Limited";
-	case 1706:
-		return "Produal Oy";
-	case 1707:
-		return "HMS Industrial Networks AB";
-	case 1708:
-		return "Ingchips Technology Co., Ltd.";
-	case 1709:
-		return "InnovaSea Systems Inc.";
-	case 1710:
-		return "SenseQ Inc.";
-	case 1711:
-		return "Shoof Technologies";
-	case 1712:
-		return "BRK Brands, Inc.";
-	case 1713:
-		return "SimpliSafe, Inc.";
-	case 1714:
-		return "Tussock Innovation 2013 Limited";
-	case 1715:
-		return "The Hablab ApS";
-	case 1716:
-		return "Sencilion Oy";
-	case 1717:
-		return "Wabilogic Ltd.";
-	case 1718:
-		return "Sociometric Solutions, Inc.";
-	case 1719:
-		return "iCOGNIZE GmbH";
-	case 1720:
-		return "ShadeCraft, Inc";
-	case 1721:
-		return "Beflex Inc.";
-	case 1722:
-		return "Beaconzone Ltd";
-	case 1723:
-		return "Leaftronix Analogic Solutions Private Limited";
-	case 1724:
-		return "TWS Srl";
-	case 1725:
-		return "ABB Oy";
-	case 1726:
-		return "HitSeed Oy";
-	case 1727:
-		return "Delcom Products Inc.";
-	case 1728:
-		return "CAME S.p.A.";
-	case 1729:
-		return "Alarm.com Holdings, Inc";
-	case 1730:
-		return "Measurlogic Inc.";
-	case 1731:
-		return "King I Electronics.Co.,Ltd";
-	case 1732:
-		return "Dream Labs GmbH";
-	case 1733:
-		return "Urban Compass, Inc";
-	case 1734:
-		return "Simm Tronic Limited";
-	case 1735:
-		return "Somatix Inc";
-	case 1736:
-		return "Storz & Bickel GmbH & Co. KG";
-	case 1737:
-		return "MYLAPS B.V.";
-	case 1738:
-		return "Shenzhen Zhongguang Infotech Technology Development Co., Ltd";
-	case 1739:
-		return "Dyeware, LLC";
-	case 1740:
-		return "Dongguan SmartAction Technology Co.,Ltd.";
-	case 1741:
-		return "DIG Corporation";
-	case 1742:
-		return "FIOR & GENTZ";
-	case 1743:
-		return "Belparts N.V.";
-	case 1744:
-		return "Etekcity Corporation";
-	case 1745:
-		return "Meyer Sound Laboratories, Incorporated";
-	case 1746:
-		return "CeoTronics AG";
-	case 1747:
-		return "TriTeq Lock and Security, LLC";
-	case 1748:
-		return "DYNAKODE TECHNOLOGY PRIVATE LIMITED";
-	case 1749:
-		return "Sensirion AG";
-	case 1750:
-		return "JCT Healthcare Pty Ltd";
-	case 1751:
-		return "FUBA Automotive Electronics GmbH";
-	case 1752:
-		return "AW Company";
-	case 1753:
-		return "Shanghai Mountain View Silicon Co.,Ltd.";
-	case 1754:
-		return "Zliide Technologies ApS";
-	case 1755:
-		return "Automatic Labs, Inc.";
-	case 1756:
-		return "Industrial Network Controls, LLC";
-	case 1757:
-		return "Intellithings Ltd.";
-	case 1758:
-		return "Navcast, Inc.";
-	case 1759:
-		return "Hubbell Lighting, Inc.";
-	case 1760:
-		return "Avaya ";
-	case 1761:
-		return "Milestone AV Technologies LLC";
-	case 1762:
-		return "Alango Technologies Ltd";
-	case 1763:
-		return "Spinlock Ltd";
-	case 1764:
-		return "Aluna";
-	case 1765:
-		return "OPTEX CO.,LTD.";
-	case 1766:
-		return "NIHON DENGYO KOUSAKU";
-	case 1767:
-		return "VELUX A/S";
-	case 1768:
-		return "Almendo Technologies GmbH";
-	case 1769:
-		return "Zmartfun Electronics, Inc.";
-	case 1770:
-		return "SafeLine Sweden AB";
-	case 1771:
-		return "Houston Radar LLC";
-	case 1772:
-		return "Sigur";
-	case 1773:
-		return "J Neades Ltd";
-	case 1774:
-		return "Avantis Systems Limited";
-	case 1775:
-		return "ALCARE Co., Ltd.";
-	case 1776:
-		return "Chargy Technologies, SL";
-	case 1777:
-		return "Shibutani Co., Ltd.";
-	case 1778:
-		return "Trapper Data AB";
-	case 1779:
-		return "Alfred International Inc.";
-	case 1780:
-		return "Near Field Solutions Ltd";
-	case 1781:
-		return "Vigil Technologies Inc.";
-	case 1782:
-		return "Vitulo Plus BV";
-	case 1783:
-		return "WILKA Schliesstechnik GmbH";
-	case 1784:
-		return "BodyPlus Technology Co.,Ltd";
-	case 1785:
-		return "happybrush GmbH";
-	case 1786:
-		return "Enequi AB";
-	case 1787:
-		return "Sartorius AG";
-	case 1788:
-		return "Tom Communication Industrial Co.,Ltd.";
-	case 1789:
-		return "ESS Embedded System Solutions Inc.";
-	case 1790:
-		return "Mahr GmbH";
-	case 1791:
-		return "Redpine Signals Inc";
-	case 1792:
-		return "TraqFreq LLC";
-	case 1793:
-		return "PAFERS TECH";
-	case 1794:
-		return "Akciju sabiedriba \"SAF TEHNIKA\"";
-	case 1795:
-		return "Beijing Jingdong Century Trading Co., Ltd.";
-	case 1796:
-		return "JBX Designs Inc.";
-	case 1797:
-		return "AB Electrolux";
-	case 1798:
-		return "Wernher von Braun Center for ASdvanced Research";
-	case 1799:
-		return "Essity Hygiene and Health Aktiebolag";
-	case 1800:
-		return "Be Interactive Co., Ltd";
-	case 1801:
-		return "Carewear Corp.";
-	case 1802:
-		return "Huf Hülsbeck & Fürst GmbH & Co. KG";
-	case 1803:
-		return "Element Products, Inc.";
-	case 1804:
-		return "Beijing Winner Microelectronics Co.,Ltd";
-	case 1805:
-		return "SmartSnugg Pty Ltd";
-	case 1806:
-		return "FiveCo Sarl";
-	case 1807:
-		return "California Things Inc.";
-	case 1808:
-		return "Audiodo AB";
-	case 1809:
-		return "ABAX AS";
-	case 1810:
-		return "Bull Group Company Limited";
-	case 1811:
-		return "Respiri Limited";
-	case 1812:
-		return "MindPeace Safety LLC";
-	case 1813:
-		return "Vgyan Solutions";
-	case 1814:
-		return "Altonics";
-	case 1815:
-		return "iQsquare BV";
-	case 1816:
-		return "IDIBAIX enginneering";
-	case 1817:
-		return "ECSG";
-	case 1818:
-		return "REVSMART WEARABLE HK CO LTD";
-	case 1819:
-		return "Precor";
-	case 1820:
-		return "F5 Sports, Inc";
-	case 1821:
-		return "exoTIC Systems";
-	case 1822:
-		return "DONGGUAN HELE ELECTRONICS CO., LTD";
-	case 1823:
-		return "Dongguan Liesheng Electronic Co.Ltd";
-	case 1824:
-		return "Oculeve, Inc.";
-	case 1825:
-		return "Clover Network, Inc.";
-	case 1826:
-		return "Xiamen Eholder Electronics Co.Ltd";
-	case 1827:
-		return "Ford Motor Company";
-	case 1828:
-		return "Guangzhou SuperSound Information Technology Co.,Ltd";
-	case 1829:
-		return "Tedee Sp. z o.o.";
-	case 1830:
-		return "PHC Corporation";
-	case 1831:
-		return "STALKIT AS";
-	case 1832:
-		return "Eli Lilly and Company";
-	case 1833:
-		return "SwaraLink Technologies";
-	case 1834:
-		return "JMR embedded systems GmbH";
-	case 1835:
-		return "Bitkey Inc.";
-	case 1836:
-		return "GWA Hygiene GmbH";
-	case 1837:
-		return "Safera Oy";
-	case 1838:
-		return "Open Platform Systems LLC";
-	case 1839:
-		return "OnePlus Electronics (Shenzhen) Co., Ltd.";
-	case 1840:
-		return "Wildlife Acoustics, Inc.";
-	case 1841:
-		return "ABLIC Inc.";
-	case 1842:
-		return "Dairy Tech, Inc.";
-	case 1843:
-		return "Iguanavation, Inc.";
-	case 1844:
-		return "DiUS Computing Pty Ltd";
-	case 1845:
-		return "UpRight Technologies LTD";
-	case 1846:
-		return "FrancisFund, LLC";
-	case 1847:
-		return "LLC Navitek";
-	case 1848:
-		return "Glass Security Pte Ltd";
-	case 1849:
-		return "Jiangsu Qinheng Co., Ltd.";
-	case 1850:
-		return "Chandler Systems Inc.";
-	case 1851:
-		return "Fantini Cosmi s.p.a.";
-	case 1852:
-		return "Acubit ApS";
-	case 1853:
-		return "Beijing Hao Heng Tian Tech Co., Ltd.";
-	case 1854:
-		return "Bluepack S.R.L.";
-	case 1855:
-		return "Beijing Unisoc Technologies Co., Ltd.";
-	case 1856:
-		return "HITIQ LIMITED";
-	case 1857:
-		return "MAC SRL";
-	case 1858:
-		return "DML LLC";
-	case 1859:
-		return "Sanofi";
-	case 1860:
-		return "SOCOMEC";
-	case 1861:
-		return "WIZNOVA, Inc.";
-	case 1862:
-		return "Seitec Elektronik GmbH";
-	case 1863:
-		return "OR Technologies Pty Ltd";
-	case 1864:
-		return "GuangZhou KuGou Computer Technology Co.Ltd";
-	case 1865:
-		return "DIAODIAO (Beijing) Technology Co., Ltd.";
-	case 1866:
-		return "Illusory Studios LLC";
-	case 1867:
-		return "Sarvavid Software Solutions LLP";
-	case 1868:
-		return "iopool s.a.";
-	case 1869:
-		return "Amtech Systems, LLC";
-	case 1870:
-		return "EAGLE DETECTION SA";
-	case 1871:
-		return "MEDIATECH S.R.L.";
-	case 1872:
-		return "Hamilton Professional Services of Canada Incorporated";
-	case 1873:
-		return "Changsha JEMO IC Design Co.,Ltd";
-	case 1874:
-		return "Elatec GmbH";
-	case 1875:
-		return "JLG Industries, Inc.";
-	case 1876:
-		return "Michael Parkin";
-	case 1877:
-		return "Brother Industries, Ltd";
-	case 1878:
-		return "Lumens For Less, Inc";
-	case 1879:
-		return "ELA Innovation";
-	case 1880:
-		return "umanSense AB";
-	case 1881:
-		return "Shanghai InGeek Cyber Security Co., Ltd.";
-	case 1882:
-		return "HARMAN CO.,LTD.";
-	case 1883:
-		return "Smart Sensor Devices AB";
-	case 1884:
-		return "Antitronics Inc.";
-	case 1885:
-		return "RHOMBUS SYSTEMS, INC.";
-	case 1886:
-		return "Katerra Inc.";
-	case 1887:
-		return "Remote Solution Co., LTD.";
-	case 1888:
-		return "Vimar SpA";
-	case 1889:
-		return "Mantis Tech LLC";
-	case 1890:
-		return "TerOpta Ltd";
-	case 1891:
-		return "PIKOLIN S.L.";
-	case 1892:
-		return "WWZN Information Technology Company Limited";
-	case 1893:
-		return "Voxx International";
-	case 1894:
-		return "ART AND PROGRAM, INC.";
-	case 1895:
-		return "NITTO DENKO ASIA TECHNICAL CENTRE PTE. LTD.";
-	case 1896:
-		return "Peloton Interactive Inc.";
-	case 1897:
-		return "Force Impact Technologies";
-	case 1898:
-		return "Dmac Mobile Developments, LLC";
-	case 1899:
-		return "Engineered Medical Technologies";
-	case 1900:
-		return "Noodle Technology inc";
-	case 1901:
-		return "Graesslin GmbH";
-	case 1902:
-		return "WuQi technologies, Inc.";
-	case 1903:
-		return "Successful Endeavours Pty Ltd";
-	case 1904:
-		return "InnoCon Medical ApS";
-	case 1905:
-		return "Corvex Connected Safety";
-	case 1906:
-		return "Thirdwayv Inc.";
-	case 1907:
-		return "Echoflex Solutions Inc.";
-	case 1908:
-		return "C-MAX Asia Limited";
-	case 1909:
-		return "4eBusiness GmbH";
-	case 1910:
-		return "Cyber Transport Control GmbH";
-	case 1911:
-		return "Cue";
-	case 1912:
-		return "KOAMTAC INC.";
-	case 1913:
-		return "Loopshore Oy";
-	case 1914:
-		return "Niruha Systems Private Limited";
-	case 1915:
-		return "AmaterZ, Inc.";
-	case 1916:
-		return "radius co., ltd.";
-	case 1917:
-		return "Sensority, s.r.o.";
-	case 1918:
-		return "Sparkage Inc.";
-	case 1919:
-		return "Glenview Software Corporation";
-	case 1920:
-		return "Finch Technologies Ltd.";
-	case 1921:
-		return "Qingping Technology (Beijing) Co., Ltd.";
-	case 1922:
-		return "DeviceDrive AS";
-	case 1923:
-		return "ESEMBER LIMITED LIABILITY COMPANY";
-	case 1924:
-		return "audifon GmbH & Co. KG";
-	case 1925:
-		return "O2 Micro, Inc.";
-	case 1926:
-		return "HLP Controls Pty Limited";
-	case 1927:
-		return "Pangaea Solution";
-	case 1928:
-		return "BubblyNet, LLC";
-	case 1930:
-		return "The Wildflower Foundation";
-	case 1931:
-		return "Optikam Tech Inc.";
-	case 1932:
-		return "MINIBREW HOLDING B.V";
-	case 1933:
-		return "Cybex GmbH";
-	case 1934:
-		return "FUJIMIC NIIGATA, INC.";
-	case 1935:
-		return "Hanna Instruments, Inc.";
-	case 1936:
-		return "KOMPAN A/S";
-	case 1937:
-		return "Scosche Industries, Inc.";
-	case 1938:
-		return "Provo Craft";
-	case 1939:
-		return "AEV spol. s r.o.";
-	case 1940:
-		return "The Coca-Cola Company";
-	case 1941:
-		return "GASTEC CORPORATION";
-	case 1942:
-		return "StarLeaf Ltd";
-	case 1943:
-		return "Water-i.d. GmbH";
-	case 1944:
-		return "HoloKit, Inc.";
-	case 1945:
-		return "PlantChoir Inc.";
-	case 1946:
-		return "GuangDong Oppo Mobile Telecommunications Corp., Ltd.";
-	case 1947:
-		return "CST ELECTRONICS (PROPRIETARY) LIMITED";
-	case 1948:
-		return "Sky UK Limited";
-	case 1949:
-		return "Digibale Pty Ltd";
-	case 1950:
-		return "Smartloxx GmbH";
-	case 1951:
-		return "Pune Scientific LLP";
-	case 1952:
-		return "Regent Beleuchtungskorper AG";
-	case 1953:
-		return "Apollo Neuroscience, Inc.";
-	case 1954:
-		return "Roku, Inc.";
-	case 1955:
-		return "Comcast Cable";
-	case 1956:
-		return "Xiamen Mage Information Technology Co., Ltd.";
-	case 1957:
-		return "RAB Lighting, Inc.";
-	case 1958:
-		return "Musen Connect, Inc.";
-	case 1959:
-		return "Zume, Inc.";
-	case 1960:
-		return "conbee GmbH";
-	case 1961:
-		return "Bruel & Kjaer Sound & Vibration";
-	case 1962:
-		return "The Kroger Co.";
-	case 1963:
-		return "Granite River Solutions, Inc.";
-	case 1964:
-		return "LoupeDeck Oy";
-	case 1965:
-		return "New H3C Technologies Co.,Ltd";
-	case 1966:
-		return "Aurea Solucoes Tecnologicas Ltda.";
-	case 1967:
-		return "Hong Kong Bouffalo Lab Limited";
-	case 1968:
-		return "GV Concepts Inc.";
-	case 1969:
-		return "Thomas Dynamics, LLC";
-	case 1970:
-		return "Moeco IOT Inc.";
-	case 1971:
-		return "2N TELEKOMUNIKACE a.s.";
-	case 1972:
-		return "Hormann KG Antriebstechnik";
-	case 1973:
-		return "CRONO CHIP, S.L.";
-	case 1974:
-		return "Soundbrenner Limited";
-	case 1975:
-		return "ETABLISSEMENTS GEORGES RENAULT";
-	case 1976:
-		return "iSwip";
-	case 1977:
-		return "Epona Biotec Limited";
-	case 1978:
-		return "Battery-Biz Inc.";
-	case 1979:
-		return "EPIC S.R.L.";
-	case 1980:
-		return "KD CIRCUITS LLC";
-	case 1981:
-		return "Genedrive Diagnostics Ltd";
-	case 1982:
-		return "Axentia Technologies AB";
-	case 1983:
-		return "REGULA Ltd.";
-	case 1984:
-		return "Biral AG";
-	case 1985:
-		return "A.W. Chesterton Company";
-	case 1986:
-		return "Radinn AB";
-	case 1987:
-		return "CIMTechniques, Inc.";
-	case 1988:
-		return "Johnson Health Tech NA";
-	case 1989:
-		return "June Life, Inc.";
-	case 1990:
-		return "Bluenetics GmbH";
-	case 1991:
-		return "iaconicDesign Inc.";
-	case 1992:
-		return "WRLDS Creations AB";
-	case 1993:
-		return "Skullcandy, Inc.";
-	case 1994:
-		return "Modul-System HH AB";
-	case 1995:
-		return "West Pharmaceutical Services, Inc.";
-	case 1996:
-		return "Barnacle Systems Inc.";
-	case 1997:
-		return "Smart Wave Technologies Canada Inc";
-	case 1998:
-		return "Shanghai Top-Chip Microelectronics Tech. Co., LTD";
-	case 1999:
-		return "NeoSensory, Inc.";
-	case 2000:
-		return "Hangzhou Tuya Information  Technology Co., Ltd";
-	case 2001:
-		return "Shanghai Panchip Microelectronics Co., Ltd";
-	case 2002:
-		return "React Accessibility Limited";
-	case 2003:
-		return "LIVNEX Co.,Ltd.";
-	case 2004:
-		return "Kano Computing Limited";
-	case 2005:
-		return "hoots classic GmbH";
-	case 2006:
-		return "ecobee Inc.";
-	case 2007:
-		return "Nanjing Qinheng Microelectronics Co., Ltd";
-	case 2008:
-		return "SOLUTIONS AMBRA INC.";
-	case 2009:
-		return "Micro-Design, Inc.";
-	case 2010:
-		return "STARLITE Co., Ltd.";
-	case 2011:
-		return "Remedee Labs";
-	case 2012:
-		return "ThingOS GmbH";
-	case 2013:
-		return "Linear Circuits";
-	case 2014:
-		return "Unlimited Engineering SL";
-	case 2015:
-		return "Snap-on Incorporated";
-	case 2016:
-		return "Edifier International Limited";
-	case 2017:
-		return "Lucie Labs";
-	case 2018:
-		return "Alfred Kaercher SE & Co. KG";
-	case 2019:
-		return "Audiowise Technology Inc.";
-	case 2020:
-		return "Geeksme S.L.";
-	case 2021:
-		return "Minut, Inc.";
-	case 2022:
-		return "Autogrow Systems Limited";
-	case 2023:
-		return "Komfort IQ, Inc.";
-	case 2024:
-		return "Packetcraft, Inc.";
-	case 2025:
-		return "Häfele GmbH & Co KG";
-	case 2026:
-		return "ShapeLog, Inc.";
-	case 2027:
-		return "NOVABASE S.R.L.";
-	case 2028:
-		return "Frecce LLC";
-	case 2029:
-		return "Joule IQ, INC.";
-	case 2030:
-		return "KidzTek LLC";
-	case 2031:
-		return "Aktiebolaget Sandvik Coromant";
-	case 2032:
-		return "e-moola.com Pty Ltd";
-	case 2033:
-		return "GSM Innovations Pty Ltd";
-	case 2034:
-		return "SERENE GROUP, INC";
-	case 2035:
-		return "DIGISINE ENERGYTECH CO. LTD.";
-	case 2036:
-		return "MEDIRLAB Orvosbiologiai Fejleszto Korlatolt Felelossegu Tarsasag";
-	case 2037:
-		return "Byton North America Corporation";
-	case 2038:
-		return "Shenzhen TonliScience and Technology Development Co.,Ltd";
-	case 2039:
-		return "Cesar Systems Ltd.";
-	case 2040:
-		return "quip NYC Inc.";
-	case 2041:
-		return "Direct Communication Solutions, Inc.";
-	case 2042:
-		return "Klipsch Group, Inc.";
-	case 2043:
-		return "Access Co., Ltd";
-	case 2044:
-		return "Renault SA";
-	case 2045:
-		return "JSK CO., LTD.";
-	case 2046:
-		return "BIROTA";
-	case 2047:
-		return "maxon motor ltd.";
-	case 2048:
-		return "Optek";
-	case 2049:
-		return "CRONUS ELECTRONICS LTD";
-	case 2050:
-		return "NantSound, Inc.";
-	case 2051:
-		return "Domintell s.a.";
-	case 2052:
-		return "Andon Health Co.,Ltd";
-	case 2053:
-		return "Urbanminded Ltd";
-	case 2054:
-		return "TYRI Sweden AB";
-	case 2055:
-		return "ECD Electronic Components GmbH Dresden";
-	case 2056:
-		return "SISTEMAS KERN, SOCIEDAD ANÓMINA";
-	case 2057:
-		return "Trulli Audio";
-	case 2058:
-		return "Altaneos";
-	case 2059:
-		return "Nanoleaf Canada Limited";
-	case 2060:
-		return "Ingy B.V.";
-	case 2061:
-		return "Azbil Co.";
-	case 2062:
-		return "TATTCOM LLC";
-	case 2063:
-		return "Paradox Engineering SA";
-	case 2064:
-		return "LECO Corporation";
-	case 2065:
-		return "Becker Antriebe GmbH";
-	case 2066:
-		return "Mstream Technologies., Inc.";
-	case 2067:
-		return "Flextronics International USA Inc.";
-	case 2068:
-		return "Ossur hf.";
-	case 2069:
-		return "SKC Inc";
-	case 2070:
-		return "SPICA SYSTEMS LLC";
-	case 2071:
-		return "Wangs Alliance Corporation";
-	case 2072:
-		return "tatwah SA";
-	case 2073:
-		return "Hunter Douglas Inc";
-	case 2074:
-		return "Shenzhen Conex";
-	case 2075:
-		return "DIM3";
-	case 2076:
-		return "Bobrick Washroom Equipment, Inc.";
-	case 2077:
-		return "Potrykus Holdings and Development LLC";
-	case 2078:
-		return "iNFORM Technology GmbH";
-	case 2079:
-		return "eSenseLab LTD";
-	case 2080:
-		return "Brilliant Home Technology, Inc.";
-	case 2081:
-		return "INOVA Geophysical, Inc.";
-	case 2082:
-		return "adafruit industries";
-	case 2083:
-		return "Nexite Ltd";
-	case 2084:
-		return "8Power Limited";
-	case 2085:
-		return "CME PTE. LTD.";
-	case 2086:
-		return "Hyundai Motor Company";
-	case 2087:
-		return "Kickmaker";
-	case 2088:
-		return "Shanghai Suisheng Information Technology Co., Ltd.";
-	case 2089:
-		return "HEXAGON";
-	case 2090:
-		return "Mitutoyo Corporation";
-	case 2091:
-		return "shenzhen fitcare electronics Co.,Ltd";
-	case 2092:
-		return "INGICS TECHNOLOGY CO., LTD.";
-	case 2093:
-		return "INCUS PERFORMANCE LTD.";
-	case 2094:
-		return "ABB S.p.A.";
-	case 2095:
-		return "Blippit AB";
-	case 2096:
-		return "Core Health and Fitness LLC";
-	case 2097:
-		return "Foxble, LLC";
-	case 2098:
-		return "Intermotive,Inc.";
-	case 2099:
-		return "Conneqtech B.V.";
-	case 2100:
-		return "RIKEN KEIKI CO., LTD.,";
-	case 2101:
-		return "Canopy Growth Corporation";
-	case 2102:
-		return "Bitwards Oy";
-	case 2103:
-		return "vivo Mobile Communication Co., Ltd.";
-	case 2104:
-		return "Etymotic Research, Inc.";
-	case 2105:
-		return "A puissance 3";
-	case 2106:
-		return "BPW Bergische Achsen Kommanditgesellschaft";
-	case 2107:
-		return "Piaggio Fast Forward";
-	case 2108:
-		return "BeerTech LTD";
-	case 2109:
-		return "Tokenize, Inc.";
-	case 2110:
-		return "Zorachka LTD";
-	case 2111:
-		return "D-Link Corp.";
-	case 2112:
-		return "Down Range Systems LLC";
-	case 2113:
-		return "General Luminaire (Shanghai) Co., Ltd.";
-	case 2114:
-		return "Tangshan HongJia electronic technology co., LTD.";
-	case 2115:
-		return "FRAGRANCE DELIVERY TECHNOLOGIES LTD";
-	case 2116:
-		return "Pepperl + Fuchs GmbH";
-	case 2117:
-		return "Dometic Corporation";
-	case 2118:
-		return "USound GmbH";
-	case 2119:
-		return "DNANUDGE LIMITED";
-	case 2120:
-		return "JUJU JOINTS CANADA CORP.";
-	case 2121:
-		return "Dopple Technologies B.V.";
-	case 2122:
-		return "ARCOM";
-	case 2123:
-		return "Biotechware SRL";
-	case 2124:
-		return "ORSO Inc.";
-	case 2125:
-		return "SafePort";
-	case 2126:
-		return "Carol Cole Company";
-	case 2127:
-		return "Embedded Fitness B.V.";
-	case 2128:
-		return "Yealink (Xiamen) Network Technology Co.,LTD";
-	case 2129:
-		return "Subeca, Inc.";
-	case 2130:
-		return "Cognosos, Inc.";
-	case 2131:
-		return "Pektron Group Limited";
-	case 2132:
-		return "Tap Sound System";
-	case 2133:
-		return "Helios Hockey, Inc.";
-	case 2134:
-		return "Canopy Growth Corporation";
-	case 2135:
-		return "Parsyl Inc";
-	case 2136:
-		return "SOUNDBOKS";
-	case 2137:
-		return "BlueUp";
-	case 2138:
-		return "DAKATECH";
-	case 2139:
-		return "RICOH ELECTRONIC DEVICES CO., LTD.";
-	case 2140:
-		return "ACOS CO.,LTD.";
-	case 2141:
-		return "Guilin Zhishen Information Technology Co.,Ltd.";
-	case 2142:
-		return "Krog Systems LLC";
-	case 2143:
-		return "COMPEGPS TEAM,SOCIEDAD LIMITADA";
-	case 2144:
-		return "Alflex Products B.V.";
-	case 2145:
-		return "SmartSensor Labs Ltd";
-	case 2146:
-		return "SmartDrive Inc.";
-	case 2147:
-		return "Yo-tronics Technology Co., Ltd.";
-	case 2148:
-		return "Rafaelmicro";
-	case 2149:
-		return "Emergency Lighting Products Limited";
-	case 2150:
-		return "LAONZ Co.,Ltd";
-	case 2151:
-		return "Western Digital Techologies, Inc.";
-	case 2152:
-		return "WIOsense GmbH & Co. KG";
-	case 2153:
-		return "EVVA Sicherheitstechnologie GmbH";
-	case 2154:
-		return "Odic Incorporated";
-	case 2155:
-		return "Pacific Track, LLC";
-	case 2156:
-		return "Revvo Technologies, Inc.";
-	case 2157:
-		return "Biometrika d.o.o.";
-	case 2158:
-		return "Vorwerk Elektrowerke GmbH & Co. KG";
-	case 2159:
-		return "Trackunit A/S";
-	case 2160:
-		return "Wyze Labs, Inc";
-	case 2161:
-		return "Dension Elektronikai Kft. (formerly: Dension Audio Systems Ltd.)";
-	case 2162:
-		return "11 Health & Technologies Limited";
-	case 2163:
-		return "Innophase Incorporated";
-	case 2164:
-		return "Treegreen Limited";
-	case 2165:
-		return "Berner International LLC";
-	case 2166:
-		return "SmartResQ ApS";
-	case 2167:
-		return "Tome, Inc.";
-	case 2168:
-		return "The Chamberlain Group, Inc.";
-	case 2169:
-		return "MIZUNO Corporation";
-	case 2170:
-		return "ZRF, LLC";
-	case 2171:
-		return "BYSTAMP";
-	case 2172:
-		return "Crosscan GmbH";
-	case 2173:
-		return "Konftel AB";
-	case 2174:
-		return "1bar.net Limited";
-	case 2175:
-		return "Phillips Connect Technologies LLC";
-	case 2176:
-		return "imagiLabs AB";
-	case 2177:
-		return "Optalert";
-	case 2178:
-		return "PSYONIC, Inc.";
-	case 2179:
-		return "Wintersteiger AG";
-	case 2180:
-		return "Controlid Industria, Comercio de Hardware e Servicos de Tecnologia Ltda";
-	case 2181:
-		return "LEVOLOR, INC.";
-	case 2182:
-		return "Xsens Technologies B.V.";
-	case 2183:
-		return "Hydro-Gear Limited Partnership";
-	case 2184:
-		return "EnPointe Fencing Pty Ltd";
-	case 2185:
-		return "XANTHIO";
-	case 2186:
-		return "sclak s.r.l.";
-	case 2187:
-		return "Tricorder Arraay Technologies LLC";
-	case 2188:
-		return "GB Solution co.,Ltd";
-	case 2189:
-		return "Soliton Systems K.K.";
-	case 2190:
-		return "GIGA-TMS INC";
-	case 2191:
-		return "Tait International Limited";
-	case 2192:
-		return "NICHIEI INTEC CO., LTD.";
-	case 2193:
-		return "SmartWireless GmbH & Co. KG";
-	case 2194:
-		return "Ingenieurbuero Birnfeld UG (haftungsbeschraenkt)";
-	case 2195:
-		return "Maytronics Ltd";
-	case 2196:
-		return "EPIFIT";
-	case 2197:
-		return "Gimer medical";
-	case 2198:
-		return "Nokian Renkaat Oyj";
-	case 2199:
-		return "Current Lighting Solutions LLC";
-	case 2200:
-		return "Sensibo, Inc.";
-	case 2201:
-		return "SFS unimarket AG";
-	case 2202:
-		return "Private limited company \"Teltonika\"";
-	case 2203:
-		return "Saucon Technologies";
-	case 2204:
-		return "Embedded Devices Co. Company";
-	case 2205:
-		return "J-J.A.D.E. Enterprise LLC";
-	case 2206:
-		return "i-SENS, inc.";
-	case 2207:
-		return "Witschi Electronic Ltd";
-	case 2208:
-		return "Aclara Technologies LLC";
-	case 2209:
-		return "EXEO TECH CORPORATION";
-	case 2210:
-		return "Epic Systems Co., Ltd.";
-	case 2211:
-		return "Hoffmann SE";
-	case 2212:
-		return "Realme Chongqing Mobile Telecommunications Corp., Ltd.";
-	case 2213:
-		return "UMEHEAL Ltd";
-	case 2214:
-		return "Intelligenceworks Inc.";
-	case 2215:
-		return "TGR 1.618 Limited";
-	case 2216:
-		return "Shanghai Kfcube Inc";
-	case 2217:
-		return "Fraunhofer IIS";
-	case 2218:
-		return "SZ DJI TECHNOLOGY CO.,LTD";
-	case 2219:
-		return "Coburn Technology, LLC";
-	case 2220:
-		return "Topre Corporation";
-	case 2221:
-		return "Kayamatics Limited";
-	case 2222:
-		return "Moticon ReGo AG";
-	case 2223:
-		return "Polidea Sp. z o.o.";
-	case 2224:
-		return "Trivedi Advanced Technologies LLC";
-	case 2225:
-		return "CORE|vision BV";
-	case 2226:
-		return "PF SCHWEISSTECHNOLOGIE GMBH";
-	case 2227:
-		return "IONIQ Skincare GmbH & Co. KG";
-	case 2228:
-		return "Sengled Co., Ltd.";
-	case 2229:
-		return "TransferFi";
-	case 2230:
-		return "Boehringer Ingelheim Vetmedica GmbH";
-	case 2231:
-		return "ABB Inc";
-	case 2232:
-		return "Check Technology Solutions LLC";
-	case 2233:
-		return "U-Shin Ltd.";
-	case 2234:
-		return "HYPER ICE, INC.";
-	case 2235:
-		return "Tokai-rika co.,ltd.";
-	case 2236:
-		return "Prevayl Limited";
-	case 2237:
-		return "bf1systems limited";
-	case 2238:
-		return "ubisys technologies GmbH";
-	case 2239:
-		return "SIRC Co., Ltd.";
-	case 2240:
-		return "Accent Advanced Systems SLU";
-	case 2241:
-		return "Rayden.Earth LTD";
-	case 2242:
-		return "Lindinvent AB";
-	case 2243:
-		return "CHIPOLO d.o.o.";
-	case 2244:
-		return "CellAssist, LLC";
-	case 2245:
-		return "J. Wagner GmbH";
-	case 2246:
-		return "Integra Optics Inc";
-	case 2247:
-		return "Monadnock Systems Ltd.";
-	case 2248:
-		return "Liteboxer Technologies Inc.";
-	case 2249:
-		return "Noventa AG";
-	case 2250:
-		return "Nubia Technology Co.,Ltd.";
-	case 2251:
-		return "JT INNOVATIONS LIMITED";
-	case 2252:
-		return "TGM TECHNOLOGY CO., LTD.";
-	case 2253:
-		return "ifly";
-	case 2254:
-		return "ZIMI CORPORATION";
-	case 2255:
-		return "betternotstealmybike UG (with limited liability)";
-	case 2256:
-		return "ESTOM Infotech Kft.";
-	case 2257:
-		return "Sensovium Inc.";
-	case 2258:
-		return "Virscient Limited";
-	case 2259:
-		return "Novel Bits, LLC";
-	case 2260:
-		return "ADATA Technology Co., LTD.";
-	case 2261:
-		return "KEYes";
-	case 2262:
-		return "Nome Oy";
-	case 2263:
-		return "Inovonics Corp";
-	case 2264:
-		return "WARES";
-	case 2265:
-		return "Pointr Labs Limited";
-	case 2266:
-		return "Miridia Technology Incorporated";
-	case 2267:
-		return "Tertium Technology";
-	case 2268:
-		return "SHENZHEN AUKEY E BUSINESS CO., LTD";
-	case 2269:
-		return "code-Q";
-	case 2270:
-		return "Tyco Electronics Corporation a TE Connectivity Ltd Company";
-	case 2271:
-		return "IRIS OHYAMA CO.,LTD.";
-	case 2272:
-		return "Philia Technology";
-	case 2273:
-		return "KOZO KEIKAKU ENGINEERING Inc.";
-	case 2274:
-		return "Shenzhen Simo Technology co. LTD";
-	case 2275:
-		return "Republic Wireless, Inc.";
-	case 2276:
-		return "Rashidov ltd";
-	case 2277:
-		return "Crowd Connected Ltd";
-	case 2278:
-		return "Eneso Tecnologia de Adaptacion S.L.";
-	case 2279:
-		return "Barrot Technology Limited";
-	case 2280:
-		return "Naonext";
-	case 2281:
-		return "Taiwan Intelligent Home Corp.";
-	case 2282:
-		return "COWBELL ENGINEERING CO.,LTD.";
-	case 2283:
-		return "Beijing Big Moment Technology Co., Ltd.";
-	case 2284:
-		return "Denso Corporation";
-	case 2285:
-		return "IMI Hydronic Engineering International SA";
-	case 2286:
-		return "ASKEY";
-	case 2287:
-		return "Cumulus Digital Systems, Inc";
-	case 2288:
-		return "Joovv, Inc.";
-	case 2289:
-		return "The L.S. Starrett Company";
-	case 2290:
-		return "Microoled";
-	case 2291:
-		return "PSP - Pauli Services & Products GmbH";
-	case 2292:
-		return "Kodimo Technologies Company Limited";
-	case 2293:
-		return "Tymtix Technologies Private Limited";
-	case 2294:
-		return "Dermal Photonics Corporation";
-	case 2295:
-		return "MTD Products Inc & Affiliates";
-	case 2296:
-		return "instagrid GmbH";
-	case 2297:
-		return "Spacelabs Medical Inc.";
-	case 2298:
-		return "Troo Corporation";
-	case 2299:
-		return "Darkglass Electronics Oy";
-	case 2300:
-		return "Hill-Rom";
-	case 2301:
-		return "BioIntelliSense, Inc.";
-	case 2302:
-		return "Ketronixs Sdn Bhd";
-	case 2308:
-		return "SUNCORPORATION";
-	case 2309:
-		return "Yandex Services AG";
-	case 2310:
-		return "Scope Logistical Solutions";
-	case 2311:
-		return "User Hello, LLC";
-	case 2312:
-		return "Pinpoint Innovations Limited";
-	case 2313:
-		return "70mai Co.,Ltd.";
-	case 2314:
-		return "Zhuhai Hoksi Technology CO.,LTD";
-	case 2315:
-		return "EMBR labs, INC";
-	case 2316:
-		return "Radiawave Technologies Co.,Ltd.";
-	case 2317:
-		return "IOT Invent GmbH";
-	case 2318:
-		return "OPTIMUSIOT TECH LLP";
-	case 2319:
-		return "VC Inc.";
-	case 2320:
-		return "ASR Microelectronics (Shanghai) Co., Ltd.";
-	case 2321:
-		return "Douglas Lighting Controls Inc.";
-	case 2322:
-		return "Nerbio Medical Software Platforms Inc";
-	case 2323:
-		return "Braveheart Wireless, Inc.";
-	case 2324:
-		return "INEO-SENSE";
-	case 2325:
-		return "Honda Motor Co., Ltd.";
-	case 2326:
-		return "Ambient Sensors LLC";
-	case 2327:
-		return "ASR Microelectronics(ShenZhen)Co., Ltd.";
-	case 2328:
-		return "Technosphere Labs Pvt. Ltd.";
-	case 2329:
-		return "NO SMD LIMITED";
-	case 2330:
-		return "Albertronic BV";
-	case 2331:
-		return "Luminostics, Inc.";
-	case 2332:
-		return "Oblamatik AG";
-	case 2333:
-		return "Innokind, Inc.";
-	case 2334:
-		return "Melbot Studios, Sociedad Limitada";
-	case 2335:
-		return "Myzee Technology";
-	case 2336:
-		return "Omnisense Limited";
-	case 2337:
-		return "KAHA PTE. LTD.";
-	case 2338:
-		return "Shanghai MXCHIP Information Technology Co., Ltd.";
-	case 2339:
-		return "JSB TECH PTE LTD";
-	case 2340:
-		return "Fundacion Tecnalia Research and Innovation";
-	case 2341:
-		return "Yukai Engineering Inc.";
-	case 2342:
-		return "Gooligum Technologies Pty Ltd";
-	case 2343:
-		return "ROOQ GmbH";
-	case 2344:
-		return "AiRISTA";
-	case 2345:
-		return "Qingdao Haier Technology Co., Ltd.";
-	case 2346:
-		return "Sappl Verwaltungs- und Betriebs GmbH";
-	case 2347:
-		return "TekHome";
-	case 2348:
-		return "PCI Private Limited";
-	case 2349:
-		return "Leggett & Platt, Incorporated";
-	case 2350:
-		return "PS GmbH";
-	case 2351:
-		return "C.O.B.O. SpA";
-	case 2352:
-		return "James Walker RotaBolt Limited";
-	case 2353:
-		return "BREATHINGS Co., Ltd.";
-	case 2354:
-		return "BarVision, LLC";
-	case 2355:
-		return "SRAM";
-	case 2356:
-		return "KiteSpring Inc.";
-	case 2357:
-		return "Reconnect, Inc.";
-	case 2358:
-		return "Elekon AG";
-	case 2359:
-		return "RealThingks GmbH";
-	case 2360:
-		return "Henway Technologies, LTD.";
-	case 2361:
-		return "ASTEM Co.,Ltd.";
-	case 2362:
-		return "LinkedSemi Microelectronics (Xiamen) Co., Ltd";
-	case 2363:
-		return "ENSESO LLC";
-	case 2364:
-		return "Xenoma Inc.";
-	case 2365:
-		return "Adolf Wuerth GmbH & Co KG";
-	case 2366:
-		return "Catalyft Labs, Inc.";
-	case 2367:
-		return "JEPICO Corporation";
-	case 2368:
-		return "Hero Workout GmbH";
-	case 2369:
-		return "Rivian Automotive, LLC";
-	case 2370:
-		return "TRANSSION HOLDINGS LIMITED";
-	case 2371:
-		return "Inovonics Corp.";
-	case 2372:
-		return "Agitron d.o.o.";
-	case 2373:
-		return "Globe (Jiangsu) Co., Ltd";
-	case 2374:
-		return "AMC International Alfa Metalcraft Corporation AG";
-	case 2375:
-		return "First Light Technologies Ltd.";
-	case 2376:
-		return "Wearable Link Limited";
-	case 2377:
-		return "Metronom Health Europe";
-	case 2378:
-		return "Zwift, Inc.";
-	case 2379:
-		return "Kindeva Drug Delivery L.P.";
-	case 2380:
-		return "GimmiSys GmbH";
-	case 2381:
-		return "tkLABS INC.";
-	case 2382:
-		return "PassiveBolt, Inc.";
-	case 2383:
-		return "Limited Liability Company \"Mikrotikls\"";
-	case 2384:
-		return "Capetech";
-	case 2385:
-		return "PPRS";
-	case 2386:
-		return "Apptricity Corporation";
-	case 2387:
-		return "LogiLube, LLC";
-	case 2388:
-		return "Julbo";
-	case 2389:
-		return "Breville Group";
-	case 2390:
-		return "Kerlink";
-	case 2391:
-		return "Ohsung Electronics";
-	case 2392:
-		return "ZTE Corporation";
-	case 65535:
+	if (compid == 65535)
 		return "internal use";
-	default:
+
+	if (compid < 0 ||
+			compid >= (int) (sizeof(compids) / sizeof(compids[0])))
 		return "not assigned";
-	}
+
+	return compids[compid] ? compids[compid] : "not assigned";
 }
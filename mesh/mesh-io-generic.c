@@ -112,9 +112,10 @@ static void process_rx(struct mesh_io_private *pvt, int8_t rssi,
 	l_queue_foreach(pvt->rx_regs, process_rx_callbacks, &rx);
 }
 
-static void event_adv_report(struct mesh_io *io, const void *buf, uint8_t size)
+static void event_adv_report(const void *buf, uint8_t size, void *user_data)
 {
 	const struct bt_hci_evt_le_adv_report *evt = buf;
+	struct mesh_io *io = user_data;
 	const uint8_t *adv;
 	const uint8_t *addr;
 	uint32_t instant;
@@ -153,21 +154,6 @@ static void event_adv_report(struct mesh_io *io, const void *buf, uint8_t size)
 	}
 }
 
-static void event_callback(const void *buf, uint8_t size, void *user_data)
-{
-	uint8_t event = l_get_u8(buf);
-	struct mesh_io *io = user_data;
-
-	switch (event) {
-	case BT_HCI_EVT_LE_ADV_REPORT:
-		event_adv_report(io, buf + 1, size - 1);
-		break;
-
-	default:
-		l_debug("Other Meta Evt - %d", event);
-	}
-}
-
 static void local_commands_callback(const void *data, uint8_t size,
 							void *user_data)
 {
@@ -402,8 +388,8 @@ static void hci_init(void *user_data)
 	if (result) {
 		configure_hci(io->pvt);
 
-		bt_hci_register(io->pvt->hci, BT_HCI_EVT_LE_META_EVENT,
-						event_callback, io, NULL);
+		bt_hci_register_le_meta(io->pvt->hci, BT_HCI_EVT_LE_ADV_REPORT,
+						event_adv_report, io, NULL);
 
 		l_debug("Started mesh on hci %u", io->pvt->index);
 
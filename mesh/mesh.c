@@ -15,6 +15,8 @@
 #define _GNU_SOURCE
 #include <ell/ell.h>
 
+#include "src/shared/ecc-pool.h"
+
 #include "mesh/mesh-io.h"
 #include "mesh/node.h"
 #include "mesh/net.h"
@@ -34,6 +36,7 @@
 #define DEFAULT_PROV_TIMEOUT 60
 #define DEFAULT_CRPL 100
 #define DEFAULT_FRIEND_QUEUE_SZ 32
+#define DEFAULT_KEY_POOL_DEPTH 4
 
 #define DEFAULT_ALGORITHMS 0x0001
 
@@ -44,6 +47,7 @@ struct scan_filter {
 
 struct bt_mesh {
 	struct mesh_io *io;
+	struct ecc_pool *key_pool;
 	struct l_queue *filters;
 	prov_rx_cb_t prov_rx;
 	void *prov_data;
@@ -58,6 +62,7 @@ struct bt_mesh {
 	uint16_t req_index;
 	uint8_t friend_queue_sz;
 	uint8_t max_filters;
+	uint8_t key_pool_depth;
 	bool initialized;
 };
 
@@ -84,6 +89,7 @@ static struct bt_mesh mesh = {
 	.proxy_support = false,
 	.crpl = DEFAULT_CRPL,
 	.friend_queue_sz = DEFAULT_FRIEND_QUEUE_SZ,
+	.key_pool_depth = DEFAULT_KEY_POOL_DEPTH,
 	.initialized = false
 };
 
@@ -203,6 +209,11 @@ uint8_t mesh_get_friend_queue_size(void)
 	return mesh.friend_queue_sz;
 }
 
+struct ecc_pool *mesh_get_key_pool(void)
+{
+	return mesh.key_pool;
+}
+
 static void parse_settings(const char *mesh_conf_fname)
 {
 	struct l_settings *settings;
@@ -245,6 +256,10 @@ static void parse_settings(const char *mesh_conf_fname)
 	if (l_settings_get_uint(settings, "General", "ProvTimeout", &value))
 		mesh.prov_timeout = value;
 
+	if (l_settings_get_uint(settings, "General", "KeyPoolDepth", &value)
+								&& value <= 32)
+		mesh.key_pool_depth = value;
+
 done:
 	l_settings_free(settings);
 }
@@ -278,6 +293,9 @@ bool mesh_init(const char *config_dir, const char *mesh_conf_fname,
 	if (!node_load_from_storage(storage_dir))
 		return false;
 
+	/* Ephemeral provisioning keys, generated off the main loop */
+	mesh.key_pool = ecc_pool_new(mesh.key_pool_depth);
+
 	req = l_new(struct mesh_init_request, 1);
 	req->cb = cb;
 	req->user_data = user_data;
@@ -330,6 +348,9 @@ void mesh_cleanup(void)
 
 	mesh_io_destroy(mesh.io);
 
+	ecc_pool_free(mesh.key_pool);
+	mesh.key_pool = NULL;
+
 	if (join_pending) {
 
 		if (join_pending->msg) {
@@ -20,6 +20,7 @@
 #define ERROR_INTERFACE "org.bluez.mesh.Error"
 
 enum mesh_io_type;
+struct ecc_pool;
 
 typedef void (*mesh_ready_func_t)(void *user_data, bool success);
 typedef void (*prov_rx_cb_t)(void *user_data, const uint8_t *data,
@@ -43,3 +44,4 @@ bool mesh_relay_supported(void);
 bool mesh_friendship_supported(void);
 uint16_t mesh_get_crpl(void);
 uint8_t mesh_get_friend_queue_size(void);
+struct ecc_pool *mesh_get_key_pool(void);
@@ -15,6 +15,7 @@
 #include <ell/ell.h>
 
 #include "src/shared/ecc.h"
+#include "src/shared/ecc-pool.h"
 
 #include "mesh/mesh-defs.h"
 #include "mesh/util.h"
@@ -423,7 +424,8 @@ static void acp_prov_rx(void *user_data, const uint8_t *data, uint16_t len)
 			}
 		} else {
 			/* Ephemeral Public Key requested */
-			ecc_make_key(prov->conf_inputs.dev_pub_key,
+			ecc_pool_get(mesh_get_key_pool(),
+					prov->conf_inputs.dev_pub_key,
 					prov->private_key);
 			swap_u256_bytes(prov->conf_inputs.dev_pub_key);
 			swap_u256_bytes(prov->conf_inputs.dev_pub_key + 32);
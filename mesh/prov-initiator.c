@@ -15,6 +15,7 @@
 #include <ell/ell.h>
 
 #include "src/shared/ecc.h"
+#include "src/shared/ecc-pool.h"
 
 #include "mesh/mesh-defs.h"
 #include "mesh/util.h"
@@ -167,7 +168,8 @@ static void int_prov_open(void *user_data, prov_trans_tx_t trans_tx,
 		return;
 
 	/* Always use an ephemeral key when Initiator */
-	ecc_make_key(prov->conf_inputs.prv_pub_key, prov->private_key);
+	ecc_pool_get(mesh_get_key_pool(), prov->conf_inputs.prv_pub_key,
+							prov->private_key);
 	swap_u256_bytes(prov->conf_inputs.prv_pub_key);
 	swap_u256_bytes(prov->conf_inputs.prv_pub_key + 32);
 	prov->material |= MAT_LOCAL_PRIVATE;
@@ -1048,16 +1048,16 @@ response:
 
 		print_field("%*cStringLength: 0x%02x", (indent - 8), ' ', len);
 
-		printf("String: ");
+		fprintf(display_file(), "String: ");
 		for (; len > 0; len--) {
 			uint8_t c;
 
 			if (!l2cap_frame_get_u8(frame, &c))
 				return false;
 
-			printf("%1c", isprint(c) ? c : '.');
+			fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 		}
-		printf("\n");
+		fprintf(display_file(), "\n");
 	}
 
 	return true;
@@ -1124,16 +1124,16 @@ response:
 
 		print_field("%*cStringLength: 0x%02x", (indent - 8), ' ', len);
 
-		printf("String: ");
+		fprintf(display_file(), "String: ");
 		for (; len > 0; len--) {
 			uint8_t c;
 
 			if (!l2cap_frame_get_u8(frame, &c))
 				return false;
 
-			printf("%1c", isprint(c) ? c : '.');
+			fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 		}
-		printf("\n");
+		fprintf(display_file(), "\n");
 	}
 
 	return true;
@@ -1404,16 +1404,16 @@ response:
 								' ', status);
 		switch (status) {
 		case 0x00:
-			printf("(POWER_ON)\n");
+			fprintf(display_file(), "(POWER_ON)\n");
 			break;
 		case 0x01:
-			printf("(POWER_OFF)\n");
+			fprintf(display_file(), "(POWER_OFF)\n");
 			break;
 		case 0x02:
-			printf("(UNPLUGGED)\n");
+			fprintf(display_file(), "(UNPLUGGED)\n");
 			break;
 		default:
-			printf("(UNKNOWN)\n");
+			fprintf(display_file(), "(UNKNOWN)\n");
 			break;
 		}
 		break;
@@ -1872,16 +1872,16 @@ static bool avrcp_media_player_item(struct avctp_frame *avctp_frame,
 	print_field("%*cPlayStatus: 0x%02x (%s)", indent, ' ',
 						status, playstatus2str(status));
 
-	printf("%*cFeatures: 0x", indent+8, ' ');
+	fprintf(display_file(), "%*cFeatures: 0x", indent+8, ' ');
 
 	for (i = 0; i < 16; i++) {
 		if (!l2cap_frame_get_u8(frame, &features[i]))
 			return false;
 
-		printf("%02x", features[i]);
+		fprintf(display_file(), "%02x", features[i]);
 	}
 
-	printf("\n");
+	fprintf(display_file(), "\n");
 
 	print_features(features, indent + 2);
 
@@ -1897,15 +1897,15 @@ static bool avrcp_media_player_item(struct avctp_frame *avctp_frame,
 	print_field("%*cNameLength: 0x%04x (%u)", indent, ' ',
 						namelen, namelen);
 
-	printf("%*cName: ", indent+8, ' ');
+	fprintf(display_file(), "%*cName: ", indent+8, ' ');
 	for (; namelen > 0; namelen--) {
 		uint8_t c;
 
 		if (!l2cap_frame_get_u8(frame, &c))
 			return false;
-		printf("%1c", isprint(c) ? c : '.');
+		fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 	}
-	printf("\n");
+	fprintf(display_file(), "\n");
 
 	return true;
 }
@@ -1919,7 +1919,7 @@ static bool avrcp_folder_item(struct avctp_frame *avctp_frame,
 	uint64_t uid;
 
 	if (frame->size < 14) {
-		printf("PDU Malformed\n");
+		fprintf(display_file(), "PDU Malformed\n");
 		return false;
 	}
 
@@ -1953,15 +1953,15 @@ static bool avrcp_folder_item(struct avctp_frame *avctp_frame,
 	print_field("%*cNameLength: 0x%04x (%u)", indent, ' ',
 					namelen, namelen);
 
-	printf("%*cName: ", indent+8, ' ');
+	fprintf(display_file(), "%*cName: ", indent+8, ' ');
 	for (; namelen > 0; namelen--) {
 		uint8_t c;
 		if (!l2cap_frame_get_u8(frame, &c))
 			return false;
 
-		printf("%1c", isprint(c) ? c : '.');
+		fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 	}
-	printf("\n");
+	fprintf(display_file(), "\n");
 
 	return true;
 }
@@ -1993,16 +1993,16 @@ static bool avrcp_attribute_entry_list(struct avctp_frame *avctp_frame,
 		print_field("%*cAttributeLength: 0x%04x (%u)", indent, ' ',
 						len, len);
 
-		printf("%*cAttributeValue: ", indent+8, ' ');
+		fprintf(display_file(), "%*cAttributeValue: ", indent+8, ' ');
 		for (; len > 0; len--) {
 			uint8_t c;
 
 			if (!l2cap_frame_get_u8(frame, &c))
 				return false;
 
-			printf("%1c", isprint(c) ? c : '.');
+			fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 		}
-		printf("\n");
+		fprintf(display_file(), "\n");
 	}
 
 	return true;
@@ -2040,15 +2040,15 @@ static bool avrcp_media_element_item(struct avctp_frame *avctp_frame,
 	print_field("%*cNameLength: 0x%04x (%u)", indent, ' ',
 					namelen, namelen);
 
-	printf("%*cName: ", indent+8, ' ');
+	fprintf(display_file(), "%*cName: ", indent+8, ' ');
 	for (; namelen > 0; namelen--) {
 		uint8_t c;
 		if (!l2cap_frame_get_u8(frame, &c))
 			return false;
 
-		printf("%1c", isprint(c) ? c : '.');
+		fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 	}
-	printf("\n");
+	fprintf(display_file(), "\n");
 
 	if (!l2cap_frame_get_u8(frame, &count))
 		return false;
@@ -2096,7 +2096,7 @@ static bool avrcp_get_total_number_of_items(struct avctp_frame *avctp_frame)
 		goto response;
 
 	if (frame->size < 4) {
-		printf("PDU Malformed\n");
+		fprintf(display_file(), "PDU Malformed\n");
 		packet_hexdump(frame->data, frame->size);
 		return false;
 	}
@@ -2145,7 +2145,7 @@ static bool avrcp_search_item(struct avctp_frame *avctp_frame)
 		goto response;
 
 	if (frame->size < 4) {
-		printf("PDU Malformed\n");
+		fprintf(display_file(), "PDU Malformed\n");
 		packet_hexdump(frame->data, frame->size);
 		return false;
 	}
@@ -2161,17 +2161,17 @@ static bool avrcp_search_item(struct avctp_frame *avctp_frame)
 
 	print_field("%*cLength: 0x%04x (%u)", indent, ' ', namelen, namelen);
 
-	printf("%*cString: ", indent+8, ' ');
+	fprintf(display_file(), "%*cString: ", indent+8, ' ');
 	for (; namelen > 0; namelen--) {
 		uint8_t c;
 
 		if (!l2cap_frame_get_u8(frame, &c))
 			return false;
 
-		printf("%1c", isprint(c) ? c : '.');
+		fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 	}
 
-	printf("\n");
+	fprintf(display_file(), "\n");
 
 	return true;
 
@@ -2425,16 +2425,16 @@ response:
 			continue;
 		}
 
-		printf("%*cFolder: ", indent+8, ' ');
+		fprintf(display_file(), "%*cFolder: ", indent+8, ' ');
 		for (; len > 0; len--) {
 			uint8_t c;
 
 			if (!l2cap_frame_get_u8(frame, &c))
 				return false;
 
-			printf("%1c", isprint(c) ? c : '.');
+			fprintf(display_file(), "%1c", isprint(c) ? c : '.');
 		}
-		printf("\n");
+		fprintf(display_file(), "\n");
 	}
 
 	return true;
@@ -0,0 +1,448 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include "lib/bluetooth.h"
+
+#include "src/shared/util.h"
+#include "src/shared/btsnoop.h"
+#include "display.h"
+#include "packet.h"
+#include "browse.h"
+
+#define BLOCK_PACKETS	1024	/* packets between decoder checkpoints */
+#define CACHE_BLOCKS	16	/* decoded blocks kept in memory */
+#define PAGE_PACKETS	20	/* packets shown per page */
+
+struct trace_entry {
+	off_t offset;
+	uint64_t timestamp;	/* microseconds */
+	uint16_t index;
+	uint16_t opcode;
+	uint16_t handle;	/* 0xffff if not a data packet */
+};
+
+struct cache_block {
+	size_t block;
+	char *text;
+	size_t offsets[BLOCK_PACKETS + 1];
+	unsigned long last_used;
+};
+
+static struct btsnoop *btsnoop_file;
+static struct trace_entry *entries;
+static size_t num_entries;
+static size_t file_pos;
+
+/* Decoder state at the start of each block, NULL until reached once */
+static void **checkpoints;
+static size_t num_blocks;
+static size_t decode_pos;
+
+static struct cache_block cache[CACHE_BLOCKS];
+static unsigned long cache_clock;
+static unsigned long cache_hits;
+static unsigned long cache_misses;
+
+static FILE *null_output;
+
+static uint16_t get_handle(uint16_t opcode, const uint8_t *data, uint16_t size)
+{
+	switch (opcode) {
+	case BTSNOOP_OPCODE_ACL_TX_PKT:
+	case BTSNOOP_OPCODE_ACL_RX_PKT:
+	case BTSNOOP_OPCODE_SCO_TX_PKT:
+	case BTSNOOP_OPCODE_SCO_RX_PKT:
+	case BTSNOOP_OPCODE_ISO_TX_PKT:
+	case BTSNOOP_OPCODE_ISO_RX_PKT:
+		if (size < 2)
+			break;
+		return get_le16(data) & 0x0fff;
+	}
+
+	return 0xffff;
+}
+
+static bool build_index(void)
+{
+	unsigned char buf[BTSNOOP_MAX_PACKET_SIZE];
+	size_t alloc = 0;
+
+	while (1) {
+		struct trace_entry *entry;
+		struct timeval tv;
+		uint16_t index, opcode, pktlen;
+		off_t offset;
+
+		offset = btsnoop_get_offset(btsnoop_file);
+		if (offset < 0)
+			return false;
+
+		if (!btsnoop_read_hci(btsnoop_file, &tv, &index, &opcode,
+								buf, &pktlen))
+			break;
+
+		if (opcode == 0xffff)
+			continue;
+
+		if (num_entries == alloc) {
+			struct trace_entry *tmp;
+
+			alloc = alloc ? alloc * 2 : 4096;
+
+			tmp = realloc(entries, alloc * sizeof(*entries));
+			if (!tmp)
+				return false;
+
+			entries = tmp;
+		}
+
+		entry = &entries[num_entries++];
+		entry->offset = offset;
+		entry->timestamp = (uint64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+		entry->index = index;
+		entry->opcode = opcode;
+		entry->handle = get_handle(opcode, buf, pktlen);
+	}
+
+	num_blocks = (num_entries + BLOCK_PACKETS - 1) / BLOCK_PACKETS;
+
+	checkpoints = new0(void *, num_blocks + 1);
+	checkpoints[0] = packet_save_state();
+
+	return true;
+}
+
+static void decode_packet(size_t pos)
+{
+	unsigned char buf[BTSNOOP_MAX_PACKET_SIZE];
+	struct timeval tv;
+	uint16_t index, opcode, pktlen;
+
+	if (file_pos != pos &&
+			!btsnoop_set_offset(btsnoop_file, entries[pos].offset))
+		return;
+
+	file_pos = pos + 1;
+
+	if (!btsnoop_read_hci(btsnoop_file, &tv, &index, &opcode,
+								buf, &pktlen))
+		return;
+
+	packet_monitor(&tv, NULL, index, opcode, buf, pktlen);
+}
+
+static size_t block_end(size_t block)
+{
+	size_t end = (block + 1) * BLOCK_PACKETS;
+
+	return end < num_entries ? end : num_entries;
+}
+
+static void decode_block(size_t block, FILE *output, size_t *offsets)
+{
+	size_t start = block * BLOCK_PACKETS;
+	size_t end = block_end(block);
+	FILE *orig;
+	size_t i;
+
+	orig = display_set_file(output);
+
+	for (i = start; i < end; i++) {
+		if (offsets) {
+			fflush(output);
+			offsets[i - start] = ftell(output);
+		}
+
+		decode_packet(i);
+	}
+
+	fflush(output);
+	display_set_file(orig);
+
+	decode_pos = end;
+
+	if (!checkpoints[block + 1])
+		checkpoints[block + 1] = packet_save_state();
+}
+
+static void decoder_seek(size_t block)
+{
+	size_t current = decode_pos / BLOCK_PACKETS;
+	size_t nearest = block;
+
+	if (decode_pos == block * BLOCK_PACKETS)
+		return;
+
+	while (!checkpoints[nearest])
+		nearest--;
+
+	/* Carry on from the current state if that is closer */
+	if (decode_pos % BLOCK_PACKETS || current < nearest ||
+							current > block) {
+		packet_restore_state(checkpoints[nearest]);
+		decode_pos = nearest * BLOCK_PACKETS;
+	}
+
+	while (decode_pos < block * BLOCK_PACKETS)
+		decode_block(decode_pos / BLOCK_PACKETS, null_output, NULL);
+}
+
+static struct cache_block *get_block(size_t block)
+{
+	struct cache_block *slot = &cache[0];
+	size_t size = 0;
+	FILE *output;
+	int i;
+
+	for (i = 0; i < CACHE_BLOCKS; i++) {
+		if (cache[i].text && cache[i].block == block) {
+			cache[i].last_used = ++cache_clock;
+			cache_hits++;
+			return &cache[i];
+		}
+
+		if (cache[i].last_used < slot->last_used)
+			slot = &cache[i];
+	}
+
+	cache_misses++;
+
+	free(slot->text);
+	slot->text = NULL;
+
+	decoder_seek(block);
+
+	output = open_memstream(&slot->text, &size);
+	if (!output)
+		return NULL;
+
+	decode_block(block, output, slot->offsets);
+	fclose(output);
+
+	slot->offsets[block_end(block) - block * BLOCK_PACKETS] = size;
+	slot->block = block;
+	slot->last_used = ++cache_clock;
+
+	return slot;
+}
+
+static size_t show_packets(size_t pos, size_t count)
+{
+	size_t i, end = pos + count < num_entries ? pos + count : num_entries;
+
+	if (pos >= num_entries) {
+		printf("--- End of trace (%zu packets) ---\n", num_entries);
+		return pos;
+	}
+
+	printf("--- Packets %zu-%zu of %zu ---\n", pos + 1, end, num_entries);
+
+	for (i = pos; i < end; i++) {
+		struct cache_block *block;
+		size_t n = i % BLOCK_PACKETS;
+
+		block = get_block(i / BLOCK_PACKETS);
+		if (!block)
+			break;
+
+		fwrite(block->text + block->offsets[n], 1,
+				block->offsets[n + 1] - block->offsets[n],
+				stdout);
+	}
+
+	return i;
+}
+
+static size_t find_time(double seconds)
+{
+	uint64_t target;
+	size_t lo = 0, hi = num_entries;
+
+	if (!num_entries || seconds < 0)
+		return 0;
+
+	target = entries[0].timestamp + (uint64_t) (seconds * 1000000);
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (entries[mid].timestamp < target)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+static size_t find_handle(size_t pos, uint16_t handle)
+{
+	size_t i;
+
+	for (i = pos; i < num_entries; i++) {
+		if (entries[i].handle == handle)
+			return i;
+	}
+
+	return num_entries;
+}
+
+static void print_stats(void)
+{
+	size_t i, count = 0;
+
+	for (i = 0; i < num_blocks; i++) {
+		if (checkpoints[i])
+			count++;
+	}
+
+	printf("Packets: %zu\n", num_entries);
+	printf("Checkpoints: %zu of %zu\n", count, num_blocks);
+	printf("Cache: %lu hits, %lu misses\n", cache_hits, cache_misses);
+}
+
+static void print_help(void)
+{
+	printf("Commands:\n"
+		"\t[n]            Show next packets\n"
+		"\tp <number>     Jump to packet number\n"
+		"\tt <seconds>    Jump to time offset\n"
+		"\th <handle>     Jump to next packet on connection handle\n"
+		"\ts              Show statistics\n"
+		"\tq              Quit\n");
+}
+
+static void browse_loop(void)
+{
+	char line[128];
+	size_t pos = 0;
+
+	print_help();
+
+	pos = show_packets(pos, PAGE_PACKETS);
+
+	while (1) {
+		char *arg;
+
+		printf("btmon> ");
+		fflush(stdout);
+
+		if (!fgets(line, sizeof(line), stdin))
+			break;
+
+		line[strcspn(line, "\r\n")] = '\0';
+
+		arg = line + 1;
+		while (*arg == ' ')
+			arg++;
+
+		switch (line[0]) {
+		case '\0':
+		case 'n':
+			pos = show_packets(pos, PAGE_PACKETS);
+			break;
+		case 'p':
+			pos = strtoul(arg, NULL, 0);
+			pos = show_packets(pos ? pos - 1 : 0, PAGE_PACKETS);
+			break;
+		case 't':
+			pos = show_packets(find_time(strtod(arg, NULL)),
+								PAGE_PACKETS);
+			break;
+		case 'h':
+			pos = find_handle(pos, strtoul(arg, NULL, 0));
+			pos = show_packets(pos, PAGE_PACKETS);
+			break;
+		case 's':
+			print_stats();
+			break;
+		case 'q':
+			return;
+		default:
+			print_help();
+			break;
+		}
+	}
+}
+
+static void browse_cleanup(void)
+{
+	size_t i;
+
+	for (i = 0; i < CACHE_BLOCKS; i++) {
+		free(cache[i].text);
+		cache[i].text = NULL;
+	}
+
+	for (i = 0; checkpoints && i <= num_blocks; i++)
+		packet_free_state(checkpoints[i]);
+
+	free(checkpoints);
+	checkpoints = NULL;
+
+	free(entries);
+	entries = NULL;
+	num_entries = 0;
+
+	if (null_output) {
+		fclose(null_output);
+		null_output = NULL;
+	}
+
+	btsnoop_unref(btsnoop_file);
+	btsnoop_file = NULL;
+}
+
+void browse_trace(const char *path)
+{
+	btsnoop_file = btsnoop_open(path, BTSNOOP_FLAG_PKLG_SUPPORT);
+	if (!btsnoop_file)
+		return;
+
+	switch (btsnoop_get_format(btsnoop_file)) {
+	case BTSNOOP_FORMAT_HCI:
+	case BTSNOOP_FORMAT_UART:
+		packet_del_filter(PACKET_FILTER_SHOW_INDEX);
+		break;
+	case BTSNOOP_FORMAT_MONITOR:
+		packet_add_filter(PACKET_FILTER_SHOW_INDEX);
+		break;
+	default:
+		fprintf(stderr, "Unsupported packet format\n");
+		goto done;
+	}
+
+	null_output = fopen("/dev/null", "w");
+	if (!null_output) {
+		perror("Failed to open /dev/null");
+		goto done;
+	}
+
+	if (!build_index()) {
+		fprintf(stderr, "Failed to index trace\n");
+		goto done;
+	}
+
+	/* The index pass left the file at its end */
+	file_pos = num_entries;
+
+	browse_loop();
+
+done:
+	browse_cleanup();
+}
@@ -37,6 +37,7 @@
 #include "src/shared/util.h"
 #include "src/shared/btsnoop.h"
 #include "src/shared/mainloop.h"
+#include "src/shared/shm-ring.h"
 
 #include "display.h"
 #include "packet.h"
@@ -46,10 +47,13 @@
 #include "control.h"
 #include "jlink.h"
 
+#define SHM_RING_SIZE	(4 * 1024 * 1024)
+
 static struct btsnoop *btsnoop_file = NULL;
 static bool hcidump_fallback = false;
 static bool decode_control = true;
 static uint16_t filter_index = HCI_DEV_NONE;
+static struct shm_ring *shm_ring = NULL;
 
 struct control_data {
 	uint16_t channel;
@@ -900,6 +904,34 @@ void control_message(uint16_t opcode, const void *data, uint16_t size)
 	}
 }
 
+static void shm_publish(struct timeval *tv, uint16_t index, uint16_t opcode,
+					const void *data, uint16_t size)
+{
+	struct shm_ring_hci_hdr hdr;
+	struct iovec iov[2];
+	struct timeval now;
+
+	if (!shm_ring)
+		return;
+
+	if (!tv) {
+		gettimeofday(&now, NULL);
+		tv = &now;
+	}
+
+	hdr.index = index;
+	hdr.opcode = opcode;
+	hdr.reserved = 0;
+	hdr.timestamp = (uint64_t) tv->tv_sec * 1000000 + tv->tv_usec;
+
+	iov[0].iov_base = &hdr;
+	iov[0].iov_len = sizeof(hdr);
+	iov[1].iov_base = (void *) data;
+	iov[1].iov_len = size;
+
+	shm_ring_write(shm_ring, iov, 2);
+}
+
 static void data_callback(int fd, uint32_t events, void *user_data)
 {
 	struct control_data *data = user_data;
@@ -970,6 +1002,7 @@ static void data_callback(int fd, uint32_t events, void *user_data)
 							data->buf, pktlen);
 			ellisys_inject_hci(tv, index, opcode,
 							data->buf, pktlen);
+			shm_publish(tv, index, opcode, data->buf, pktlen);
 			packet_monitor(tv, cred, index, opcode,
 							data->buf, pktlen);
 			break;
@@ -1104,6 +1137,8 @@ static void client_callback(int fd, uint32_t events, void *user_data)
 		opcode = le16_to_cpu(hdr->opcode);
 		index = le16_to_cpu(hdr->index);
 
+		shm_publish(NULL, index, opcode, data->buf + MGMT_HDR_SIZE,
+								pktlen);
 		packet_monitor(NULL, NULL, index, opcode,
 					data->buf + MGMT_HDR_SIZE, pktlen);
 
@@ -1153,19 +1188,16 @@ static void server_accept_callback(int fd, uint32_t events, void *user_data)
 
 static int server_fd = -1;
 
-void control_server(const char *path)
+static int open_server_socket(const char *path)
 {
 	struct sockaddr_un addr;
 	size_t len;
 	int fd;
 
-	if (server_fd >= 0)
-		return;
-
 	len = strlen(path);
 	if (len > sizeof(addr.sun_path) - 1) {
 		fprintf(stderr, "Socket name too long\n");
-		return;
+		return -1;
 	}
 
 	unlink(path);
@@ -1173,7 +1205,7 @@ void control_server(const char *path)
 	fd = socket(PF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
 	if (fd < 0) {
 		perror("Failed to open server socket");
-		return;
+		return -1;
 	}
 
 	memset(&addr, 0, sizeof(addr));
@@ -1183,15 +1215,29 @@ void control_server(const char *path)
 	if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
 		perror("Failed to bind server socket");
 		close(fd);
-		return;
+		return -1;
 	}
 
 	if (listen(fd, 5) < 0) {
 		perror("Failed to listen server socket");
 		close(fd);
-		return;
+		return -1;
 	}
 
+	return fd;
+}
+
+void control_server(const char *path)
+{
+	int fd;
+
+	if (server_fd >= 0)
+		return;
+
+	fd = open_server_socket(path);
+	if (fd < 0)
+		return;
+
 	if (mainloop_add_fd(fd, EPOLLIN, server_accept_callback,
 						NULL, NULL) < 0) {
 		close(fd);
@@ -1201,6 +1247,69 @@ void control_server(const char *path)
 	server_fd = fd;
 }
 
+static void shm_accept_callback(int fd, uint32_t events, void *user_data)
+{
+	int nfd;
+
+	if (events & (EPOLLERR | EPOLLHUP)) {
+		mainloop_remove_fd(fd);
+		return;
+	}
+
+	nfd = accept4(fd, NULL, NULL, SOCK_CLOEXEC);
+	if (nfd < 0) {
+		perror("Failed to accept client socket");
+		return;
+	}
+
+	/* Readers only need the memory, the connection is done with */
+	if (!shm_ring_send_fd(shm_ring, nfd))
+		perror("Failed to send shared memory");
+	else
+		printf("--- New shared memory reader ---\n");
+
+	close(nfd);
+}
+
+static void shm_free(void *user_data)
+{
+	int fd = PTR_TO_INT(user_data);
+
+	close(fd);
+
+	shm_ring_free(shm_ring);
+	shm_ring = NULL;
+}
+
+bool control_shm_server(const char *path)
+{
+	int fd;
+
+	if (shm_ring)
+		return true;
+
+	fd = open_server_socket(path);
+	if (fd < 0)
+		return false;
+
+	shm_ring = shm_ring_new("btmon", SHM_RING_SIZE);
+	if (!shm_ring) {
+		perror("Failed to create shared memory");
+		close(fd);
+		return false;
+	}
+
+	if (mainloop_add_fd(fd, EPOLLIN, shm_accept_callback,
+					INT_TO_PTR(fd), shm_free) < 0) {
+		shm_ring_free(shm_ring);
+		shm_ring = NULL;
+		close(fd);
+		return false;
+	}
+
+	return true;
+}
+
 static bool parse_drops(uint8_t **data, uint8_t *len, uint8_t *drops,
 							uint32_t *total)
 {
@@ -1320,6 +1429,7 @@ static void process_data(struct control_data *data)
 					hdr->ext_hdr + hdr->hdr_len, pktlen);
 		ellisys_inject_hci(tv, 0, opcode, hdr->ext_hdr + hdr->hdr_len,
 					pktlen);
+		shm_publish(tv, 0, opcode, hdr->ext_hdr + hdr->hdr_len, pktlen);
 		packet_monitor(tv, NULL, 0, opcode,
 					hdr->ext_hdr + hdr->hdr_len, pktlen);
 
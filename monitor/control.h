@@ -14,6 +14,7 @@
 bool control_writer(const char *path);
 void control_reader(const char *path, bool pager);
 void control_server(const char *path);
+bool control_shm_server(const char *path);
 int control_tty(const char *path, unsigned int speed);
 int control_rtt(char *jlink, char *rtt);
 int control_tracing(void);
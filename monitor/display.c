@@ -28,6 +28,7 @@
 #include "display.h"
 
 static pid_t pager_pid = 0;
+static FILE *output;
 
 bool use_color(void)
 {
@@ -39,6 +40,21 @@ bool use_color(void)
 	return cached_use_color;
 }
 
+FILE *display_file(void)
+{
+	return output ? output : stdout;
+}
+
+/* Sends decoded output to file instead of stdout, returns the previous one */
+FILE *display_set_file(FILE *file)
+{
+	FILE *prev = output;
+
+	output = file;
+
+	return prev;
+}
+
 int num_columns(void)
 {
 	static int cached_num_columns = -1;
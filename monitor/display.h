@@ -9,11 +9,15 @@
  *
  */
 
+#include <stdio.h>
 #include <stdbool.h>
 #include <inttypes.h>
 
 bool use_color(void);
 
+FILE *display_file(void);
+FILE *display_set_file(FILE *file);
+
 #define COLOR_OFF	"\x1B[0m"
 #define COLOR_BLACK	"\x1B[0;30m"
 #define COLOR_RED	"\x1B[0;31m"
@@ -40,7 +44,7 @@ bool use_color(void);
 
 #define print_indent(indent, color1, prefix, title, color2, fmt, args...) \
 do { \
-	printf("%*c%s%s%s%s" fmt "%s\n", (indent), ' ', \
+	fprintf(display_file(), "%*c%s%s%s%s" fmt "%s\n", (indent), ' ', \
 		use_color() ? (color1) : "", prefix, title, \
 		use_color() ? (color2) : "", ## args, \
 		use_color() ? COLOR_OFF : ""); \
@@ -15,6 +15,7 @@
 
 #define _GNU_SOURCE
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "hwdb.h"
@@ -22,23 +23,43 @@
 #ifdef HAVE_UDEV_HWDB_NEW
 #include <libudev.h>
 
+/* Direct mapped cache of company names by OUI */
+#define OUI_CACHE_SIZE 256
+
+struct oui_entry {
+	bool valid;
+	uint32_t oui;
+	char *company;
+};
+
+static struct udev *udev;
+static struct udev_hwdb *hwdb;
+static struct oui_entry oui_cache[OUI_CACHE_SIZE];
+
+/* The database is opened on first use and kept for later lookups */
+static struct udev_hwdb *hwdb_get(void)
+{
+	if (hwdb)
+		return hwdb;
+
+	if (!udev) {
+		udev = udev_new();
+		if (!udev)
+			return NULL;
+	}
+
+	hwdb = udev_hwdb_new(udev);
+
+	return hwdb;
+}
+
 bool hwdb_get_vendor_model(const char *modalias, char **vendor, char **model)
 {
-	struct udev *udev;
-	struct udev_hwdb *hwdb;
 	struct udev_list_entry *head, *entry;
-	bool result;
 
-	udev = udev_new();
-	if (!udev)
+	if (!hwdb_get())
 		return false;
 
-	hwdb = udev_hwdb_new(udev);
-	if (!hwdb) {
-		result = false;
-		goto done;
-	}
-
 	*vendor = NULL;
 	*model = NULL;
 
@@ -56,41 +77,35 @@ bool hwdb_get_vendor_model(const char *modalias, char **vendor, char **model)
 			*model = strdup(udev_list_entry_get_value(entry));
 	}
 
-	hwdb = udev_hwdb_unref(hwdb);
-
-	result = true;
-
-done:
-	udev = udev_unref(udev);
-
-	return result;
+	return true;
 }
 
 bool hwdb_get_company(const uint8_t *bdaddr, char **company)
 {
-	struct udev *udev;
-	struct udev_hwdb *hwdb;
 	struct udev_list_entry *head, *entry;
+	struct oui_entry *cache;
 	char modalias[11];
-	bool result;
+	uint32_t oui;
 
 	if (!bdaddr[2] && !bdaddr[1] && !bdaddr[0])
 		return false;
 
-	sprintf(modalias, "OUI:%2.2X%2.2X%2.2X",
-				bdaddr[5], bdaddr[4], bdaddr[3]);
+	oui = bdaddr[5] << 16 | bdaddr[4] << 8 | bdaddr[3];
+	cache = &oui_cache[(oui ^ oui >> 8 ^ oui >> 16) % OUI_CACHE_SIZE];
+
+	if (cache->valid && cache->oui == oui)
+		goto done;
 
-	udev = udev_new();
-	if (!udev)
+	if (!hwdb_get())
 		return false;
 
-	hwdb = udev_hwdb_new(udev);
-	if (!hwdb) {
-		result = false;
-		goto done;
-	}
+	free(cache->company);
+	cache->company = NULL;
+	cache->oui = oui;
+	cache->valid = true;
 
-	*company = NULL;
+	sprintf(modalias, "OUI:%2.2X%2.2X%2.2X",
+				bdaddr[5], bdaddr[4], bdaddr[3]);
 
 	head = udev_hwdb_get_properties_list_entry(hwdb, modalias, 0);
 
@@ -98,19 +113,15 @@ bool hwdb_get_company(const uint8_t *bdaddr, char **company)
 		const char *name = udev_list_entry_get_name(entry);
 
 		if (name && !strcmp(name, "ID_OUI_FROM_DATABASE")) {
-			*company = strdup(udev_list_entry_get_value(entry));
+			cache->company = strdup(udev_list_entry_get_value(entry));
 			break;
 		}
 	}
 
-	hwdb = udev_hwdb_unref(hwdb);
-
-	result = true;
-
 done:
-	udev = udev_unref(udev);
+	*company = cache->company ? strdup(cache->company) : NULL;
 
-	return result;
+	return true;
 }
 #else
 bool hwdb_get_vendor_model(const char *modalias, char **vendor, char **model)
@@ -417,73 +417,77 @@ static char *mode2str(uint8_t mode)
 
 static void l2cap_ctrl_ext_parse(struct l2cap_frame *frame, uint32_t ctrl)
 {
-	printf("      %s:",
+	fprintf(display_file(), "      %s:",
 		ctrl & L2CAP_EXT_CTRL_FRAME_TYPE ? "S-frame" : "I-frame");
 
 	if (ctrl & L2CAP_EXT_CTRL_FRAME_TYPE) {
-		printf(" %s",
+		fprintf(display_file(), " %s",
 		supervisory2str((ctrl & L2CAP_EXT_CTRL_SUPERVISE_MASK) >>
 						L2CAP_EXT_CTRL_SUPER_SHIFT));
 
 		if (ctrl & L2CAP_EXT_CTRL_POLL)
-			printf(" P-bit");
+			fprintf(display_file(), " P-bit");
 	} else {
 		uint8_t sar = (ctrl & L2CAP_EXT_CTRL_SAR_MASK) >>
 						L2CAP_EXT_CTRL_SAR_SHIFT;
-		printf(" %s", sar2str(sar));
+		fprintf(display_file(), " %s", sar2str(sar));
 		if (sar == L2CAP_SAR_START) {
 			uint16_t len;
 
 			if (!l2cap_frame_get_le16(frame, &len))
 				return;
 
-			printf(" (len %d)", len);
+			fprintf(display_file(), " (len %d)", len);
 		}
-		printf(" TxSeq %d", (ctrl & L2CAP_EXT_CTRL_TXSEQ_MASK) >>
+		fprintf(display_file(), " TxSeq %d",
+				(ctrl & L2CAP_EXT_CTRL_TXSEQ_MASK) >>
 						L2CAP_EXT_CTRL_TXSEQ_SHIFT);
 	}
 
-	printf(" ReqSeq %d", (ctrl & L2CAP_EXT_CTRL_REQSEQ_MASK) >>
+	fprintf(display_file(), " ReqSeq %d",
+				(ctrl & L2CAP_EXT_CTRL_REQSEQ_MASK) >>
 						L2CAP_EXT_CTRL_REQSEQ_SHIFT);
 
 	if (ctrl & L2CAP_EXT_CTRL_FINAL)
-		printf(" F-bit");
+		fprintf(display_file(), " F-bit");
 }
 
 static void l2cap_ctrl_parse(struct l2cap_frame *frame, uint32_t ctrl)
 {
-	printf("      %s:",
+	fprintf(display_file(), "      %s:",
 			ctrl & L2CAP_CTRL_FRAME_TYPE ? "S-frame" : "I-frame");
 
 	if (ctrl & 0x01) {
-		printf(" %s",
+		fprintf(display_file(), " %s",
 			supervisory2str((ctrl & L2CAP_CTRL_SUPERVISE_MASK) >>
 						L2CAP_CTRL_SUPER_SHIFT));
 
 		if (ctrl & L2CAP_CTRL_POLL)
-			printf(" P-bit");
+			fprintf(display_file(), " P-bit");
 	} else {
 		uint8_t sar;
 
 		sar = (ctrl & L2CAP_CTRL_SAR_MASK) >> L2CAP_CTRL_SAR_SHIFT;
-		printf(" %s", sar2str(sar));
+		fprintf(display_file(), " %s", sar2str(sar));
 		if (sar == L2CAP_SAR_START) {
 			uint16_t len;
 
 			if (!l2cap_frame_get_le16(frame, &len))
 				return;
 
-			printf(" (len %d)", len);
+			fprintf(display_file(), " (len %d)", len);
 		}
-		printf(" TxSeq %d", (ctrl & L2CAP_CTRL_TXSEQ_MASK) >>
+		fprintf(display_file(), " TxSeq %d",
+				(ctrl & L2CAP_CTRL_TXSEQ_MASK) >>
 						L2CAP_CTRL_TXSEQ_SHIFT);
 	}
 
-	printf(" ReqSeq %d", (ctrl & L2CAP_CTRL_REQSEQ_MASK) >>
+	fprintf(display_file(), " ReqSeq %d",
+				(ctrl & L2CAP_CTRL_REQSEQ_MASK) >>
 						L2CAP_CTRL_REQSEQ_SHIFT);
 
 	if (ctrl & L2CAP_CTRL_FINAL)
-		printf(" F-bit");
+		fprintf(display_file(), " F-bit");
 }
 
 #define MAX_INDEX 16
@@ -3293,7 +3297,7 @@ void l2cap_frame(uint16_t index, bool in, uint16_t handle, uint16_t cid,
 				l2cap_ctrl_parse(&frame, ctrl16);
 			}
 
-			printf("\n");
+			fprintf(display_file(), "\n");
 			break;
 		}
 
@@ -3454,3 +3458,78 @@ void l2cap_packet(uint16_t index, bool in, uint16_t handle, uint8_t flags,
 		return;
 	}
 }
+
+struct l2cap_state {
+	struct chan_data chan_list[MAX_CHAN];
+	struct index_data index_list[MAX_INDEX][2];
+};
+
+static void copy_fragments(struct index_data dst[MAX_INDEX][2],
+				const struct index_data src[MAX_INDEX][2])
+{
+	int i, j;
+
+	for (i = 0; i < MAX_INDEX; i++) {
+		for (j = 0; j < 2; j++) {
+			const struct index_data *frag = &src[i][j];
+
+			dst[i][j] = *frag;
+
+			if (!frag->frag_buf)
+				continue;
+
+			dst[i][j].frag_buf = malloc(frag->frag_pos +
+							frag->frag_len);
+			if (!dst[i][j].frag_buf) {
+				dst[i][j].frag_pos = 0;
+				dst[i][j].frag_len = 0;
+				continue;
+			}
+
+			memcpy(dst[i][j].frag_buf, frag->frag_buf,
+							frag->frag_pos);
+		}
+	}
+}
+
+void *l2cap_save_state(void)
+{
+	struct l2cap_state *state;
+
+	state = new0(struct l2cap_state, 1);
+
+	memcpy(state->chan_list, chan_list, sizeof(chan_list));
+	copy_fragments(state->index_list, index_list);
+
+	return state;
+}
+
+void l2cap_restore_state(const void *data)
+{
+	const struct l2cap_state *state = data;
+	int i;
+
+	for (i = 0; i < MAX_INDEX; i++) {
+		clear_fragment_buffer(i, false);
+		clear_fragment_buffer(i, true);
+	}
+
+	memcpy(chan_list, state->chan_list, sizeof(chan_list));
+	copy_fragments(index_list, state->index_list);
+}
+
+void l2cap_free_state(void *data)
+{
+	struct l2cap_state *state = data;
+	int i;
+
+	if (!state)
+		return;
+
+	for (i = 0; i < MAX_INDEX; i++) {
+		free(state->index_list[i][0].frag_buf);
+		free(state->index_list[i][1].frag_buf);
+	}
+
+	free(state);
+}
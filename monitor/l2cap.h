@@ -164,3 +164,7 @@ void l2cap_packet(uint16_t index, bool in, uint16_t handle, uint8_t flags,
 					const void *data, uint16_t size);
 
 void rfcomm_packet(const struct l2cap_frame *frame);
+
+void *l2cap_save_state(void);
+void l2cap_restore_state(const void *state);
+void l2cap_free_state(void *state);
@@ -28,6 +28,7 @@
 #include "lmp.h"
 #include "keys.h"
 #include "analyze.h"
+#include "browse.h"
 #include "ellisys.h"
 #include "control.h"
 
@@ -50,7 +51,9 @@ static void usage(void)
 		"\t-r, --read <file>      Read traces in btsnoop format\n"
 		"\t-w, --write <file>     Save traces in btsnoop format\n"
 		"\t-a, --analyze <file>   Analyze traces in btsnoop format\n"
+		"\t-I, --interactive      Browse traces read with --read\n"
 		"\t-s, --server <socket>  Start monitor server socket\n"
+		"\t-m, --shm <socket>     Publish traces in shared memory\n"
 		"\t-p, --priority <level> Show only priority or lower\n"
 		"\t-i, --index <num>      Show only specified controller\n"
 		"\t-d, --tty <tty>        Read data from TTY\n"
@@ -74,7 +77,9 @@ static const struct option main_options[] = {
 	{ "read",      required_argument, NULL, 'r' },
 	{ "write",     required_argument, NULL, 'w' },
 	{ "analyze",   required_argument, NULL, 'a' },
+	{ "interactive", no_argument,     NULL, 'I' },
 	{ "server",    required_argument, NULL, 's' },
+	{ "shm",       required_argument, NULL, 'm' },
 	{ "priority",  required_argument, NULL, 'p' },
 	{ "index",     required_argument, NULL, 'i' },
 	{ "tty",       required_argument, NULL, 'd' },
@@ -99,10 +104,12 @@ int main(int argc, char *argv[])
 {
 	unsigned long filter_mask = 0;
 	bool use_pager = true;
+	bool interactive = false;
 	const char *reader_path = NULL;
 	const char *writer_path = NULL;
 	const char *analyze_path = NULL;
 	const char *ellisys_server = NULL;
+	const char *shm_path = NULL;
 	const char *tty = NULL;
 	unsigned int tty_speed = B115200;
 	unsigned short ellisys_port = 0;
@@ -119,7 +126,7 @@ int main(int argc, char *argv[])
 		int opt;
 		struct sockaddr_un addr;
 
-		opt = getopt_long(argc, argv, "r:w:a:s:p:i:d:B:V:MtTSAE:PJ:R:vh",
+		opt = getopt_long(argc, argv, "r:w:a:Is:m:p:i:d:B:V:MtTSAE:PJ:R:vh",
 							main_options, NULL);
 		if (opt < 0)
 			break;
@@ -134,6 +141,9 @@ int main(int argc, char *argv[])
 		case 'a':
 			analyze_path = optarg;
 			break;
+		case 'I':
+			interactive = true;
+			break;
 		case 's':
 			if (strlen(optarg) > sizeof(addr.sun_path) - 1) {
 				fprintf(stderr, "Socket name too long\n");
@@ -141,6 +151,9 @@ int main(int argc, char *argv[])
 			}
 			control_server(optarg);
 			break;
+		case 'm':
+			shm_path = optarg;
+			break;
 		case 'p':
 			packet_set_priority(optarg);
 			break;
@@ -225,6 +238,11 @@ int main(int argc, char *argv[])
 		return EXIT_FAILURE;
 	}
 
+	if (interactive && !reader_path) {
+		fprintf(stderr, "Interactive mode requires a trace to read\n");
+		return EXIT_FAILURE;
+	}
+
 	printf("Bluetooth monitor ver %s\n", VERSION);
 
 	keys_setup();
@@ -236,6 +254,11 @@ int main(int argc, char *argv[])
 		return EXIT_SUCCESS;
 	}
 
+	if (reader_path && interactive) {
+		browse_trace(reader_path);
+		return EXIT_SUCCESS;
+	}
+
 	if (reader_path) {
 		if (ellisys_server)
 			ellisys_enable(ellisys_server, ellisys_port);
@@ -252,6 +275,11 @@ int main(int argc, char *argv[])
 	if (ellisys_server)
 		ellisys_enable(ellisys_server, ellisys_port);
 
+	if (shm_path && !control_shm_server(shm_path)) {
+		printf("Failed to publish on '%s'\n", shm_path);
+		return EXIT_FAILURE;
+	}
+
 	if (!tty && !jlink && control_tracing() < 0)
 		return EXIT_FAILURE;
 
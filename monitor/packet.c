@@ -255,7 +255,7 @@ void packet_select_index(uint16_t index)
 	index_filter = true;
 }
 
-#define print_space(x) printf("%*c", (x), ' ');
+#define print_space(x) fprintf(display_file(), "%*c", (x), ' ');
 
 #define MAX_INDEX 16
 
@@ -279,6 +279,54 @@ void packet_set_fallback_manufacturer(uint16_t manufacturer)
 	fallback_manufacturer = manufacturer;
 }
 
+struct packet_state {
+	time_t time_offset;
+	uint16_t index_current;
+	struct ctrl_data ctrl_list[MAX_CTRL];
+	struct conn_data conn_list[MAX_CONN];
+	struct index_data index_list[MAX_INDEX];
+	void *l2cap;
+};
+
+void *packet_save_state(void)
+{
+	struct packet_state *state;
+
+	state = new0(struct packet_state, 1);
+
+	state->time_offset = time_offset;
+	state->index_current = index_current;
+	memcpy(state->ctrl_list, ctrl_list, sizeof(ctrl_list));
+	memcpy(state->conn_list, conn_list, sizeof(conn_list));
+	memcpy(state->index_list, index_list, sizeof(index_list));
+	state->l2cap = l2cap_save_state();
+
+	return state;
+}
+
+void packet_restore_state(const void *data)
+{
+	const struct packet_state *state = data;
+
+	time_offset = state->time_offset;
+	index_current = state->index_current;
+	memcpy(ctrl_list, state->ctrl_list, sizeof(ctrl_list));
+	memcpy(conn_list, state->conn_list, sizeof(conn_list));
+	memcpy(index_list, state->index_list, sizeof(index_list));
+	l2cap_restore_state(state->l2cap);
+}
+
+void packet_free_state(void *data)
+{
+	struct packet_state *state = data;
+
+	if (!state)
+		return;
+
+	l2cap_free_state(state->l2cap);
+	free(state);
+}
+
 static void print_packet(struct timeval *tv, struct ucred *cred, char ident,
 					uint16_t index, const char *channel,
 					const char *color, const char *label,
@@ -426,12 +474,13 @@ static void print_packet(struct timeval *tv, struct ucred *cred, char ident,
 	}
 
 	if (ts_len > 0) {
-		printf("%s", line);
+		fprintf(display_file(), "%s", line);
 		if (len < col)
 			print_space(col - len - ts_len - 1);
-		printf("%s%s\n", use_color() ? COLOR_TIMESTAMP : "", ts_str);
+		fprintf(display_file(), "%s%s\n",
+				use_color() ? COLOR_TIMESTAMP : "", ts_str);
 	} else
-		printf("%s\n", line);
+		fprintf(display_file(), "%s\n", line);
 }
 
 static const struct {
@@ -94,4 +94,8 @@ void packet_ctrl_command(struct timeval *tv, struct ucred *cred, uint16_t index,
 void packet_ctrl_event(struct timeval *tv, struct ucred *cred, uint16_t index,
 					const void *data, uint16_t size);
 
+void *packet_save_state(void);
+void packet_restore_state(const void *state);
+void packet_free_state(void *state);
+
 void packet_todo(void);
@@ -26,6 +26,7 @@
 #include "gdbus/gdbus.h"
 #include "gobex/gobex.h"
 
+#include "obexd/src/obexd.h"
 #include "obexd/src/log.h"
 #include "transfer.h"
 #include "session.h"
@@ -66,6 +67,7 @@ struct pending_request {
 	session_callback_t func;
 	void *data;
 	destroy_t destroy;
+	gint64 started;		/* Start time of a running transfer */
 };
 
 struct setpath_data {
@@ -100,22 +102,89 @@ struct obc_session {
 	guint process_id;
 	char *folder;
 	struct callback_data *callback;
+	guint64 transferred;	/* Bytes moved by finished transfers */
+	gint64 transfer_time;	/* Time spent on finished transfers */
 };
 
 static GSList *sessions = NULL;
 
+/* Transfers running across all sessions and the sessions waiting, in
+ * order, for one of them to finish when a limit is set.
+ */
+static unsigned int running_transfers = 0;
+static GSList *waiting_sessions = NULL;
+
 static void session_process_queue(struct obc_session *session);
 static void session_terminate_transfer(struct obc_session *session,
 					struct obc_transfer *transfer,
 					GError *gerr);
 static void transfer_complete(struct obc_transfer *transfer,
 					GError *err, void *user_data);
+static gboolean session_process(gpointer data);
 
 static GQuark obex_io_error_quark(void)
 {
 	return g_quark_from_static_string("obex-io-error-quark");
 }
 
+static void wake_waiting_session(void)
+{
+	struct obc_session *session;
+	unsigned int max = obex_option_max_transfers();
+
+	if (waiting_sessions == NULL)
+		return;
+
+	if (max > 0 && running_transfers >= max)
+		return;
+
+	session = waiting_sessions->data;
+
+	if (session->process_id == 0)
+		session->process_id = g_idle_add(session_process, session);
+}
+
+static gboolean transfer_slot_available(struct obc_session *session)
+{
+	unsigned int max = obex_option_max_transfers();
+
+	if (max == 0)
+		return TRUE;
+
+	if (running_transfers >= max)
+		return FALSE;
+
+	/* Sessions that have been waiting longer go first */
+	return waiting_sessions == NULL || waiting_sessions->data == session;
+}
+
+static void transfer_slot_wait(struct obc_session *session)
+{
+	if (g_slist_find(waiting_sessions, session))
+		return;
+
+	DBG("Session(%p) waiting, %u transfers running", session,
+							running_transfers);
+
+	waiting_sessions = g_slist_append(waiting_sessions, session);
+}
+
+static void transfer_slot_leave(struct obc_session *session)
+{
+	gboolean first;
+
+	if (waiting_sessions == NULL)
+		return;
+
+	first = waiting_sessions->data == session;
+
+	waiting_sessions = g_slist_remove(waiting_sessions, session);
+
+	/* Let the next session in line have the slot it was holding */
+	if (first)
+		wake_waiting_session();
+}
+
 struct obc_session *obc_session_ref(struct obc_session *session)
 {
 	int refs = __sync_add_and_fetch(&session->refcount, 1);
@@ -164,11 +233,27 @@ static struct pending_request *pending_request_new(struct obc_session *session,
 	return p;
 }
 
+static void transfer_finished(struct pending_request *p)
+{
+	struct obc_session *session = p->session;
+
+	session->transferred += obc_transfer_get_transferred(p->transfer);
+	session->transfer_time += g_get_monotonic_time() - p->started;
+
+	p->started = 0;
+	running_transfers--;
+
+	wake_waiting_session();
+}
+
 static void pending_request_free(struct pending_request *p)
 {
 	if (p->req_id > 0)
 		g_obex_cancel_req(p->session->obex, p->req_id, TRUE);
 
+	if (p->started > 0)
+		transfer_finished(p);
+
 	if (p->destroy)
 		p->destroy(p->data);
 
@@ -210,6 +295,8 @@ static void session_free(struct obc_session *session)
 	if (session->process_id != 0)
 		g_source_remove(session->process_id);
 
+	transfer_slot_leave(session);
+
 	if (session->queue) {
 		g_queue_foreach(session->queue, request_free, NULL);
 		g_queue_free(session->queue);
@@ -371,7 +458,7 @@ static void transport_func(GIOChannel *io, GError *err, gpointer user_data)
 	else
 		type = G_OBEX_TRANSPORT_STREAM;
 
-	obex = g_obex_new(io, type, tx_mtu, rx_mtu);
+	obex = g_obex_new(io, type, rx_mtu, tx_mtu);
 	if (obex == NULL)
 		goto done;
 
@@ -762,6 +849,32 @@ static gboolean get_channel(const GDBusPropertyTable *property,
 	return TRUE;
 }
 
+static gboolean get_transferred(const GDBusPropertyTable *property,
+					DBusMessageIter *iter, void *data)
+{
+	struct obc_session *session = data;
+
+	dbus_message_iter_append_basic(iter, DBUS_TYPE_UINT64,
+							&session->transferred);
+
+	return TRUE;
+}
+
+static gboolean get_throughput(const GDBusPropertyTable *property,
+					DBusMessageIter *iter, void *data)
+{
+	struct obc_session *session = data;
+	guint64 rate = 0;
+
+	if (session->transfer_time > 0)
+		rate = session->transferred * G_USEC_PER_SEC /
+							session->transfer_time;
+
+	dbus_message_iter_append_basic(iter, DBUS_TYPE_UINT64, &rate);
+
+	return TRUE;
+}
+
 static const GDBusMethodTable session_methods[] = {
 	{ GDBUS_ASYNC_METHOD("GetCapabilities",
 				NULL, GDBUS_ARGS({ "capabilities", "s" }),
@@ -795,6 +908,8 @@ static const GDBusPropertyTable session_properties[] = {
 	{ "Destination", "s", get_destination },
 	{ "Channel", "y", get_channel },
 	{ "Target", "s", get_target, NULL, target_exists },
+	{ "Transferred", "t", get_transferred },
+	{ "Throughput", "t", get_throughput },
 	{ }
 };
 
@@ -818,6 +933,17 @@ static void session_queue(struct pending_request *p)
 								p->session);
 }
 
+/* Reads ahead the file of the next queued transfer so it is ready as soon
+ * as the current one completes.
+ */
+static void session_prefetch(struct obc_session *session)
+{
+	struct pending_request *next = g_queue_peek_head(session->queue);
+
+	if (next != NULL && next->transfer != NULL)
+		obc_transfer_prefetch(next->transfer);
+}
+
 static int session_process_transfer(struct pending_request *p, GError **err)
 {
 	if (!obc_transfer_start(p->transfer, p->session->obex, err))
@@ -825,6 +951,11 @@ static int session_process_transfer(struct pending_request *p, GError **err)
 
 	DBG("Tranfer(%p) started", p->transfer);
 	p->session->p = p;
+	p->started = g_get_monotonic_time();
+	running_transfers++;
+
+	session_prefetch(p->session);
+
 	return 0;
 }
 
@@ -853,6 +984,10 @@ guint obc_session_queue(struct obc_session *session,
 	p = pending_request_new(session, session_process_transfer, transfer,
 							func, user_data, NULL);
 	session_queue(p);
+
+	if (session->p != NULL && session->p->started > 0)
+		session_prefetch(session);
+
 	return p->id;
 }
 
@@ -863,14 +998,23 @@ static void session_process_queue(struct obc_session *session)
 	if (session->p != NULL)
 		return;
 
-	if (session->queue == NULL || g_queue_is_empty(session->queue))
+	if (session->queue == NULL || g_queue_is_empty(session->queue)) {
+		transfer_slot_leave(session);
 		return;
+	}
 
 	obc_session_ref(session);
 
-	while ((p = g_queue_pop_head(session->queue))) {
+	while ((p = g_queue_peek_head(session->queue))) {
 		GError *gerr = NULL;
 
+		if (p->transfer != NULL && !transfer_slot_available(session)) {
+			transfer_slot_wait(session);
+			goto done;
+		}
+
+		g_queue_pop_head(session->queue);
+
 		if (p->process(p, &gerr) == 0)
 			break;
 
@@ -882,6 +1026,9 @@ static void session_process_queue(struct obc_session *session)
 		pending_request_free(p);
 	}
 
+	transfer_slot_leave(session);
+
+done:
 	obc_session_unref(session);
 }
 
@@ -920,6 +1067,15 @@ static void session_terminate_transfer(struct obc_session *session,
 	if (p->func)
 		p->func(session, p->transfer, gerr, p->data);
 
+	if (p->started > 0) {
+		transfer_finished(p);
+
+		g_dbus_emit_property_changed(session->conn, session->path,
+					SESSION_INTERFACE, "Transferred");
+		g_dbus_emit_property_changed(session->conn, session->path,
+					SESSION_INTERFACE, "Throughput");
+	}
+
 	pending_request_free(p);
 
 	if (session->p == NULL)
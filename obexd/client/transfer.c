@@ -37,6 +37,9 @@
 
 #define FIRST_PACKET_TIMEOUT 60
 
+/* Amount of a queued file read ahead before its transfer starts */
+#define TRANSFER_READAHEAD (1024 * 1024)
+
 static guint64 counter = 0;
 
 struct transfer_callback {
@@ -74,6 +77,7 @@ struct obc_transfer {
 	gint64 transferred;
 	gint64 progress;
 	guint progress_id;
+	gboolean prefetched;
 };
 
 static GQuark obc_transfer_error_quark(void)
@@ -899,6 +903,24 @@ gboolean obc_transfer_start(struct obc_transfer *transfer, void *obex,
 	return FALSE;
 }
 
+void obc_transfer_prefetch(struct obc_transfer *transfer)
+{
+	int err;
+
+	if (transfer->op != G_OBEX_OP_PUT || transfer->fd <= 0 ||
+				transfer->xfer > 0 || transfer->prefetched)
+		return;
+
+	transfer->prefetched = TRUE;
+
+	err = posix_fadvise(transfer->fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	if (err == 0)
+		err = posix_fadvise(transfer->fd, 0, TRANSFER_READAHEAD,
+							POSIX_FADV_WILLNEED);
+	if (err != 0)
+		DBG("posix_fadvise(): %s(%d)", strerror(err), err);
+}
+
 guint8 obc_transfer_get_operation(struct obc_transfer *transfer)
 {
 	return transfer->op;
@@ -965,3 +987,8 @@ gint64 obc_transfer_get_size(struct obc_transfer *transfer)
 {
 	return transfer->size;
 }
+
+gint64 obc_transfer_get_transferred(struct obc_transfer *transfer)
+{
+	return transfer->transferred;
+}
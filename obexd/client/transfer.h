@@ -35,6 +35,7 @@ gboolean obc_transfer_set_callback(struct obc_transfer *transfer,
 
 gboolean obc_transfer_start(struct obc_transfer *transfer, void *obex,
 								GError **err);
+void obc_transfer_prefetch(struct obc_transfer *transfer);
 guint8 obc_transfer_get_operation(struct obc_transfer *transfer);
 
 void obc_transfer_set_apparam(struct obc_transfer *transfer, void *data);
@@ -44,6 +45,7 @@ int obc_transfer_get_contents(struct obc_transfer *transfer, char **contents,
 
 const char *obc_transfer_get_path(struct obc_transfer *transfer);
 gint64 obc_transfer_get_size(struct obc_transfer *transfer);
+gint64 obc_transfer_get_transferred(struct obc_transfer *transfer);
 
 DBusMessage *obc_transfer_create_dbus_reply(struct obc_transfer *transfer,
 							DBusMessage *message);
@@ -26,6 +26,8 @@
 #include <sys/sendfile.h>
 #include <fcntl.h>
 #include <sys/wait.h>
+#include <sys/syscall.h>
+#include <sys/inotify.h>
 #include <inttypes.h>
 
 #include <glib.h>
@@ -107,12 +109,35 @@ int verify_path(const char *path)
 	return ret;
 }
 
-static char *file_stat_line(char *filename, struct stat *fstat,
-					struct stat *dstat, gboolean root,
-					gboolean pcsuite)
+static gboolean needs_escape(const char *name)
+{
+	for (; *name; name++) {
+		switch (*name) {
+		case '&':
+		case '<':
+		case '>':
+		case '\'':
+		case '"':
+			return TRUE;
+		}
+
+		if ((unsigned char) *name < 0x20 || *name == 0x7f)
+			return TRUE;
+	}
+
+	return FALSE;
+}
+
+static void append_stat_line(GString *object, const char *filename,
+					struct stat *fstat, struct stat *dstat,
+					gboolean root, gboolean pcsuite)
 {
 	char perm[51], atime[18], ctime[18], mtime[18];
-	char *escaped, *ret = NULL;
+	char *escaped = NULL;
+	const char *name = filename;
+
+	if (!S_ISDIR(fstat->st_mode) && !S_ISREG(fstat->st_mode))
+		return;
 
 	snprintf(perm, 50, "user-perm=\"%s%s%s\" group-perm=\"%s%s%s\" "
 			"other-perm=\"%s%s%s\"",
@@ -130,24 +155,28 @@ static char *file_stat_line(char *filename, struct stat *fstat,
 	strftime(ctime, 17, "%Y%m%dT%H%M%SZ", gmtime(&fstat->st_ctime));
 	strftime(mtime, 17, "%Y%m%dT%H%M%SZ", gmtime(&fstat->st_mtime));
 
-	escaped = g_markup_escape_text(filename, -1);
+	/* Most names need no escaping, avoid the copy for those */
+	if (needs_escape(filename)) {
+		escaped = g_markup_escape_text(filename, -1);
+		name = escaped;
+	}
 
 	if (S_ISDIR(fstat->st_mode)) {
 		if (pcsuite && root && g_str_equal(filename, "Data"))
-			ret = g_strdup_printf(FL_FOLDER_ELEMENT_PCSUITE,
-						escaped, perm, atime,
+			g_string_append_printf(object,
+						FL_FOLDER_ELEMENT_PCSUITE,
+						name, perm, atime,
 						mtime, ctime);
 		else
-			ret = g_strdup_printf(FL_FOLDER_ELEMENT, escaped, perm,
-							atime, mtime, ctime);
-	} else if (S_ISREG(fstat->st_mode))
-		ret = g_strdup_printf(FL_FILE_ELEMENT, escaped,
+			g_string_append_printf(object, FL_FOLDER_ELEMENT,
+						name, perm, atime, mtime,
+						ctime);
+	} else
+		g_string_append_printf(object, FL_FILE_ELEMENT, name,
 					(uint64_t) fstat->st_size,
 					perm, atime, mtime, ctime);
 
 	g_free(escaped);
-
-	return ret;
 }
 
 static void *filesystem_open(const char *name, int oflag, mode_t mode,
@@ -447,136 +476,488 @@ fail:
 	return NULL;
 }
 
-static GString *append_pcsuite_preamble(GString *object)
+struct linux_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+
+#define LISTING_DENTS_SIZE	32768
+
+/* Complete listings of recently browsed folders */
+#define LISTING_CACHE_ENTRIES	8
+#define LISTING_CACHE_MAX_SIZE	(4 * 1024 * 1024)
+#define LISTING_CACHE_TIMEOUT	30	/* seconds */
+
+/* Changes to the folder or to any file in it invalidate its listing */
+#define LISTING_EVENTS	(IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | \
+			IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | \
+			IN_DELETE_SELF | IN_MOVE_SELF)
+
+struct listing_cache {
+	int refs;
+	int wd;
+	char *path;
+	gboolean pcsuite;
+	dev_t dev;
+	ino_t ino;
+	struct timespec mtime;
+	struct timespec ctime;
+	gint64 created;
+	GString *text;
+};
+
+struct folder_listing {
+	int dirfd;
+	char *path;
+	struct stat dstat;
+	gboolean root;
+	gboolean pcsuite;
+	gboolean cacheable;
+	gboolean eof;
+	int wd;
+	unsigned int events;
+	struct listing_cache *cache;
+	GString *text;
+	size_t offset;
+	size_t dents_len;
+	size_t dents_pos;
+	char dents[LISTING_DENTS_SIZE];
+};
+
+static GList *listing_cache;
+static int listing_notify_fd = -1;
+static guint listing_notify_id;
+static unsigned int listing_events;
+
+static void listing_cache_unref(struct listing_cache *cache)
 {
-	return g_string_append(object, FL_TYPE_PCSUITE);
+	if (--cache->refs > 0)
+		return;
+
+	g_string_free(cache->text, TRUE);
+	g_free(cache->path);
+	g_free(cache);
 }
 
-static GString *append_folder_preamble(GString *object)
+static void listing_unwatch(int wd)
 {
-	return g_string_append(object, FL_TYPE);
+	GList *l;
+
+	if (wd < 0 || listing_notify_fd < 0)
+		return;
+
+	/* Both listing types of a folder share its watch */
+	for (l = listing_cache; l; l = l->next) {
+		struct listing_cache *cache = l->data;
+
+		if (cache->wd == wd)
+			return;
+	}
+
+	inotify_rm_watch(listing_notify_fd, wd);
 }
 
-static GString *append_listing(GString *object, const char *name,
-				gboolean pcsuite, size_t *size, int *err)
+static void listing_cache_remove(GList *l)
 {
-	struct stat fstat, dstat;
-	struct dirent *ep;
-	DIR *dp;
-	gboolean root;
-	int ret;
+	struct listing_cache *cache = l->data;
 
-	root = g_str_equal(name, obex_option_root_folder());
+	listing_cache = g_list_delete_link(listing_cache, l);
+	listing_unwatch(cache->wd);
+	listing_cache_unref(cache);
+}
 
-	dp = opendir(name);
-	if (dp == NULL) {
-		if (err)
-			*err = -ENOENT;
-		goto failed;
+static void listing_cache_clear(void)
+{
+	g_list_free_full(listing_cache, (GDestroyNotify) listing_cache_unref);
+	listing_cache = NULL;
+
+	if (listing_notify_id > 0) {
+		g_source_remove(listing_notify_id);
+		listing_notify_id = 0;
 	}
 
-	if (!root)
-		object = g_string_append(object, FL_PARENT_FOLDER_ELEMENT);
+	if (listing_notify_fd >= 0) {
+		close(listing_notify_fd);
+		listing_notify_fd = -1;
+	}
+}
 
-	ret = verify_path(name);
-	if (ret < 0) {
-		*err = ret;
+static gboolean listing_notify_cb(GIOChannel *io, GIOCondition cond,
+							gpointer user_data)
+{
+	char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	ssize_t len, pos;
+
+	if (cond & (G_IO_ERR | G_IO_HUP | G_IO_NVAL))
 		goto failed;
-	}
 
-	ret = stat(name, &dstat);
-	if (ret < 0) {
-		if (err)
-			*err = -errno;
+	len = read(listing_notify_fd, buf, sizeof(buf));
+	if (len < 0) {
+		if (errno == EAGAIN || errno == EINTR)
+			return TRUE;
+
 		goto failed;
 	}
 
-	while ((ep = readdir(dp))) {
-		char *filename;
-		char *fullname;
-		char *line;
+	for (pos = 0; pos < len; ) {
+		struct inotify_event *ev = (void *) (buf + pos);
+		GList *l, *next;
 
-		if (ep->d_name[0] == '.')
-			continue;
+		pos += sizeof(*ev) + ev->len;
 
-		filename = g_filename_to_utf8(ep->d_name, -1, NULL, NULL, NULL);
-		if (filename == NULL) {
-			error("g_filename_to_utf8: invalid filename");
-			continue;
+		/* Listings being generated are not cached after this */
+		listing_events++;
+
+		for (l = listing_cache; l; l = next) {
+			struct listing_cache *cache = l->data;
+
+			next = l->next;
+
+			if (cache->wd != ev->wd)
+				continue;
+
+			/* The watch is already gone once ignored */
+			if (ev->mask & IN_IGNORED)
+				cache->wd = -1;
+
+			DBG("%s: dropping cached listing", cache->path);
+
+			listing_cache_remove(l);
 		}
+	}
 
-		fullname = g_build_filename(name, ep->d_name, NULL);
+	return TRUE;
 
-		ret = stat(fullname, &fstat);
-		if (ret < 0) {
-			DBG("stat: %s(%d)", strerror(errno), errno);
-			g_free(filename);
-			g_free(fullname);
-			continue;
+failed:
+	error("filesystem: folder change notifications stopped");
+	listing_notify_id = 0;
+	listing_events++;
+	listing_cache_clear();
+
+	return FALSE;
+}
+
+/* Returns a watch for changes in path, or -1 if it cannot be cached */
+static int listing_watch(const char *path)
+{
+	GIOChannel *io;
+	int wd;
+
+	if (listing_notify_fd < 0) {
+		listing_notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (listing_notify_fd < 0) {
+			DBG("inotify_init1: %s(%d)", strerror(errno), errno);
+			return -1;
 		}
 
-		g_free(fullname);
+		io = g_io_channel_unix_new(listing_notify_fd);
+		listing_notify_id = g_io_add_watch(io, G_IO_IN | G_IO_ERR |
+						G_IO_HUP | G_IO_NVAL,
+						listing_notify_cb, NULL);
+		g_io_channel_unref(io);
+	}
+
+	wd = inotify_add_watch(listing_notify_fd, path, LISTING_EVENTS);
+	if (wd < 0)
+		DBG("inotify_add_watch(%s): %s(%d)", path, strerror(errno),
+									errno);
+
+	return wd;
+}
+
+static gboolean timespec_equal(const struct timespec *a,
+						const struct timespec *b)
+{
+	return a->tv_sec == b->tv_sec && a->tv_nsec == b->tv_nsec;
+}
 
-		line = file_stat_line(filename, &fstat, &dstat, root, FALSE);
-		if (line == NULL) {
-			g_free(filename);
+static struct listing_cache *listing_cache_find(const char *path,
+						gboolean pcsuite,
+						const struct stat *dstat)
+{
+	gint64 now = g_get_monotonic_time();
+	GList *l;
+
+	for (l = listing_cache; l; l = l->next) {
+		struct listing_cache *cache = l->data;
+
+		if (cache->pcsuite != pcsuite || !g_str_equal(cache->path, path))
 			continue;
+
+		if (cache->dev != dstat->st_dev || cache->ino != dstat->st_ino ||
+				!timespec_equal(&cache->mtime, &dstat->st_mtim) ||
+				!timespec_equal(&cache->ctime, &dstat->st_ctim) ||
+				now - cache->created >
+				LISTING_CACHE_TIMEOUT * G_USEC_PER_SEC) {
+			listing_cache_remove(l);
+			return NULL;
+		}
+
+		/* Keep the most recently used entry first */
+		listing_cache = g_list_remove_link(listing_cache, l);
+		listing_cache = g_list_concat(l, listing_cache);
+
+		return cache;
+	}
+
+	return NULL;
+}
+
+static void listing_cache_add(struct folder_listing *listing)
+{
+	struct listing_cache *cache;
+	GList *last;
+
+	cache = g_new0(struct listing_cache, 1);
+	cache->refs = 2;
+	cache->wd = listing->wd;
+	cache->path = listing->path;
+	cache->pcsuite = listing->pcsuite;
+	cache->dev = listing->dstat.st_dev;
+	cache->ino = listing->dstat.st_ino;
+	cache->mtime = listing->dstat.st_mtim;
+	cache->ctime = listing->dstat.st_ctim;
+	cache->created = g_get_monotonic_time();
+	cache->text = listing->text;
+
+	/* The listing now reads from the cached copy */
+	listing->wd = -1;
+	listing->path = NULL;
+	listing->cache = cache;
+
+	listing_cache = g_list_prepend(listing_cache, cache);
+
+	if (g_list_length(listing_cache) <= LISTING_CACHE_ENTRIES)
+		return;
+
+	last = g_list_last(listing_cache);
+	listing_cache_remove(last);
+}
+
+static void append_entry(struct folder_listing *listing, const char *name,
+							unsigned char type)
+{
+	struct stat fstat;
+	char *filename = NULL;
+
+	if (name[0] == '.')
+		return;
+
+	/* Only files and folders are listed, skip anything else early */
+	if (type != DT_REG && type != DT_DIR && type != DT_LNK &&
+							type != DT_UNKNOWN)
+		return;
+
+	if (!g_get_filename_charsets(NULL)) {
+		filename = g_filename_to_utf8(name, -1, NULL, NULL, NULL);
+		if (filename == NULL) {
+			error("g_filename_to_utf8: invalid filename");
+			return;
 		}
+	} else if (!g_utf8_validate(name, -1, NULL)) {
+		error("g_filename_to_utf8: invalid filename");
+		return;
+	}
 
+	if (fstatat(listing->dirfd, name, &fstat, 0) < 0) {
+		DBG("stat: %s(%d)", strerror(errno), errno);
 		g_free(filename);
+		return;
+	}
+
+	append_stat_line(listing->text, filename ? filename : name, &fstat,
+					&listing->dstat, listing->root, FALSE);
+
+	g_free(filename);
+}
+
+/* Appends the entries of the next batch of directory records */
+static int listing_fill(struct folder_listing *listing)
+{
+	if (listing->dents_pos >= listing->dents_len) {
+		long ret;
 
-		object = g_string_append(object, line);
-		g_free(line);
+		ret = syscall(SYS_getdents64, listing->dirfd, listing->dents,
+						sizeof(listing->dents));
+		if (ret < 0)
+			return -errno;
+
+		if (ret == 0) {
+			g_string_append(listing->text, FL_BODY_END);
+			listing->eof = TRUE;
+			return 0;
+		}
+
+		listing->dents_len = ret;
+		listing->dents_pos = 0;
 	}
 
-	closedir(dp);
+	while (listing->dents_pos < listing->dents_len) {
+		struct linux_dirent64 *ep;
+
+		ep = (void *) (listing->dents + listing->dents_pos);
+		listing->dents_pos += ep->d_reclen;
 
-	object = g_string_append(object, FL_BODY_END);
-	if (size)
-		*size = object->len;
+		append_entry(listing, ep->d_name, ep->d_type);
+	}
+
+	if (listing->text->len > LISTING_CACHE_MAX_SIZE)
+		listing->cacheable = FALSE;
+
+	return 0;
+}
+
+static void listing_free(struct folder_listing *listing)
+{
+	if (listing->dirfd >= 0)
+		close(listing->dirfd);
+
+	listing_unwatch(listing->wd);
+
+	if (listing->cache)
+		listing_cache_unref(listing->cache);
+	else if (listing->text)
+		g_string_free(listing->text, TRUE);
+
+	g_free(listing->path);
+	g_free(listing);
+}
+
+static void *listing_open(const char *name, gboolean pcsuite, size_t *size,
+								int *err)
+{
+	struct folder_listing *listing;
+	struct listing_cache *cache;
+	int ret;
+
+	listing = g_new0(struct folder_listing, 1);
+	listing->wd = -1;
+	listing->pcsuite = pcsuite;
+	listing->root = g_str_equal(name, obex_option_root_folder());
+
+	listing->dirfd = open(name, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (listing->dirfd < 0) {
+		ret = -ENOENT;
+		goto failed;
+	}
+
+	ret = verify_path(name);
+	if (ret < 0)
+		goto failed;
 
+	if (fstat(listing->dirfd, &listing->dstat) < 0) {
+		ret = -errno;
+		goto failed;
+	}
+
+	cache = listing_cache_find(name, pcsuite, &listing->dstat);
+	if (cache) {
+		DBG("%s: using cached listing", name);
+
+		close(listing->dirfd);
+		listing->dirfd = -1;
+		listing->cache = cache;
+		listing->text = cache->text;
+		listing->eof = TRUE;
+		cache->refs++;
+
+		if (size)
+			*size = cache->text->len;
+
+		goto done;
+	}
+
+	listing->path = g_strdup(name);
+
+	/* Folders modified within the timestamp granularity of some file
+	 * systems may change again without a visible mtime update.
+	 */
+	listing->cacheable = time(NULL) - listing->dstat.st_mtime > 1;
+
+	/* Files rewritten in place do not change the folder itself */
+	if (listing->cacheable) {
+		listing->events = listing_events;
+		listing->wd = listing_watch(name);
+		listing->cacheable = listing->wd >= 0;
+	}
+
+	listing->text = g_string_new(FL_VERSION);
+	g_string_append(listing->text, pcsuite ? FL_TYPE_PCSUITE : FL_TYPE);
+	g_string_append(listing->text, FL_BODY_BEGIN);
+
+	if (!listing->root)
+		g_string_append(listing->text, FL_PARENT_FOLDER_ELEMENT);
+
+done:
 	if (err)
 		*err = 0;
 
-	return object;
+	return listing;
 
 failed:
-	if (dp)
-		closedir(dp);
+	if (err)
+		*err = ret;
 
-	g_string_free(object, TRUE);
+	listing_free(listing);
 	return NULL;
 }
 
 static void *folder_open(const char *name, int oflag, mode_t mode,
 					void *context, size_t *size, int *err)
 {
-	GString *object;
-
-	object = g_string_new(FL_VERSION);
-	object = append_folder_preamble(object);
-	object = g_string_append(object, FL_BODY_BEGIN);
-
-	return append_listing(object, name, FALSE, size, err);
+	return listing_open(name, FALSE, size, err);
 }
 
 static void *pcsuite_open(const char *name, int oflag, mode_t mode,
 					void *context, size_t *size, int *err)
 {
-	GString *object;
+	return listing_open(name, TRUE, size, err);
+}
+
+/* Generates the listing as the body is read, only the part that has not
+ * been sent yet is kept in memory unless the listing is to be cached.
+ */
+static ssize_t folder_read(void *object, void *buf, size_t count)
+{
+	struct folder_listing *listing = object;
+	size_t len;
+
+	while (listing->text->len - listing->offset < count && !listing->eof) {
+		int err;
+
+		err = listing_fill(listing);
+		if (err < 0)
+			return err;
+	}
+
+	if (listing->eof && listing->events != listing_events)
+		listing->cacheable = FALSE;
+
+	if (listing->eof && listing->cacheable && !listing->cache) {
+		close(listing->dirfd);
+		listing->dirfd = -1;
+		listing_cache_add(listing);
+	}
+
+	len = MIN(listing->text->len - listing->offset, count);
+	memcpy(buf, listing->text->str + listing->offset, len);
+	listing->offset += len;
 
-	object = g_string_new(FL_VERSION);
-	object = append_pcsuite_preamble(object);
-	object = g_string_append(object, FL_BODY_BEGIN);
+	if (!listing->cacheable && !listing->cache &&
+				listing->offset == listing->text->len) {
+		g_string_truncate(listing->text, 0);
+		listing->offset = 0;
+	}
 
-	return append_listing(object, name, TRUE, size, err);
+	return len;
 }
 
-static int string_free(void *object)
+static int folder_close(void *object)
 {
-	GString *string = object;
-
-	g_string_free(string, TRUE);
+	listing_free(object);
 
 	return 0;
 }
@@ -596,11 +977,6 @@ ssize_t string_read(void *object, void *buf, size_t count)
 	return len;
 }
 
-static ssize_t folder_read(void *object, void *buf, size_t count)
-{
-	return string_read(object, buf, count);
-}
-
 static ssize_t capability_read(void *object, void *buf, size_t count)
 {
 	struct capability_object *obj = object;
@@ -666,7 +1042,7 @@ static struct obex_mime_type_driver folder = {
 	.target_size = FTP_TARGET_SIZE,
 	.mimetype = "x-obex/folder-listing",
 	.open = folder_open,
-	.close = string_free,
+	.close = folder_close,
 	.read = folder_read,
 };
 
@@ -677,7 +1053,7 @@ static struct obex_mime_type_driver pcsuite = {
 	.who_size = PCSUITE_WHO_SIZE,
 	.mimetype = "x-obex/folder-listing",
 	.open = pcsuite_open,
-	.close = string_free,
+	.close = folder_close,
 	.read = folder_read,
 };
 
@@ -705,6 +1081,8 @@ static void filesystem_exit(void)
 	obex_mime_type_driver_unregister(&folder);
 	obex_mime_type_driver_unregister(&capability);
 	obex_mime_type_driver_unregister(&file);
+
+	listing_cache_clear();
 }
 
 OBEX_PLUGIN_DEFINE(filesystem, filesystem_init, filesystem_exit)
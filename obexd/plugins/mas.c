@@ -50,6 +50,18 @@
 #define ML_BODY_BEGIN "<MAP-msg-listing version=\"1.0\">"
 #define ML_BODY_END "</MAP-msg-listing>"
 
+/* Listings recently sent in a session, dropped on backend change events */
+#define LISTING_CACHE_ENTRIES	16
+#define LISTING_CACHE_MAX_SIZE	(512 * 1024)
+
+struct listing_cache {
+	char *key;
+	char *folder;
+	GString *body;
+	uint16_t size;
+	gboolean newmsg;
+};
+
 struct mas_session {
 	struct mas_request *request;
 	void *backend_data;
@@ -60,6 +72,15 @@ struct mas_session {
 	GObexApparam *outparams;
 	gboolean ap_sent;
 	uint8_t notification_status;
+	char *folder;
+	uint16_t count;
+	gboolean cache_enabled;
+	GList *cache;
+	size_t cache_size;
+	char *pending_key;
+	char *pending_folder;
+	unsigned int cache_hits;
+	unsigned int cache_misses;
 };
 
 static const uint8_t MAS_TARGET[TARGET_SIZE] = {
@@ -84,6 +105,160 @@ static int get_params(struct obex_session *os, struct mas_session *mas)
 	return 0;
 }
 
+static void listing_cache_free(struct listing_cache *cache)
+{
+	g_string_free(cache->body, TRUE);
+	g_free(cache->folder);
+	g_free(cache->key);
+	g_free(cache);
+}
+
+static void listing_cache_remove(struct mas_session *mas, GList *l)
+{
+	struct listing_cache *cache = l->data;
+
+	mas->cache_size -= cache->body->len;
+	mas->cache = g_list_delete_link(mas->cache, l);
+	listing_cache_free(cache);
+}
+
+static void listing_cache_clear(struct mas_session *mas)
+{
+	while (mas->cache)
+		listing_cache_remove(mas, mas->cache);
+}
+
+static struct listing_cache *listing_cache_find(struct mas_session *mas,
+							const char *key)
+{
+	GList *l;
+
+	for (l = mas->cache; l; l = l->next) {
+		struct listing_cache *cache = l->data;
+
+		if (!g_str_equal(cache->key, key))
+			continue;
+
+		/* Keep the most recently used entry first */
+		mas->cache = g_list_remove_link(mas->cache, l);
+		mas->cache = g_list_concat(l, mas->cache);
+
+		return cache;
+	}
+
+	return NULL;
+}
+
+/* Keeps the listing that was just completed for the pending request */
+static void listing_cache_add(struct mas_session *mas, uint16_t size,
+							gboolean newmsg)
+{
+	struct listing_cache *cache;
+
+	if (!mas->pending_key || mas->buffer->len > LISTING_CACHE_MAX_SIZE)
+		return;
+
+	cache = g_new0(struct listing_cache, 1);
+	cache->key = mas->pending_key;
+	cache->folder = mas->pending_folder;
+	cache->body = g_string_new_len(mas->buffer->str, mas->buffer->len);
+	cache->size = size;
+	cache->newmsg = newmsg;
+
+	mas->pending_key = NULL;
+	mas->pending_folder = NULL;
+
+	mas->cache = g_list_prepend(mas->cache, cache);
+	mas->cache_size += cache->body->len;
+
+	while (g_list_length(mas->cache) > LISTING_CACHE_ENTRIES ||
+				mas->cache_size > LISTING_CACHE_MAX_SIZE)
+		listing_cache_remove(mas, g_list_last(mas->cache));
+}
+
+static gboolean folder_equal(const char *a, const char *b)
+{
+	while (*a == '/')
+		a++;
+
+	while (*b == '/')
+		b++;
+
+	return g_ascii_strcasecmp(a, b) == 0;
+}
+
+static void listing_cache_invalidate(struct mas_session *mas,
+							const char *folder)
+{
+	GList *l, *next;
+
+	if (mas->pending_folder && (!folder ||
+				folder_equal(mas->pending_folder, folder))) {
+		g_free(mas->pending_key);
+		mas->pending_key = NULL;
+	}
+
+	for (l = mas->cache; l; l = next) {
+		struct listing_cache *cache = l->data;
+
+		next = l->next;
+
+		if (!folder || folder_equal(cache->folder, folder))
+			listing_cache_remove(mas, l);
+	}
+}
+
+static void listing_event_cb(void *session, const struct messages_event *event,
+							void *user_data)
+{
+	struct mas_session *mas = user_data;
+
+	DBG("type %d folder %s old_folder %s", event->type, event->folder,
+							event->old_folder);
+
+	listing_cache_invalidate(mas, event->folder);
+
+	if (event->old_folder)
+		listing_cache_invalidate(mas, event->old_folder);
+}
+
+/* Returns the folder being listed, relative to the root */
+static char *listing_folder(struct mas_session *mas, const char *name)
+{
+	if (!name || name[0] == '\0')
+		return g_strdup(mas->folder);
+
+	return g_build_filename(mas->folder, name, NULL);
+}
+
+/* Serves the request from the cache if possible, otherwise the listing is
+ * cached once completed. Takes ownership of key and folder.
+ */
+static struct listing_cache *listing_cache_open(struct mas_session *mas,
+						char *key, char *folder)
+{
+	struct listing_cache *cache;
+
+	cache = listing_cache_find(mas, key);
+	if (!cache) {
+		mas->cache_misses++;
+		mas->pending_key = key;
+		mas->pending_folder = folder;
+		return NULL;
+	}
+
+	DBG("%s: using cached listing", key);
+
+	mas->cache_hits++;
+	g_free(key);
+	g_free(folder);
+
+	mas->buffer = g_string_new_len(cache->body->str, cache->body->len);
+	mas->finished = TRUE;
+
+	return cache;
+}
+
 static void reset_request(struct mas_session *mas)
 {
 	if (mas->buffer) {
@@ -101,14 +276,22 @@ static void reset_request(struct mas_session *mas)
 		mas->outparams = NULL;
 	}
 
+	g_free(mas->pending_key);
+	mas->pending_key = NULL;
+	g_free(mas->pending_folder);
+	mas->pending_folder = NULL;
+
 	mas->nth_call = FALSE;
 	mas->finished = FALSE;
 	mas->ap_sent = FALSE;
+	mas->count = 0;
 }
 
 static void mas_clean(struct mas_session *mas)
 {
 	reset_request(mas);
+	listing_cache_clear(mas);
+	g_free(mas->folder);
 	g_free(mas);
 }
 
@@ -124,6 +307,13 @@ static void *mas_connect(struct obex_session *os, int *err)
 	if (*err < 0)
 		goto failed;
 
+	mas->folder = g_strdup("");
+
+	/* Without change events there is no telling when a listing is stale */
+	if (messages_set_notification_registration(mas->backend_data,
+						listing_event_cb, mas) == 0)
+		mas->cache_enabled = TRUE;
+
 	manager_register_session(os);
 
 	return mas;
@@ -138,7 +328,8 @@ static void mas_disconnect(struct obex_session *os, void *user_data)
 {
 	struct mas_session *mas = user_data;
 
-	DBG("");
+	DBG("listing cache: %u hits, %u misses", mas->cache_hits,
+							mas->cache_misses);
 
 	manager_unregister_session(os);
 	messages_disconnect(mas->backend_data);
@@ -254,6 +445,26 @@ static const char *yesorno(gboolean a)
 	return "no";
 }
 
+static void set_messages_listing_params(struct mas_session *mas,
+						uint16_t size, gboolean newmsg)
+{
+	gchar *mse_time;
+
+	mas->outparams = g_obex_apparam_set_uint16(mas->outparams,
+						MAP_AP_MESSAGESLISTINGSIZE,
+						size);
+	mas->outparams = g_obex_apparam_set_uint8(mas->outparams,
+						MAP_AP_NEWMESSAGE,
+						newmsg ? 1 : 0);
+	/* Response to report the local time of MSE */
+	mse_time = get_mse_timestamp();
+	if (mse_time) {
+		g_obex_apparam_set_string(mas->outparams,
+					MAP_AP_MSETIME, mse_time);
+		g_free(mse_time);
+	}
+}
+
 static void get_messages_listing_cb(void *session, int err, uint16_t size,
 					gboolean newmsg,
 					const struct messages_message *entry,
@@ -261,7 +472,6 @@ static void get_messages_listing_cb(void *session, int err, uint16_t size,
 {
 	struct mas_session *mas = user_data;
 	uint16_t max = 1024;
-	gchar *mse_time;
 
 	if (err < 0 && err != -EAGAIN) {
 		obex_object_set_io_flags(mas, G_IO_ERR, err);
@@ -291,6 +501,12 @@ static void get_messages_listing_cb(void *session, int err, uint16_t size,
 		goto proceed;
 	}
 
+	/* Never render more than MaxListCount entries */
+	if (mas->count >= max)
+		goto proceed;
+
+	mas->count++;
+
 	g_string_append(mas->buffer, "<msg");
 
 	g_string_append_escaped_printf(mas->buffer, " handle=\"%s\"",
@@ -371,19 +587,8 @@ static void get_messages_listing_cb(void *session, int err, uint16_t size,
 
 proceed:
 	if (!entry) {
-		mas->outparams = g_obex_apparam_set_uint16(mas->outparams,
-						MAP_AP_MESSAGESLISTINGSIZE,
-						size);
-		mas->outparams = g_obex_apparam_set_uint8(mas->outparams,
-						MAP_AP_NEWMESSAGE,
-						newmsg ? 1 : 0);
-		/* Response to report the local time of MSE */
-		mse_time = get_mse_timestamp();
-		if (mse_time) {
-			g_obex_apparam_set_string(mas->outparams,
-						MAP_AP_MSETIME, mse_time);
-			g_free(mse_time);
-		}
+		set_messages_listing_params(mas, size, newmsg);
+		listing_cache_add(mas, size, newmsg);
 	}
 
 	if (err != -EAGAIN)
@@ -436,8 +641,10 @@ static void get_folder_listing_cb(void *session, int err, uint16_t size,
 						MAP_AP_FOLDERLISTINGSIZE,
 						size);
 
-		if (!name)
+		if (!name) {
 			mas->finished = TRUE;
+			listing_cache_add(mas, size, FALSE);
+		}
 
 		goto proceed;
 	}
@@ -448,6 +655,7 @@ static void get_folder_listing_cb(void *session, int err, uint16_t size,
 		if (!name) {
 			g_string_append(mas->buffer, FL_BODY_EMPTY);
 			mas->finished = TRUE;
+			listing_cache_add(mas, size, FALSE);
 			goto proceed;
 		}
 		g_string_append(mas->buffer, FL_BODY_BEGIN);
@@ -457,9 +665,15 @@ static void get_folder_listing_cb(void *session, int err, uint16_t size,
 	if (!name) {
 		g_string_append(mas->buffer, FL_BODY_END);
 		mas->finished = TRUE;
+		listing_cache_add(mas, size, FALSE);
 		goto proceed;
 	}
 
+	if (mas->count >= max)
+		goto proceed;
+
+	mas->count++;
+
 	if (g_strcmp0(name, "..") == 0)
 		g_string_append(mas->buffer, FL_PARENT_FOLDER_ELEMENT);
 	else
@@ -479,10 +693,39 @@ static void set_status_cb(void *session, int err, void *user_data)
 
 	mas->finished = TRUE;
 
-	if (err < 0)
+	if (err < 0) {
 		obex_object_set_io_flags(mas, G_IO_ERR, err);
+		return;
+	}
+
+	/* Status and inbox updates change listings without an event */
+	listing_cache_invalidate(mas, NULL);
+
+	obex_object_set_io_flags(mas, G_IO_OUT, 0);
+}
+
+/* Follows the current folder of the backend, see messages_set_folder */
+static void update_folder(struct mas_session *mas, const char *name,
+								gboolean cdup)
+{
+	char *parent = NULL;
+	char *folder;
+
+	if (cdup) {
+		parent = g_path_get_dirname(mas->folder);
+		if (g_str_equal(parent, "."))
+			parent[0] = '\0';
+	}
+
+	if (!cdup && (!name || name[0] == '\0'))
+		folder = g_strdup("");
 	else
-		obex_object_set_io_flags(mas, G_IO_OUT, 0);
+		folder = g_build_filename(parent ? parent : mas->folder, name,
+									NULL);
+
+	g_free(parent);
+	g_free(mas->folder);
+	mas->folder = folder;
 }
 
 static int mas_setpath(struct obex_session *os, void *user_data)
@@ -490,6 +733,7 @@ static int mas_setpath(struct obex_session *os, void *user_data)
 	const char *name;
 	const uint8_t *nonhdr;
 	struct mas_session *mas = user_data;
+	int err;
 
 	if (obex_get_non_header_data(os, &nonhdr) != 2) {
 		error("Set path failed: flag and constants not found!");
@@ -505,13 +749,20 @@ static int mas_setpath(struct obex_session *os, void *user_data)
 		return -EBADR;
 	}
 
-	return messages_set_folder(mas->backend_data, name, nonhdr[0] & 0x01);
+	err = messages_set_folder(mas->backend_data, name, nonhdr[0] & 0x01);
+	if (err < 0)
+		return err;
+
+	update_folder(mas, name, nonhdr[0] & 0x01);
+
+	return 0;
 }
 
 static void *folder_listing_open(const char *name, int oflag, mode_t mode,
 				void *driver_data, size_t *size, int *err)
 {
 	struct mas_session *mas = driver_data;
+	struct listing_cache *cache;
 	/* 1024 is the default when there was no MaxListCount sent */
 	uint16_t max = 1024;
 	uint16_t offset = 0;
@@ -530,6 +781,23 @@ static void *folder_listing_open(const char *name, int oflag, mode_t mode,
 								&offset);
 	}
 
+	if (mas->cache_enabled) {
+		char *folder = listing_folder(mas, name);
+		char *key = g_strdup_printf("folder:%s:%u:%u", folder, max,
+								offset);
+
+		cache = listing_cache_open(mas, key, folder);
+		if (cache) {
+			if (max == 0)
+				mas->outparams = g_obex_apparam_set_uint16(
+						mas->outparams,
+						MAP_AP_FOLDERLISTINGSIZE,
+						cache->size);
+			*err = 0;
+			return mas;
+		}
+	}
+
 	*err = messages_get_folder_listing(mas->backend_data, name, max,
 					offset, get_folder_listing_cb, mas);
 
@@ -546,6 +814,7 @@ static void *msg_listing_open(const char *name, int oflag, mode_t mode,
 {
 	struct mas_session *mas = driver_data;
 	struct messages_filter filter = { 0, };
+	struct listing_cache *cache;
 	/* 1024 is the default when there was no MaxListCount sent */
 	uint16_t max = 1024;
 	uint16_t offset = 0;
@@ -586,6 +855,29 @@ static void *msg_listing_open(const char *name, int oflag, mode_t mode,
 						&filter.priority);
 
 done:
+	if (mas->cache_enabled) {
+		char *folder = listing_folder(mas, name);
+		char *key;
+
+		key = g_strdup_printf("msg:%s:%u:%u:%u:%x:%u:%s:%s:%u:%s:%s:%u",
+				folder, max, offset, subject_len,
+				filter.parameter_mask, filter.type,
+				filter.period_begin ? filter.period_begin : "",
+				filter.period_end ? filter.period_end : "",
+				filter.read_status,
+				filter.recipient ? filter.recipient : "",
+				filter.originator ? filter.originator : "",
+				filter.priority);
+
+		cache = listing_cache_open(mas, key, folder);
+		if (cache) {
+			set_messages_listing_params(mas, cache->size,
+								cache->newmsg);
+			*err = 0;
+			return mas;
+		}
+	}
+
 	*err = messages_get_messages_listing(mas->backend_data, name, max,
 			offset, subject_len, &filter,
 			get_messages_listing_cb, mas);
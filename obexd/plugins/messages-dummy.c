@@ -13,11 +13,13 @@
 #endif
 
 #include <sys/types.h>
+#include <sys/inotify.h>
 #include <dirent.h>
 #include <stdio.h>
 #include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "obexd/src/log.h"
 
@@ -27,10 +29,19 @@
 
 static char *root_folder = NULL;
 
+#define FOLDER_EVENTS	(IN_ONLYDIR | IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | \
+					IN_MOVED_FROM | IN_MOVED_TO)
+
 struct session {
 	char *cwd;
 	char *cwd_absolute;
 	void *request;
+	void (*send_event)(void *session, const struct messages_event *event,
+							void *user_data);
+	void *event_data;
+	int notify_fd;
+	guint notify_id;
+	GHashTable *watches;	/* watch descriptor -> folder */
 };
 
 struct folder_listing_data {
@@ -230,27 +241,186 @@ int messages_connect(void **s)
 	session = g_new0(struct session, 1);
 	session->cwd = g_strdup("");
 	session->cwd_absolute = g_strdup(root_folder);
+	session->notify_fd = -1;
 
 	*s = session;
 
 	return 0;
 }
 
+static void stop_notify(struct session *session)
+{
+	if (session->notify_id > 0) {
+		g_source_remove(session->notify_id);
+		session->notify_id = 0;
+	}
+
+	if (session->watches) {
+		g_hash_table_destroy(session->watches);
+		session->watches = NULL;
+	}
+
+	if (session->notify_fd >= 0) {
+		close(session->notify_fd);
+		session->notify_fd = -1;
+	}
+
+	session->send_event = NULL;
+	session->event_data = NULL;
+}
+
 void messages_disconnect(void *s)
 {
 	struct session *session = s;
 
+	stop_notify(session);
+
 	g_free(session->cwd);
 	g_free(session->cwd_absolute);
 	g_free(session);
 }
 
-int messages_set_notification_registration(void *session,
+/* Watches folder and all of its subfolders, folder is relative to the root */
+static gboolean watch_folder(struct session *session, const char *folder)
+{
+	char *path, *name;
+	DIR *dp;
+	int wd;
+
+	path = g_build_filename(root_folder, folder, NULL);
+
+	wd = inotify_add_watch(session->notify_fd, path, FOLDER_EVENTS);
+	if (wd < 0) {
+		DBG("inotify_add_watch(%s): %s", path, strerror(errno));
+		g_free(path);
+		return FALSE;
+	}
+
+	g_hash_table_replace(session->watches, GINT_TO_POINTER(wd),
+							g_strdup(folder));
+
+	dp = opendir(path);
+	if (dp == NULL) {
+		g_free(path);
+		return TRUE;
+	}
+
+	while ((name = get_next_subdir(dp, path)) != NULL) {
+		char *subfolder = g_build_filename(folder, name, NULL);
+
+		watch_folder(session, subfolder);
+
+		g_free(subfolder);
+		g_free(name);
+	}
+
+	closedir(dp);
+	g_free(path);
+
+	return TRUE;
+}
+
+static gboolean notify_cb(GIOChannel *io, GIOCondition cond, gpointer data)
+{
+	struct session *session = data;
+	char buf[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	const char *last = NULL;
+	ssize_t len, pos;
+
+	if (cond & (G_IO_ERR | G_IO_HUP | G_IO_NVAL))
+		goto failed;
+
+	len = read(session->notify_fd, buf, sizeof(buf));
+	if (len < 0) {
+		if (errno == EAGAIN || errno == EINTR)
+			return TRUE;
+
+		goto failed;
+	}
+
+	for (pos = 0; pos < len; ) {
+		struct inotify_event *ev = (void *) (buf + pos);
+		struct messages_event event;
+		char *folder;
+
+		pos += sizeof(*ev) + ev->len;
+
+		folder = g_hash_table_lookup(session->watches,
+						GINT_TO_POINTER(ev->wd));
+		if (folder == NULL)
+			continue;
+
+		if (ev->mask & IN_IGNORED) {
+			g_hash_table_remove(session->watches,
+						GINT_TO_POINTER(ev->wd));
+			continue;
+		}
+
+		/* Report each folder once per batch of changes */
+		if (folder != last) {
+			memset(&event, 0, sizeof(event));
+			event.type = MET_MESSAGE_SHIFT;
+			event.folder = folder;
+			event.old_folder = folder;
+
+			session->send_event(session, &event,
+							session->event_data);
+			last = folder;
+		}
+
+		if ((ev->mask & IN_ISDIR) && (ev->mask & (IN_CREATE |
+							IN_MOVED_TO)) && ev->len) {
+			char *subfolder = g_build_filename(folder, ev->name,
+									NULL);
+
+			watch_folder(session, subfolder);
+			g_free(subfolder);
+		}
+	}
+
+	return TRUE;
+
+failed:
+	error("messages: folder change notifications stopped");
+	session->notify_id = 0;
+
+	return FALSE;
+}
+
+int messages_set_notification_registration(void *s,
 		void (*send_event)(void *session,
 			const struct messages_event *event, void *user_data),
 		void *user_data)
 {
-	return -ENOSYS;
+	struct session *session = s;
+	GIOChannel *io;
+
+	stop_notify(session);
+
+	if (send_event == NULL)
+		return 0;
+
+	session->notify_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (session->notify_fd < 0)
+		return -errno;
+
+	session->watches = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+								NULL, g_free);
+
+	if (!watch_folder(session, "")) {
+		stop_notify(session);
+		return -ENOENT;
+	}
+
+	io = g_io_channel_unix_new(session->notify_fd);
+	session->notify_id = g_io_add_watch(io, G_IO_IN | G_IO_ERR | G_IO_HUP |
+						G_IO_NVAL, notify_cb, session);
+	g_io_channel_unref(io);
+
+	session->send_event = send_event;
+	session->event_data = user_data;
+
+	return 0;
 }
 
 int messages_set_folder(void *s, const char *name, gboolean cdup)
@@ -347,6 +517,20 @@ static void msg_element(GMarkupParseContext *ctxt, const char *element,
 	struct messages_message *entry = NULL;
 	int i;
 
+	for (i = 0; names[i]; ++i) {
+		if (g_strcmp0(names[i], "handle") == 0)
+			break;
+	}
+
+	if (names[i] == NULL)
+		return;
+
+	mld->size++;
+
+	/* Entries outside of the requested window are only counted */
+	if (mld->size <= mld->offset || mld->size - mld->offset > mld->max)
+		return;
+
 	entry = g_new0(struct messages_message, 1);
 	if (mld->filter->parameter_mask == 0) {
 		entry->mask = (entry->mask | PMASK_SUBJECT \
@@ -360,7 +544,6 @@ static void msg_element(GMarkupParseContext *ctxt, const char *element,
 	for (i = 0 ; names[i]; ++i) {
 		if (g_strcmp0(names[i], "handle") == 0) {
 			entry->handle = g_strdup(values[i]);
-			mld->size++;
 			continue;
 		}
 		if (g_strcmp0(names[i], "attachment_size") == 0) {
@@ -391,8 +574,7 @@ static void msg_element(GMarkupParseContext *ctxt, const char *element,
 			entry->reception_status = g_strdup(values[i]);
 	}
 
-	if (mld->size > mld->offset)
-		mld->callback(mld->session, -EAGAIN, mld->size, 0, entry, mld->user_data);
+	mld->callback(mld->session, -EAGAIN, mld->size, 0, entry, mld->user_data);
 
 	g_free(entry->reception_status);
 	g_free(entry->type);
@@ -467,6 +649,10 @@ int messages_get_messages_listing(void *session, const char *name,
 	struct session *s =  session;
 	char *path;
 
+	/* Same restriction as messages_set_folder(), stay below the root */
+	if (name && (strchr(name, '/') || strcmp(name, "..") == 0))
+		return -EBADR;
+
 	mld = g_new0(struct message_listing_data, 1);
 	mld->session = s;
 	mld->name = name;
@@ -477,22 +663,18 @@ int messages_get_messages_listing(void *session, const char *name,
 	mld->filter = filter;
 	mld->user_data = user_data;
 
-	path = g_build_filename(s->cwd_absolute, MSG_LIST_XML, NULL);
+	/* The listing is of the named subfolder, without changing into it */
+	path = g_build_filename(s->cwd_absolute, name ? name : "",
+							MSG_LIST_XML, NULL);
 	mld->fp = fopen(path, "r");
 	if (mld->fp == NULL) {
+		int err = -errno;
+		DBG("fopen(): %d, %s", -err, strerror(-err));
 		g_free(path);
-		messages_set_folder(s, mld->name, 0);
-		path = g_build_filename(s->cwd_absolute, MSG_LIST_XML, NULL);
-		mld->fp = fopen(path, "r");
-		if (mld->fp == NULL) {
-			int err = -errno;
-			DBG("fopen(): %d, %s", -err, strerror(-err));
-			g_free(path);
-			return -EBADR;
-		}
+		g_free(mld);
+		return -EBADR;
 	}
 
-
 	g_idle_add_full(G_PRIORITY_DEFAULT_IDLE, get_messages_listing,
 								mld, g_free);
 	g_free(path);
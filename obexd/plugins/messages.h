@@ -82,6 +82,9 @@ enum messages_event_type {
 
 /* Data for sending MNS notification. Handle shall be formatted as described in
  * messages_message.
+ *
+ * Handle may be NULL when the backend only knows that the contents of folder
+ * changed, such events are not forwarded to MNS.
  */
 struct messages_event {
 	enum messages_event_type type;
@@ -163,6 +166,9 @@ void messages_disconnect(void *session);
  *
  * To unregister currently registered notifications, call this with send_event
  * set to NULL.
+ *
+ * Listings are only cached for sessions whose backend accepts the
+ * registration, so every change to a folder or its listing must be reported.
  */
 int messages_set_notification_registration(void *session,
 		void (*send_event)(void *session,
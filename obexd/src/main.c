@@ -126,6 +126,7 @@ static char *option_noplugin = NULL;
 
 static gboolean option_autoaccept = FALSE;
 static gboolean option_symlinks = FALSE;
+static int option_transfers = 0;
 
 static gboolean parse_debug(const char *key, const char *value,
 				gpointer user_data, GError **error)
@@ -164,6 +165,9 @@ static GOptionEntry options[] = {
 				"scripts", "FILE" },
 	{ "auto-accept", 'a', 0, G_OPTION_ARG_NONE, &option_autoaccept,
 				"Automatically accept push requests" },
+	{ "transfers", 't', 0, G_OPTION_ARG_INT, &option_transfers,
+				"Maximum number of client transfers running "
+				"at the same time, 0 for no limit", "NUM" },
 	{ NULL },
 };
 
@@ -187,6 +191,11 @@ const char *obex_option_capability(void)
 	return option_capability;
 }
 
+unsigned int obex_option_max_transfers(void)
+{
+	return option_transfers > 0 ? option_transfers : 0;
+}
+
 static gboolean is_dir(const char *dir)
 {
 	struct stat st;
@@ -42,6 +42,10 @@
 #define CT_RETRIES 1
 #define TG_RETRIES CT_RETRIES
 
+/* A reconnection that has not reported back by then frees its slot */
+#define RECONNECT_SLOT_TIMEOUT 30
+#define RECONNECT_JITTER_MIN 250	/* msec */
+
 struct reconnect_data {
 	struct btd_device *dev;
 	bool reconnect;
@@ -50,6 +54,22 @@ struct reconnect_data {
 	bool active;
 	unsigned int attempt;
 	bool on_resume;
+	time_t last_used;		/* last time a service connected */
+	guint slot_timer;		/* connection in flight */
+};
+
+/*
+ * Reconnections of an adapter share a bounded number of pages and LE
+ * connection attempts, and wait in priority order for a free one.
+ */
+struct reconnect_sched {
+	struct btd_adapter *adapter;
+	GSList *waiting;
+	GSList *inflight;
+	unsigned int active;		/* devices being reconnected */
+	unsigned int reconnected;
+	unsigned int failed;
+	gint64 start;
 };
 
 static const char *default_reconnect[] = {
@@ -67,7 +87,13 @@ static size_t reconnect_intervals_len = 0;
 static const int default_resume_delay = 2;
 static int resume_delay;
 
-static GSList *reconnects = NULL;
+static const int default_max_pages = 1;
+static int reconnect_max_pages;
+static const int default_max_le = 2;
+static int reconnect_max_le;
+
+static GHashTable *reconnects = NULL;
+static GSList *scheds = NULL;
 
 static unsigned int service_id = 0;
 static GSList *devices = NULL;
@@ -89,16 +115,10 @@ struct policy_data {
 
 static struct reconnect_data *reconnect_find(struct btd_device *dev)
 {
-	GSList *l;
-
-	for (l = reconnects; l; l = g_slist_next(l)) {
-		struct reconnect_data *reconnect = l->data;
-
-		if (reconnect->dev == dev)
-			return reconnect;
-	}
+	if (!reconnects)
+		return NULL;
 
-	return NULL;
+	return g_hash_table_lookup(reconnects, dev);
 }
 
 static void policy_connect(struct policy_data *data,
@@ -540,10 +560,120 @@ static void target_cb(struct btd_service *service,
 	}
 }
 
+static struct reconnect_sched *sched_find(struct btd_device *dev)
+{
+	struct btd_adapter *adapter = device_get_adapter(dev);
+	GSList *l;
+
+	for (l = scheds; l; l = g_slist_next(l)) {
+		struct reconnect_sched *sched = l->data;
+
+		if (sched->adapter == adapter)
+			return sched;
+	}
+
+	return NULL;
+}
+
+static bool reconnect_is_bredr(struct reconnect_data *reconnect)
+{
+	return btd_device_get_bdaddr_type(reconnect->dev) == BDADDR_BREDR;
+}
+
+/* Input devices first, then audio, then anything else */
+static int reconnect_priority(struct reconnect_data *reconnect)
+{
+	uint32_t class = btd_device_get_class(reconnect->dev);
+
+	switch ((class >> 8) & 0x1f) {
+	case 0x05:	/* Peripheral */
+		return 0;
+	case 0x04:	/* Audio/Video */
+		return 1;
+	default:
+		return 2;
+	}
+}
+
+static gint reconnect_cmp(gconstpointer a, gconstpointer b)
+{
+	struct reconnect_data *reconnect_a = (struct reconnect_data *) a;
+	struct reconnect_data *reconnect_b = (struct reconnect_data *) b;
+	int prio;
+
+	prio = reconnect_priority(reconnect_a) -
+					reconnect_priority(reconnect_b);
+	if (prio)
+		return prio;
+
+	/* Most recently used first */
+	if (reconnect_a->last_used > reconnect_b->last_used)
+		return -1;
+
+	return reconnect_a->last_used < reconnect_b->last_used;
+}
+
+static void sched_set_active(struct reconnect_data *reconnect, bool active,
+								bool connected)
+{
+	struct reconnect_sched *sched;
+
+	if (reconnect->active == active)
+		return;
+
+	reconnect->active = active;
+
+	sched = sched_find(reconnect->dev);
+	if (!sched)
+		return;
+
+	if (active) {
+		if (sched->active++)
+			return;
+
+		sched->start = g_get_monotonic_time();
+		sched->reconnected = 0;
+		sched->failed = 0;
+		return;
+	}
+
+	if (connected)
+		sched->reconnected++;
+	else
+		sched->failed++;
+
+	if (--sched->active)
+		return;
+
+	DBG("%u devices reconnected, %u failed, in %lld ms",
+			sched->reconnected, sched->failed,
+			(long long) (g_get_monotonic_time() - sched->start) / 1000);
+}
+
+/* Gives up the page or LE connection slot of the reconnection */
+static void sched_release(struct reconnect_data *reconnect)
+{
+	struct reconnect_sched *sched = sched_find(reconnect->dev);
+
+	if (!sched)
+		return;
+
+	sched->waiting = g_slist_remove(sched->waiting, reconnect);
+
+	if (!reconnect->slot_timer)
+		return;
+
+	g_source_remove(reconnect->slot_timer);
+	reconnect->slot_timer = 0;
+	sched->inflight = g_slist_remove(sched->inflight, reconnect);
+}
+
 static void reconnect_reset(struct reconnect_data *reconnect)
 {
 	reconnect->attempt = 0;
-	reconnect->active = false;
+
+	sched_release(reconnect);
+	sched_set_active(reconnect, false, false);
 
 	if (reconnect->timer > 0) {
 		g_source_remove(reconnect->timer);
@@ -551,6 +681,99 @@ static void reconnect_reset(struct reconnect_data *reconnect)
 	}
 }
 
+static bool sched_slot_available(struct reconnect_sched *sched,
+					struct reconnect_data *reconnect)
+{
+	bool bredr = reconnect_is_bredr(reconnect);
+	int count = 0;
+	GSList *l;
+
+	for (l = sched->inflight; l; l = g_slist_next(l)) {
+		if (reconnect_is_bredr(l->data) == bredr)
+			count++;
+	}
+
+	return count < (bredr ? reconnect_max_pages : reconnect_max_le);
+}
+
+static void sched_dispatch(struct reconnect_sched *sched);
+
+static gboolean slot_timeout(gpointer data)
+{
+	struct reconnect_data *reconnect = data;
+	struct reconnect_sched *sched;
+
+	DBG("%s did not report back", device_get_path(reconnect->dev));
+
+	reconnect->slot_timer = 0;
+
+	sched = sched_find(reconnect->dev);
+	if (!sched)
+		return FALSE;
+
+	sched->inflight = g_slist_remove(sched->inflight, reconnect);
+	sched_dispatch(sched);
+
+	return FALSE;
+}
+
+static void reconnect_start(struct reconnect_sched *sched,
+					struct reconnect_data *reconnect)
+{
+	int err;
+
+	DBG("Reconnecting %s", device_get_path(reconnect->dev));
+
+	err = btd_device_connect_services(reconnect->dev, reconnect->services);
+	if (err < 0) {
+		error("Reconnecting services failed: %s (%d)",
+							strerror(-err), -err);
+		reconnect_reset(reconnect);
+		return;
+	}
+
+	reconnect->attempt++;
+
+	if (!sched)
+		return;
+
+	reconnect->slot_timer = g_timeout_add_seconds(RECONNECT_SLOT_TIMEOUT,
+						slot_timeout, reconnect);
+	sched->inflight = g_slist_prepend(sched->inflight, reconnect);
+}
+
+static void sched_dispatch(struct reconnect_sched *sched)
+{
+	GSList *l, *next;
+
+	for (l = sched->waiting; l; l = next) {
+		struct reconnect_data *reconnect = l->data;
+
+		next = g_slist_next(l);
+
+		if (!sched_slot_available(sched, reconnect))
+			continue;
+
+		sched->waiting = g_slist_delete_link(sched->waiting, l);
+		reconnect_start(sched, reconnect);
+	}
+}
+
+static void sched_queue(struct reconnect_data *reconnect)
+{
+	struct reconnect_sched *sched = sched_find(reconnect->dev);
+
+	if (!sched) {
+		reconnect_start(NULL, reconnect);
+		return;
+	}
+
+	sched->waiting = g_slist_insert_sorted(sched->waiting, reconnect,
+								reconnect_cmp);
+
+	sched_dispatch(sched);
+}
+
 static bool reconnect_match(const char *uuid)
 {
 	char **str;
@@ -575,7 +798,7 @@ static struct reconnect_data *reconnect_add(struct btd_service *service)
 	if (!reconnect) {
 		reconnect = g_new0(struct reconnect_data, 1);
 		reconnect->dev = dev;
-		reconnects = g_slist_append(reconnects, reconnect);
+		g_hash_table_insert(reconnects, dev, reconnect);
 	}
 
 	if (g_slist_find(reconnect->services, service))
@@ -591,6 +814,8 @@ static void reconnect_destroy(gpointer data)
 {
 	struct reconnect_data *reconnect = data;
 
+	sched_release(reconnect);
+
 	if (reconnect->timer > 0)
 		g_source_remove(reconnect->timer);
 
@@ -599,10 +824,19 @@ static void reconnect_destroy(gpointer data)
 	g_free(reconnect);
 }
 
+static gboolean reconnect_destroy_all(gpointer key, gpointer value,
+							gpointer user_data)
+{
+	reconnect_destroy(value);
+
+	return TRUE;
+}
+
 static void reconnect_remove(struct btd_service *service)
 {
 	struct btd_device *dev = btd_service_get_device(service);
 	struct reconnect_data *reconnect;
+	struct reconnect_sched *sched;
 	GSList *l;
 
 	reconnect = reconnect_find(dev);
@@ -619,12 +853,19 @@ static void reconnect_remove(struct btd_service *service)
 	if (reconnect->services)
 		return;
 
-	reconnects = g_slist_remove(reconnects, reconnect);
+	g_hash_table_remove(reconnects, dev);
+
+	sched_set_active(reconnect, false, false);
+	sched_release(reconnect);
 
 	if (reconnect->timer > 0)
 		g_source_remove(reconnect->timer);
 
 	g_free(reconnect);
+
+	sched = sched_find(dev);
+	if (sched)
+		sched_dispatch(sched);
 }
 
 static void service_cb(struct btd_service *service,
@@ -634,6 +875,7 @@ static void service_cb(struct btd_service *service,
 {
 	struct btd_profile *profile = btd_service_get_profile(service);
 	struct reconnect_data *reconnect;
+	struct reconnect_sched *sched;
 
 	if (g_str_equal(profile->remote_uuid, A2DP_SINK_UUID))
 		sink_cb(service, old_state, new_state);
@@ -680,7 +922,16 @@ static void service_cb(struct btd_service *service,
 	 */
 	reconnect = reconnect_add(service);
 
-	reconnect->active = false;
+	reconnect->last_used = time(NULL);
+
+	if (reconnect->active) {
+		sched_release(reconnect);
+		sched_set_active(reconnect, false, true);
+
+		sched = sched_find(reconnect->dev);
+		if (sched)
+			sched_dispatch(sched);
+	}
 
 	/*
 	 * Should this device be reconnected? A matching UUID might not
@@ -696,7 +947,6 @@ static void service_cb(struct btd_service *service,
 static gboolean reconnect_timeout(gpointer data)
 {
 	struct reconnect_data *reconnect = data;
-	int err;
 
 	DBG("Reconnecting profiles");
 
@@ -706,15 +956,7 @@ static gboolean reconnect_timeout(gpointer data)
 	/* Mark any reconnect on resume as handled */
 	reconnect->on_resume = false;
 
-	err = btd_device_connect_services(reconnect->dev, reconnect->services);
-	if (err < 0) {
-		error("Reconnecting services failed: %s (%d)",
-							strerror(-err), -err);
-		reconnect_reset(reconnect);
-		return FALSE;
-	}
-
-	reconnect->attempt++;
+	sched_queue(reconnect);
 
 	return FALSE;
 }
@@ -722,8 +964,9 @@ static gboolean reconnect_timeout(gpointer data)
 static void reconnect_set_timer(struct reconnect_data *reconnect, int timeout)
 {
 	static int interval_timeout = 0;
+	unsigned int msec;
 
-	reconnect->active = true;
+	sched_set_active(reconnect, true, false);
 
 	if (reconnect->attempt < reconnect_intervals_len)
 		interval_timeout = reconnect_intervals[reconnect->attempt];
@@ -731,11 +974,14 @@ static void reconnect_set_timer(struct reconnect_data *reconnect, int timeout)
 	if (timeout < 0)
 		timeout = interval_timeout;
 
-	DBG("attempt %u/%zu %d seconds", reconnect->attempt + 1,
-						reconnect_attempts, timeout);
+	/* Spread devices that lost their link at the same time */
+	msec = timeout * 1000;
+	msec += g_random_int_range(0, msec / 4 + RECONNECT_JITTER_MIN);
 
-	reconnect->timer = g_timeout_add_seconds(timeout, reconnect_timeout,
-								reconnect);
+	DBG("attempt %u/%zu %u ms", reconnect->attempt + 1,
+						reconnect_attempts, msec);
+
+	reconnect->timer = g_timeout_add(msec, reconnect_timeout, reconnect);
 }
 
 static void disconnect_cb(struct btd_device *dev, uint8_t reason)
@@ -784,11 +1030,13 @@ static void disconnect_cb(struct btd_device *dev, uint8_t reason)
 
 static void policy_adapter_resume(struct btd_adapter *adapter)
 {
-	GSList *l;
+	GHashTableIter iter;
+	gpointer value;
 
 	/* Check if devices on this adapter need to be reconnected on resume */
-	for (l = reconnects; l; l = g_slist_next(l)) {
-		struct reconnect_data *reconnect = l->data;
+	g_hash_table_iter_init(&iter, reconnects);
+	while (g_hash_table_iter_next(&iter, NULL, &value)) {
+		struct reconnect_data *reconnect = value;
 
 		if (reconnect->on_resume &&
 		    device_get_adapter(reconnect->dev) == adapter) {
@@ -800,6 +1048,7 @@ static void policy_adapter_resume(struct btd_adapter *adapter)
 static void conn_fail_cb(struct btd_device *dev, uint8_t status)
 {
 	struct reconnect_data *reconnect;
+	struct reconnect_sched *sched;
 
 	DBG("status %u", status);
 
@@ -810,34 +1059,66 @@ static void conn_fail_cb(struct btd_device *dev, uint8_t status)
 	if (!reconnect->active)
 		return;
 
-	/* Give up if we were powered off */
-	if (status == MGMT_STATUS_NOT_POWERED) {
-		reconnect_reset(reconnect);
-		return;
-	}
+	sched_release(reconnect);
 
-	/* Reset if ReconnectAttempts was reached */
-	if (reconnect->attempt == reconnect_attempts) {
+	/* Give up if we were powered off or ReconnectAttempts was reached */
+	if (status == MGMT_STATUS_NOT_POWERED ||
+				reconnect->attempt == reconnect_attempts)
 		reconnect_reset(reconnect);
-		return;
-	}
+	else
+		reconnect_set_timer(reconnect, -1);
 
-	reconnect_set_timer(reconnect, -1);
+	sched = sched_find(dev);
+	if (sched)
+		sched_dispatch(sched);
 }
 
 static int policy_adapter_probe(struct btd_adapter *adapter)
 {
+	struct reconnect_sched *sched;
+
 	DBG("");
 
+	sched = g_new0(struct reconnect_sched, 1);
+	sched->adapter = adapter;
+	scheds = g_slist_prepend(scheds, sched);
+
 	if (auto_enable)
 		btd_adapter_restore_powered(adapter);
 
 	return 0;
 }
 
+static void slot_free(gpointer data)
+{
+	struct reconnect_data *reconnect = data;
+
+	g_source_remove(reconnect->slot_timer);
+	reconnect->slot_timer = 0;
+}
+
+static void policy_adapter_remove(struct btd_adapter *adapter)
+{
+	GSList *l;
+
+	for (l = scheds; l; l = g_slist_next(l)) {
+		struct reconnect_sched *sched = l->data;
+
+		if (sched->adapter != adapter)
+			continue;
+
+		scheds = g_slist_delete_link(scheds, l);
+		g_slist_free(sched->waiting);
+		g_slist_free_full(sched->inflight, slot_free);
+		g_free(sched);
+		return;
+	}
+}
+
 static struct btd_adapter_driver policy_driver = {
 	.name	= "policy",
 	.probe	= policy_adapter_probe,
+	.remove	= policy_adapter_remove,
 	.resume = policy_adapter_resume,
 };
 
@@ -848,6 +1129,11 @@ static int policy_init(void)
 
 	service_id = btd_service_add_state_cb(service_cb, NULL);
 
+	reconnects = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+	reconnect_max_pages = default_max_pages;
+	reconnect_max_le = default_max_le;
+
 	conf = btd_get_main_conf();
 	if (!conf) {
 		reconnect_uuids = g_strdupv((char **) default_reconnect);
@@ -899,6 +1185,20 @@ static int policy_init(void)
 		g_clear_error(&gerr);
 		resume_delay = default_resume_delay;
 	}
+
+	reconnect_max_pages = g_key_file_get_integer(conf, "Policy",
+						"ReconnectPages", &gerr);
+	if (gerr || reconnect_max_pages < 1) {
+		g_clear_error(&gerr);
+		reconnect_max_pages = default_max_pages;
+	}
+
+	reconnect_max_le = g_key_file_get_integer(conf, "Policy",
+						"ReconnectLEConnections", &gerr);
+	if (gerr || reconnect_max_le < 1) {
+		g_clear_error(&gerr);
+		reconnect_max_le = default_max_le;
+	}
 done:
 	if (reconnect_uuids && reconnect_uuids[0] && reconnect_attempts) {
 		btd_add_disconnect_cb(disconnect_cb);
@@ -920,7 +1220,9 @@ static void policy_exit(void)
 
 	g_free(reconnect_intervals);
 
-	g_slist_free_full(reconnects, reconnect_destroy);
+	g_hash_table_foreach_remove(reconnects, reconnect_destroy_all, NULL);
+	g_hash_table_destroy(reconnects);
+	reconnects = NULL;
 
 	g_slist_free_full(devices, policy_remove);
 
@@ -4680,10 +4680,18 @@ done:
 	return 0;
 }
 
+/* Let the audio stream be set up before the remote control channel */
+static const char * const avrcp_after_services[] = {
+	A2DP_SINK_UUID,
+	A2DP_SOURCE_UUID,
+	NULL
+};
+
 static struct btd_profile avrcp_target_profile = {
 	.name		= "audio-avrcp-target",
 
 	.remote_uuid	= AVRCP_TARGET_UUID,
+	.after_services	= avrcp_after_services,
 	.device_probe	= avrcp_target_probe,
 	.device_remove	= avrcp_target_remove,
 
@@ -4767,6 +4775,7 @@ static struct btd_profile avrcp_controller_profile = {
 	.name		= "avrcp-controller",
 
 	.remote_uuid	= AVRCP_REMOTE_UUID,
+	.after_services	= avrcp_after_services,
 	.device_probe	= avrcp_controller_probe,
 	.device_remove	= avrcp_controller_remove,
 
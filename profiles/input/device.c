@@ -19,7 +19,10 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <inttypes.h>
+#include <time.h>
 #include <sys/ioctl.h>
+#include <sys/socket.h>
 
 #include "lib/bluetooth.h"
 #include "lib/hidp.h"
@@ -46,6 +49,22 @@
 
 #define INPUT_INTERFACE "org.bluez.Input1"
 
+/* Maximum number of interrupt channel packets consumed per wakeup */
+#define INTR_BATCH_MAX		32
+
+/* Input latency histogram buckets, bucket n counts reports delivered in
+ * less than 2^n microseconds (the last bucket collects everything else).
+ */
+#define LATENCY_BUCKETS		16
+
+struct input_latency {
+	uint64_t		reports;
+	uint64_t		total_us;
+	uint32_t		max_us;
+	uint32_t		max_batch;
+	uint32_t		hist[LATENCY_BUCKETS];
+};
+
 enum reconnect_mode_t {
 	RECONNECT_NONE = 0,
 	RECONNECT_DEVICE,
@@ -76,6 +95,7 @@ struct input_device {
 	guint			report_req_timer;
 	uint32_t		report_rsp_id;
 	bool			virtual_cable_unplug;
+	struct input_latency	latency;
 };
 
 static int idle_timeout = 0;
@@ -272,55 +292,132 @@ static bool uhid_send_set_report_reply(struct input_device *idev,
 static bool uhid_send_input_report(struct input_device *idev,
 					const uint8_t *data, size_t size)
 {
-	struct uhid_event ev;
 	int err;
 
 	if (data == NULL)
 		size = 0;
 
-	if (size > sizeof(ev.u.input.data))
-		size = sizeof(ev.u.input.data);
+	if (size > UHID_DATA_MAX)
+		size = UHID_DATA_MAX;
 
 	if (!idev->uhid_created) {
 		DBG("HID report (%zu bytes) dropped", size);
 		return false;
 	}
 
-	memset(&ev, 0, sizeof(ev));
-	ev.type = UHID_INPUT;
-	ev.u.input.size = size;
-
-	if (size > 0)
-		memcpy(ev.u.input.data, data, size);
-
-	err = bt_uhid_send(idev->uhid, &ev);
+	err = bt_uhid_input(idev->uhid, data, size);
 	if (err < 0) {
-		error("bt_uhid_send: %s (%d)", strerror(-err), -err);
+		error("bt_uhid_input: %s (%d)", strerror(-err), -err);
 		return false;
 	}
 
-	DBG("HID report (%zu bytes)", size);
-
 	return true;
 }
 
-static bool hidp_recv_intr_data(GIOChannel *chan, struct input_device *idev)
+static void input_latency_record(struct input_device *idev,
+						const struct timespec *rx)
 {
-	int fd;
+	struct input_latency *lat = &idev->latency;
+	struct timespec now;
+	int64_t us;
+	unsigned int bucket;
+
+	if (clock_gettime(CLOCK_REALTIME, &now) < 0)
+		return;
+
+	us = (now.tv_sec - rx->tv_sec) * 1000000LL +
+				(now.tv_nsec - rx->tv_nsec) / 1000;
+	if (us < 0)
+		us = 0;
+	else if (us > UINT32_MAX)
+		us = UINT32_MAX;
+
+	for (bucket = 0; bucket < LATENCY_BUCKETS - 1; bucket++) {
+		if (us < (1LL << bucket))
+			break;
+	}
+
+	lat->hist[bucket]++;
+	lat->reports++;
+	lat->total_us += us;
+
+	if (us > lat->max_us)
+		lat->max_us = us;
+}
+
+static void input_latency_dump(struct input_device *idev)
+{
+	struct input_latency *lat = &idev->latency;
+	unsigned int i;
+
+	if (!lat->reports)
+		return;
+
+	DBG("%s: %" PRIu64 " reports, avg %" PRIu64 " us, max %u us, "
+			"max batch %u", idev->path, lat->reports,
+			lat->total_us / lat->reports, lat->max_us,
+			lat->max_batch);
+
+	for (i = 0; i < LATENCY_BUCKETS; i++) {
+		if (!lat->hist[i])
+			continue;
+
+		if (i < LATENCY_BUCKETS - 1)
+			DBG("  < %u us: %u", 1U << i, lat->hist[i]);
+		else
+			DBG("  >= %u us: %u", 1U << (i - 1), lat->hist[i]);
+	}
+
+	memset(lat, 0, sizeof(*lat));
+}
+
+static void intr_enable_timestamps(GIOChannel *io)
+{
+	int opt = 1;
+
+	/* Kernel receive timestamps are used as the start of the input
+	 * latency measurement, failing to enable them only disables the
+	 * histogram.
+	 */
+	if (setsockopt(g_io_channel_unix_get_fd(io), SOL_SOCKET,
+					SO_TIMESTAMPNS, &opt, sizeof(opt)) < 0)
+		DBG("SO_TIMESTAMPNS: %s (%d)", strerror(errno), errno);
+}
+
+static bool hidp_recv_intr_report(struct input_device *idev, int fd,
+								bool *drained)
+{
+	uint8_t data[UHID_DATA_MAX + 1];
+	uint8_t control[CMSG_SPACE(sizeof(struct timespec))];
+	struct iovec iov;
+	struct msghdr msg;
+	struct cmsghdr *cmsg;
 	ssize_t len;
 	uint8_t hdr;
-	uint8_t data[UHID_DATA_MAX + 1];
 
-	fd = g_io_channel_unix_get_fd(chan);
+	iov.iov_base = data;
+	iov.iov_len = sizeof(data);
 
-	len = read(fd, data, sizeof(data));
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	len = recvmsg(fd, &msg, MSG_DONTWAIT);
 	if (len < 0) {
+		if (errno == EAGAIN || errno == EINTR) {
+			*drained = true;
+			return true;
+		}
+
 		error("BT socket read error: %s (%d)", strerror(errno), errno);
 		return false;
 	}
 
 	if (len == 0) {
 		DBG("BT socket read returned 0 bytes");
+		*drained = true;
 		return true;
 	}
 
@@ -335,7 +432,44 @@ static bool hidp_recv_intr_data(GIOChannel *chan, struct input_device *idev)
 		return true;
 	}
 
-	uhid_send_input_report(idev, data + 1, len - 1);
+	if (!uhid_send_input_report(idev, data + 1, len - 1))
+		return true;
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); cmsg;
+					cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		struct timespec rx;
+
+		if (cmsg->cmsg_level != SOL_SOCKET ||
+					cmsg->cmsg_type != SCM_TIMESTAMPNS)
+			continue;
+
+		memcpy(&rx, CMSG_DATA(cmsg), sizeof(rx));
+		input_latency_record(idev, &rx);
+		break;
+	}
+
+	return true;
+}
+
+static bool hidp_recv_intr_data(GIOChannel *chan, struct input_device *idev)
+{
+	bool drained = false;
+	unsigned int count;
+	int fd;
+
+	fd = g_io_channel_unix_get_fd(chan);
+
+	/* Consume every report queued on the socket since the last wakeup
+	 * so high polling rate devices cost one mainloop iteration per
+	 * batch rather than one per report.
+	 */
+	for (count = 0; count < INTR_BATCH_MAX && !drained; count++) {
+		if (!hidp_recv_intr_report(idev, fd, &drained))
+			return false;
+	}
+
+	if (count > idev->latency.max_batch)
+		idev->latency.max_batch = count;
 
 	return true;
 }
@@ -354,6 +488,8 @@ static gboolean intr_watch_cb(GIOChannel *chan, GIOCondition cond, gpointer data
 
 	DBG("Device %s disconnected", address);
 
+	input_latency_dump(idev);
+
 	/* Checking for ctrl_watch avoids a double g_io_channel_shutdown since
 	 * it's likely that ctrl_watch_cb has been queued for dispatching in
 	 * this mainloop iteration */
@@ -1180,8 +1316,10 @@ static void interrupt_connect_cb(GIOChannel *chan, GError *conn_err,
 	if (err < 0)
 		goto failed;
 
-	if (idev->uhid)
+	if (idev->uhid) {
 		cond |= G_IO_IN;
+		intr_enable_timestamps(idev->intr_io);
+	}
 
 	idev->intr_watch = g_io_add_watch(idev->intr_io, cond, intr_watch_cb,
 									idev);
@@ -1611,6 +1749,8 @@ int input_device_set_channel(const bdaddr_t *src, const bdaddr_t *dst, int psm,
 		if (idev->intr_io)
 			return -EALREADY;
 		idev->intr_io = g_io_channel_ref(io);
+		if (uhid_enabled)
+			intr_enable_timestamps(idev->intr_io);
 		idev->intr_watch = g_io_add_watch(idev->intr_io, cond,
 							intr_watch_cb, idev);
 		break;
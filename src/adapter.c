@@ -191,6 +191,73 @@ struct btd_adapter_pin_cb_iter {
 	/* When the iterator reaches the end, it is NULL and attempt is 0 */
 };
 
+/*
+ * Once this many names are waiting to be resolved, devices that are not of
+ * interest and already advertise a shortened name are confirmed as known so
+ * the kernel spends its remote name requests on the ones that matter.
+ */
+#define NAME_RESOLVE_BUDGET	8
+
+/*
+ * UUID, class of device and local name updates are collected for this long
+ * before being sent, so that a burst of profile registrations results in
+ * the minimal set of mgmt commands (and EIR regenerations by the kernel).
+ */
+#define EIR_UPDATE_DELAY	50	/* milliseconds */
+
+struct uuid_change {
+	uint8_t uuid[16];
+	uint8_t svc_hint;
+	bool add;
+};
+
+struct name_stats {
+	unsigned int confirmed;		/* confirmations sent */
+	unsigned int requested;		/* names the kernel has to resolve */
+	unsigned int deferred;		/* short name used due to budget */
+	unsigned int resolved;		/* names received after confirmation */
+	uint64_t total_ms;		/* sum of time-to-name */
+	unsigned int max_ms;		/* worst time-to-name */
+};
+
+/* Advertisers that no discovery client has asked for are only tracked by
+ * these records, a btd_device is created once one is actually needed.
+ */
+#define SEEN_DEVICES_MAX	4096
+#define SEEN_EXPIRE_INTERVAL	10	/* seconds */
+
+struct seen_device {
+	bdaddr_t bdaddr;
+	uint8_t bdaddr_type;
+	int8_t rssi;			/* signal it was checked with */
+	uint32_t payload;		/* hash of the last report */
+	unsigned int gen;		/* discovery state it was checked in */
+	time_t last_seen;
+};
+
+struct seen_stats {
+	unsigned int added;		/* records created */
+	unsigned int reports;		/* reports absorbed by a record */
+	unsigned int promoted;		/* records turned into devices */
+	unsigned int expired;		/* records dropped as stale */
+	unsigned int dropped;		/* advertisers not tracked, cache full */
+};
+
+#define CONNECT_LIST_DELAY	100	/* msec */
+
+struct connect_entry {
+	bdaddr_t bdaddr;
+	uint8_t bdaddr_type;
+};
+
+struct connect_list_stats {
+	unsigned int changes;		/* auto-connect set updates */
+	unsigned int sent;		/* Add/Remove Device commands */
+	unsigned int pending;		/* commands not completed yet */
+	gint64 busy_start;
+	gint64 busy_time;		/* usec with commands in flight */
+};
+
 struct btd_adapter {
 	int ref_count;
 
@@ -246,6 +313,9 @@ struct btd_adapter {
 	GSList *connections;		/* Connected devices */
 	GSList *devices;		/* Devices structure pointers */
 	GSList *connect_list;		/* Devices to connect when found */
+	GSList *connect_applied;	/* Entries given to the kernel */
+	guint connect_sync_id;		/* Pending kernel list update */
+	struct connect_list_stats connect_stats;
 	struct btd_device *connect_le;	/* LE device waiting to be connected */
 	sdp_list_t *services;		/* Services associated to adapter */
 
@@ -267,8 +337,24 @@ struct btd_adapter {
 	unsigned int load_ltks_id;
 	guint load_ltks_timeout;
 
-	unsigned int confirm_name_id;
+	GSList *uuid_changes;		/* pending UUID additions/removals */
+	bool class_changed;		/* pending class of device update */
+	char *pending_name;		/* pending local name update */
+	guint eir_update_id;		/* batched EIR update timer */
+	unsigned int eir_cmds_queued;	/* updates requested by callers */
+	unsigned int eir_cmds_sent;	/* mgmt commands actually sent */
+
+	GSList *confirm_queue;		/* name confirmations to be sent */
+	GSList *confirm_pending;	/* name confirmations in flight */
+	guint confirm_name_flush;
 	guint confirm_name_timeout;
+	GSList *name_resolving;		/* confirmed devices awaiting name */
+	struct name_stats name_stats;	/* per discovery session */
+
+	GHashTable *seen_devices;	/* compact unclaimed advertisers */
+	guint seen_expire_id;
+	unsigned int seen_gen;		/* bumped on discovery changes */
+	struct seen_stats seen_stats;
 
 	unsigned int pair_device_id;
 	guint pair_device_timeout;
@@ -379,20 +465,10 @@ static void set_dev_class_complete(uint8_t status, uint16_t length,
 	dev_class_changed_callback(adapter->dev_id, length, param, adapter);
 }
 
-static void set_dev_class(struct btd_adapter *adapter)
+static bool send_dev_class(struct btd_adapter *adapter)
 {
 	struct mgmt_cp_set_dev_class cp;
 
-	/*
-	 * If the controller does not support BR/EDR operation,
-	 * there is no point in trying to set a major and minor
-	 * class value.
-	 *
-	 * This is an optimization for Low Energy only controllers.
-	 */
-	if (!(adapter->supported_settings & MGMT_SETTING_BREDR))
-		return;
-
 	memset(&cp, 0, sizeof(cp));
 
 	/*
@@ -413,10 +489,32 @@ static void set_dev_class(struct btd_adapter *adapter)
 	if (mgmt_send(adapter->mgmt, MGMT_OP_SET_DEV_CLASS,
 				adapter->dev_id, sizeof(cp), &cp,
 				set_dev_class_complete, adapter, NULL) > 0)
-		return;
+		return true;
 
 	btd_error(adapter->dev_id,
 		"Failed to set class of device for index %u", adapter->dev_id);
+
+	return false;
+}
+
+static void schedule_eir_update(struct btd_adapter *adapter);
+
+static void set_dev_class(struct btd_adapter *adapter)
+{
+	/*
+	 * If the controller does not support BR/EDR operation,
+	 * there is no point in trying to set a major and minor
+	 * class value.
+	 *
+	 * This is an optimization for Low Energy only controllers.
+	 */
+	if (!(adapter->supported_settings & MGMT_SETTING_BREDR))
+		return;
+
+	adapter->class_changed = true;
+	adapter->eir_cmds_queued++;
+
+	schedule_eir_update(adapter);
 }
 
 void btd_adapter_set_class(struct btd_adapter *adapter, uint8_t major,
@@ -514,6 +612,9 @@ static void adapter_stop(struct btd_adapter *adapter);
 static void trigger_passive_scanning(struct btd_adapter *adapter);
 static bool set_mode(struct btd_adapter *adapter, uint16_t opcode,
 							uint8_t mode);
+static void connect_entry_remove(struct btd_adapter *adapter,
+							const bdaddr_t *bdaddr,
+							uint8_t bdaddr_type);
 
 static void settings_changed(struct btd_adapter *adapter, uint32_t settings)
 {
@@ -783,9 +884,33 @@ static void set_local_name_complete(uint8_t status, uint16_t length,
 	local_name_changed_callback(adapter->dev_id, length, param, adapter);
 }
 
-static int set_name(struct btd_adapter *adapter, const char *name)
+static bool send_name(struct btd_adapter *adapter, const char *name)
 {
 	struct mgmt_cp_set_local_name cp;
+
+	memset(&cp, 0, sizeof(cp));
+	strncpy((char *) cp.name, name, sizeof(cp.name) - 1);
+
+	DBG("sending set local name command for index %u", adapter->dev_id);
+
+	if (mgmt_send(adapter->mgmt, MGMT_OP_SET_LOCAL_NAME,
+				adapter->dev_id, sizeof(cp), &cp,
+				set_local_name_complete, adapter, NULL) > 0)
+		return true;
+
+	btd_error(adapter->dev_id, "Failed to set local name for index %u",
+							adapter->dev_id);
+
+	return false;
+}
+
+/*
+ * Names set by users are sent right away so that failures can be reported,
+ * only the name set while the adapter is being initialized is batched.
+ */
+static int set_name(struct btd_adapter *adapter, const char *name,
+								bool batch)
+{
 	char maxname[MAX_NAME_LENGTH];
 
 	memset(maxname, 0, sizeof(maxname));
@@ -797,20 +922,22 @@ static int set_name(struct btd_adapter *adapter, const char *name)
 		return -EINVAL;
 	}
 
-	memset(&cp, 0, sizeof(cp));
-	strncpy((char *) cp.name, maxname, sizeof(cp.name) - 1);
-
-	DBG("sending set local name command for index %u", adapter->dev_id);
+	g_free(adapter->pending_name);
+	adapter->pending_name = NULL;
+	adapter->eir_cmds_queued++;
 
-	if (mgmt_send(adapter->mgmt, MGMT_OP_SET_LOCAL_NAME,
-				adapter->dev_id, sizeof(cp), &cp,
-				set_local_name_complete, adapter, NULL) > 0)
+	if (batch) {
+		adapter->pending_name = g_strdup(maxname);
+		schedule_eir_update(adapter);
 		return 0;
+	}
 
-	btd_error(adapter->dev_id, "Failed to set local name for index %u",
-							adapter->dev_id);
+	if (!send_name(adapter, maxname))
+		return -EIO;
 
-	return -EIO;
+	adapter->eir_cmds_sent++;
+
+	return 0;
 }
 
 int adapter_set_name(struct btd_adapter *adapter, const char *name)
@@ -835,7 +962,7 @@ int adapter_set_name(struct btd_adapter *adapter, const char *name)
 	g_dbus_emit_property_changed(dbus_conn, adapter->path,
 						ADAPTER_INTERFACE, "Alias");
 
-	return set_name(adapter, name);
+	return set_name(adapter, name, false);
 }
 
 struct btd_device *btd_adapter_find_device(struct btd_adapter *adapter,
@@ -924,44 +1051,36 @@ static void add_uuid_complete(uint8_t status, uint16_t length,
 						ADAPTER_INTERFACE, "UUIDs");
 }
 
-static int add_uuid(struct btd_adapter *adapter, uuid_t *uuid, uint8_t svc_hint)
+static void remove_uuid_complete(uint8_t status, uint16_t length,
+					const void *param, void *user_data)
 {
-	struct mgmt_cp_add_uuid cp;
-	uuid_t uuid128;
-	uint128_t uint128;
+	struct btd_adapter *adapter = user_data;
 
-	if (!is_supported_uuid(uuid)) {
-		btd_warn(adapter->dev_id,
-				"Ignoring unsupported UUID for addition");
-		return 0;
+	if (status != MGMT_STATUS_SUCCESS) {
+		btd_error(adapter->dev_id, "Failed to remove UUID: %s (0x%02x)",
+						mgmt_errstr(status), status);
+		return;
 	}
 
-	uuid_to_uuid128(&uuid128, uuid);
-
-	ntoh128((uint128_t *) uuid128.value.uuid128.data, &uint128);
-	htob128(&uint128, (uint128_t *) cp.uuid);
-	cp.svc_hint = svc_hint;
-
-	DBG("sending add uuid command for index %u", adapter->dev_id);
-
-	if (mgmt_send(adapter->mgmt, MGMT_OP_ADD_UUID,
-				adapter->dev_id, sizeof(cp), &cp,
-				add_uuid_complete, adapter, NULL) > 0)
-		return 0;
-
-	btd_error(adapter->dev_id, "Failed to add UUID for index %u",
-							adapter->dev_id);
+	/*
+	 * The parameters are identical and also the task that is
+	 * required in both cases. So it is safe to just call the
+	 * event handling functions here.
+	 */
+	dev_class_changed_callback(adapter->dev_id, length, param, adapter);
 
-	return -EIO;
+	if (adapter->initialized)
+		g_dbus_emit_property_changed(dbus_conn, adapter->path,
+						ADAPTER_INTERFACE, "UUIDs");
 }
 
-static void remove_uuid_complete(uint8_t status, uint16_t length,
+static void clear_uuids_complete(uint8_t status, uint16_t length,
 					const void *param, void *user_data)
 {
 	struct btd_adapter *adapter = user_data;
 
 	if (status != MGMT_STATUS_SUCCESS) {
-		btd_error(adapter->dev_id, "Failed to remove UUID: %s (0x%02x)",
+		btd_error(adapter->dev_id, "Failed to clear UUIDs: %s (0x%02x)",
 						mgmt_errstr(status), status);
 		return;
 	}
@@ -972,65 +1091,174 @@ static void remove_uuid_complete(uint8_t status, uint16_t length,
 	 * event handling functions here.
 	 */
 	dev_class_changed_callback(adapter->dev_id, length, param, adapter);
+}
 
-	if (adapter->initialized)
-		g_dbus_emit_property_changed(dbus_conn, adapter->path,
-						ADAPTER_INTERFACE, "UUIDs");
+static void send_uuid_change(gpointer data, gpointer user_data)
+{
+	struct uuid_change *change = data;
+	struct btd_adapter *adapter = user_data;
+	unsigned int id;
+
+	if (change->add) {
+		struct mgmt_cp_add_uuid cp;
+
+		memcpy(cp.uuid, change->uuid, sizeof(cp.uuid));
+		cp.svc_hint = change->svc_hint;
+
+		DBG("sending add uuid command for index %u", adapter->dev_id);
+
+		id = mgmt_send(adapter->mgmt, MGMT_OP_ADD_UUID,
+					adapter->dev_id, sizeof(cp), &cp,
+					add_uuid_complete, adapter, NULL);
+	} else {
+		struct mgmt_cp_remove_uuid cp;
+
+		memcpy(cp.uuid, change->uuid, sizeof(cp.uuid));
+
+		DBG("sending remove uuid command for index %u",
+							adapter->dev_id);
+
+		id = mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_UUID,
+					adapter->dev_id, sizeof(cp), &cp,
+					remove_uuid_complete, adapter, NULL);
+	}
+
+	if (id > 0)
+		adapter->eir_cmds_sent++;
+	else
+		btd_error(adapter->dev_id, "Failed to %s UUID for index %u",
+				change->add ? "add" : "remove",
+				adapter->dev_id);
 }
 
-static int remove_uuid(struct btd_adapter *adapter, uuid_t *uuid)
+static gboolean eir_update_timeout(gpointer user_data)
 {
-	struct mgmt_cp_remove_uuid cp;
-	uuid_t uuid128;
-	uint128_t uint128;
+	struct btd_adapter *adapter = user_data;
 
-	if (!is_supported_uuid(uuid)) {
-		btd_warn(adapter->dev_id,
-				"Ignoring unsupported UUID for removal");
-		return 0;
+	adapter->eir_update_id = 0;
+
+	g_slist_foreach(adapter->uuid_changes, send_uuid_change, adapter);
+	g_slist_free_full(adapter->uuid_changes, g_free);
+	adapter->uuid_changes = NULL;
+
+	if (adapter->class_changed) {
+		adapter->class_changed = false;
+
+		if (send_dev_class(adapter))
+			adapter->eir_cmds_sent++;
+	}
+
+	if (adapter->pending_name) {
+		if (send_name(adapter, adapter->pending_name))
+			adapter->eir_cmds_sent++;
+
+		g_free(adapter->pending_name);
+		adapter->pending_name = NULL;
 	}
 
+	DBG("hci%u EIR updates: %u requested, %u sent, %u avoided",
+			adapter->dev_id, adapter->eir_cmds_queued,
+			adapter->eir_cmds_sent,
+			adapter->eir_cmds_queued - adapter->eir_cmds_sent);
+
+	return FALSE;
+}
+
+static void schedule_eir_update(struct btd_adapter *adapter)
+{
+	if (adapter->eir_update_id > 0)
+		return;
+
+	adapter->eir_update_id = g_timeout_add(EIR_UPDATE_DELAY,
+						eir_update_timeout, adapter);
+}
+
+static gint uuid_change_cmp(gconstpointer a, gconstpointer b)
+{
+	const struct uuid_change *change = a;
+
+	return memcmp(change->uuid, b, sizeof(change->uuid));
+}
+
+static void queue_uuid_change(struct btd_adapter *adapter, uuid_t *uuid,
+						uint8_t svc_hint, bool add)
+{
+	struct uuid_change *change;
+	uuid_t uuid128;
+	uint128_t uint128;
+	uint8_t value[16];
+	GSList *l;
+
 	uuid_to_uuid128(&uuid128, uuid);
 
 	ntoh128((uint128_t *) uuid128.value.uuid128.data, &uint128);
-	htob128(&uint128, (uint128_t *) cp.uuid);
+	htob128(&uint128, (uint128_t *) value);
 
-	DBG("sending remove uuid command for index %u", adapter->dev_id);
+	adapter->eir_cmds_queued++;
 
-	if (mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_UUID,
-				adapter->dev_id, sizeof(cp), &cp,
-				remove_uuid_complete, adapter, NULL) > 0)
-		return 0;
+	l = g_slist_find_custom(adapter->uuid_changes, value, uuid_change_cmp);
+	if (l) {
+		change = l->data;
 
-	btd_error(adapter->dev_id, "Failed to remove UUID for index %u",
-							adapter->dev_id);
+		/* Repeating a pending change is a no-op */
+		if (change->add == add)
+			return;
 
-	return -EIO;
+		/*
+		 * The kernel does not look for duplicates when adding, so
+		 * an addition and removal within the same window cancel
+		 * each other out regardless of their order.
+		 */
+		adapter->uuid_changes = g_slist_delete_link(
+						adapter->uuid_changes, l);
+		g_free(change);
+		return;
+	}
+
+	change = g_new0(struct uuid_change, 1);
+	memcpy(change->uuid, value, sizeof(change->uuid));
+	change->svc_hint = svc_hint;
+	change->add = add;
+
+	adapter->uuid_changes = g_slist_append(adapter->uuid_changes, change);
+
+	schedule_eir_update(adapter);
 }
 
-static void clear_uuids_complete(uint8_t status, uint16_t length,
-					const void *param, void *user_data)
+static int add_uuid(struct btd_adapter *adapter, uuid_t *uuid, uint8_t svc_hint)
 {
-	struct btd_adapter *adapter = user_data;
+	if (!is_supported_uuid(uuid)) {
+		btd_warn(adapter->dev_id,
+				"Ignoring unsupported UUID for addition");
+		return 0;
+	}
 
-	if (status != MGMT_STATUS_SUCCESS) {
-		btd_error(adapter->dev_id, "Failed to clear UUIDs: %s (0x%02x)",
-						mgmt_errstr(status), status);
-		return;
+	queue_uuid_change(adapter, uuid, svc_hint, true);
+
+	return 0;
+}
+
+static int remove_uuid(struct btd_adapter *adapter, uuid_t *uuid)
+{
+	if (!is_supported_uuid(uuid)) {
+		btd_warn(adapter->dev_id,
+				"Ignoring unsupported UUID for removal");
+		return 0;
 	}
 
-	/*
-	 * The parameters are identical and also the task that is
-	 * required in both cases. So it is safe to just call the
-	 * event handling functions here.
-	 */
-	dev_class_changed_callback(adapter->dev_id, length, param, adapter);
+	queue_uuid_change(adapter, uuid, 0, false);
+
+	return 0;
 }
 
 static int clear_uuids(struct btd_adapter *adapter)
 {
 	struct mgmt_cp_remove_uuid cp;
 
+	/* Pending changes would be wiped out by the clear anyway */
+	g_slist_free_full(adapter->uuid_changes, g_free);
+	adapter->uuid_changes = NULL;
+
 	memset(&cp, 0, sizeof(cp));
 
 	DBG("sending clear uuids command for index %u", adapter->dev_id);
@@ -1168,11 +1396,214 @@ void adapter_service_remove(struct btd_adapter *adapter, uint32_t handle)
 	remove_record_from_server(rec->handle);
 }
 
+static guint seen_device_hash(gconstpointer key)
+{
+	const struct seen_device *seen = key;
+	guint hash = seen->bdaddr_type;
+	int i;
+
+	for (i = 0; i < 6; i++)
+		hash = hash * 31 + seen->bdaddr.b[i];
+
+	return hash;
+}
+
+static gboolean seen_device_equal(gconstpointer a, gconstpointer b)
+{
+	const struct seen_device *seen_a = a;
+	const struct seen_device *seen_b = b;
+
+	return seen_a->bdaddr_type == seen_b->bdaddr_type &&
+				!bacmp(&seen_a->bdaddr, &seen_b->bdaddr);
+}
+
+/* FNV-1a, only used to notice a payload change */
+static uint32_t payload_hash(const uint8_t *data, uint8_t len)
+{
+	uint32_t hash = 2166136261u;
+	uint8_t i;
+
+	for (i = 0; i < len; i++) {
+		hash ^= data[i];
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+static void seen_stats_print(struct btd_adapter *adapter)
+{
+	struct seen_stats *stats = &adapter->seen_stats;
+	unsigned int count = 0;
+
+	if (adapter->seen_devices)
+		count = g_hash_table_size(adapter->seen_devices);
+
+	DBG("hci%u seen: %u records (%zu bytes), %u added, %u reports, "
+			"%u promoted, %u expired, %u dropped",
+			adapter->dev_id, count,
+			count * sizeof(struct seen_device), stats->added,
+			stats->reports, stats->promoted, stats->expired,
+			stats->dropped);
+}
+
+static gboolean seen_device_stale(gpointer key, gpointer value,
+							gpointer user_data)
+{
+	struct seen_device *seen = key;
+	time_t *oldest = user_data;
+
+	return seen->last_seen < *oldest;
+}
+
+static gboolean seen_devices_expire(gpointer user_data)
+{
+	struct btd_adapter *adapter = user_data;
+	time_t oldest = time(NULL) - main_opts.tmpto;
+
+	adapter->seen_stats.expired += g_hash_table_foreach_remove(
+						adapter->seen_devices,
+						seen_device_stale, &oldest);
+
+	seen_stats_print(adapter);
+
+	if (g_hash_table_size(adapter->seen_devices))
+		return TRUE;
+
+	adapter->seen_expire_id = 0;
+
+	return FALSE;
+}
+
+static void seen_devices_clear(struct btd_adapter *adapter)
+{
+	if (adapter->seen_expire_id > 0) {
+		g_source_remove(adapter->seen_expire_id);
+		adapter->seen_expire_id = 0;
+	}
+
+	if (!adapter->seen_devices)
+		return;
+
+	seen_stats_print(adapter);
+
+	g_hash_table_remove_all(adapter->seen_devices);
+}
+
+/* Records checked before a discovery change need to be checked again */
+static void seen_devices_reevaluate(struct btd_adapter *adapter)
+{
+	adapter->seen_gen++;
+}
+
+static struct seen_device *seen_device_find(struct btd_adapter *adapter,
+						const bdaddr_t *bdaddr,
+						uint8_t bdaddr_type)
+{
+	struct seen_device key;
+
+	if (!adapter->seen_devices)
+		return NULL;
+
+	bacpy(&key.bdaddr, bdaddr);
+	key.bdaddr_type = bdaddr_type;
+
+	return g_hash_table_lookup(adapter->seen_devices, &key);
+}
+
+static bool discovery_filter_proximity(struct btd_adapter *adapter)
+{
+	GSList *l;
+
+	for (l = adapter->discovery_list; l; l = g_slist_next(l)) {
+		struct discovery_client *client = l->data;
+		struct discovery_filter *item = client->discovery_filter;
+
+		if (item && (item->rssi != DISTANCE_VAL_INVALID ||
+				item->pathloss != DISTANCE_VAL_INVALID))
+			return true;
+	}
+
+	return false;
+}
+
+/*
+ * Absorbs a report from an advertiser that was already found not to be of
+ * interest, as long as neither its payload nor the discovery state have
+ * changed since, and its signal is no stronger than when it was checked.
+ */
+static bool seen_device_report(struct btd_adapter *adapter,
+					const bdaddr_t *bdaddr,
+					uint8_t bdaddr_type, int8_t rssi,
+					const uint8_t *data, uint8_t data_len)
+{
+	struct seen_device *seen;
+
+	seen = seen_device_find(adapter, bdaddr, bdaddr_type);
+	if (!seen)
+		return false;
+
+	/* Without discovery clients there is nothing to promote it for */
+	if (adapter->discovery_list && (seen->gen != adapter->seen_gen ||
+			seen->payload != payload_hash(data, data_len)))
+		return false;
+
+	/* A device coming closer may now be within a filter's proximity */
+	if (adapter->filtered_discovery && rssi > seen->rssi &&
+					discovery_filter_proximity(adapter))
+		return false;
+
+	seen->last_seen = time(NULL);
+	adapter->seen_stats.reports++;
+
+	return true;
+}
+
+static void seen_device_update(struct btd_adapter *adapter,
+					const bdaddr_t *bdaddr,
+					uint8_t bdaddr_type, int8_t rssi,
+					const uint8_t *data, uint8_t data_len)
+{
+	struct seen_device *seen;
+
+	seen = seen_device_find(adapter, bdaddr, bdaddr_type);
+	if (!seen) {
+		if (!adapter->seen_devices)
+			adapter->seen_devices = g_hash_table_new_full(
+						seen_device_hash,
+						seen_device_equal,
+						g_free, NULL);
+
+		if (g_hash_table_size(adapter->seen_devices) >=
+							SEEN_DEVICES_MAX) {
+			adapter->seen_stats.dropped++;
+			return;
+		}
+
+		seen = g_new0(struct seen_device, 1);
+		bacpy(&seen->bdaddr, bdaddr);
+		seen->bdaddr_type = bdaddr_type;
+		g_hash_table_add(adapter->seen_devices, seen);
+		adapter->seen_stats.added++;
+
+		if (!adapter->seen_expire_id)
+			adapter->seen_expire_id = g_timeout_add_seconds(
+						SEEN_EXPIRE_INTERVAL,
+						seen_devices_expire, adapter);
+	}
+
+	seen->rssi = rssi;
+	seen->payload = payload_hash(data, data_len);
+	seen->gen = adapter->seen_gen;
+	seen->last_seen = time(NULL);
+}
+
 static struct btd_device *adapter_create_device(struct btd_adapter *adapter,
 						const bdaddr_t *bdaddr,
 						uint8_t bdaddr_type)
 {
 	struct btd_device *device;
+	struct seen_device *seen;
 
 	device = device_create(adapter, bdaddr, bdaddr_type);
 	if (!device)
@@ -1180,6 +1611,13 @@ static struct btd_device *adapter_create_device(struct btd_adapter *adapter,
 
 	adapter->devices = g_slist_append(adapter->devices, device);
 
+	seen = seen_device_find(adapter, bdaddr, bdaddr_type);
+	if (seen) {
+		device_update_last_seen(device, bdaddr_type);
+		g_hash_table_remove(adapter->seen_devices, seen);
+		adapter->seen_stats.promoted++;
+	}
+
 	return device;
 }
 
@@ -1213,6 +1651,10 @@ void btd_adapter_remove_device(struct btd_adapter *adapter,
 
 	adapter->connect_list = g_slist_remove(adapter->connect_list, dev);
 
+	/* The kernel drops the entry itself when the device is removed */
+	connect_entry_remove(adapter, device_get_address(dev),
+					btd_device_get_bdaddr_type(dev));
+
 	adapter->devices = g_slist_remove(adapter->devices, dev);
 
 	adapter->discovery_found = g_slist_remove(adapter->discovery_found,
@@ -1465,6 +1907,34 @@ static void invalidate_rssi_and_tx_power(gpointer a)
 	device_set_tx_power(dev, 127);
 }
 
+struct name_request {
+	struct btd_adapter *adapter;
+	bdaddr_t bdaddr;
+	uint8_t bdaddr_type;
+	bool name_known;
+	bool priority;
+	unsigned int id;
+	gint64 found;			/* time the device was first reported */
+};
+
+static void name_stats_reset(struct btd_adapter *adapter)
+{
+	struct name_stats *stats = &adapter->name_stats;
+
+	if (stats->confirmed)
+		DBG("hci%u names: %u confirmed, %u requested, %u deferred, "
+			"%u resolved, avg %" PRIu64 " ms, max %u ms",
+			adapter->dev_id, stats->confirmed, stats->requested,
+			stats->deferred, stats->resolved,
+			stats->resolved ? stats->total_ms / stats->resolved : 0,
+			stats->max_ms);
+
+	g_slist_free_full(adapter->name_resolving, g_free);
+	adapter->name_resolving = NULL;
+
+	memset(stats, 0, sizeof(*stats));
+}
+
 static void discovery_cleanup(struct btd_adapter *adapter, int timeout)
 {
 	GSList *l, *next;
@@ -1480,6 +1950,8 @@ static void discovery_cleanup(struct btd_adapter *adapter, int timeout)
 						invalidate_rssi_and_tx_power);
 	adapter->discovery_found = NULL;
 
+	name_stats_reset(adapter);
+
 	if (!adapter->devices)
 		return;
 
@@ -1526,6 +1998,8 @@ static void discovery_remove(struct discovery_client *client)
 	adapter->discovery_list = g_slist_remove(adapter->discovery_list,
 								client);
 
+	seen_devices_reevaluate(adapter);
+
 	if (adapter->client == client)
 		adapter->client = NULL;
 
@@ -1616,6 +2090,8 @@ static void start_discovery_complete(uint8_t status, uint16_t length,
 		else
 			adapter->filtered_discovery = false;
 
+		seen_devices_reevaluate(adapter);
+
 		discovery_complete(adapter, status);
 
 		if (adapter->discovering)
@@ -2278,6 +2754,8 @@ static DBusMessage *start_discovery(DBusConnection *conn,
 								client);
 
 done:
+	seen_devices_reevaluate(adapter);
+
 	/*
 	 * Just trigger the discovery here. In case an already running
 	 * discovery in idle phase exists, it will be restarted right
@@ -2554,6 +3032,8 @@ static DBusMessage *set_discovery_filter(DBusConnection *conn,
 		free_discovery_filter(client->discovery_filter);
 		client->discovery_filter = discovery_filter;
 
+		seen_devices_reevaluate(adapter);
+
 		if (is_discovering)
 			update_discovery_filter(adapter);
 
@@ -2699,7 +3179,7 @@ static void property_set_alias(const GDBusPropertyTable *property,
 		}
 
 		/* restore to system name */
-		ret = set_name(adapter, adapter->system_name);
+		ret = set_name(adapter, adapter->system_name, false);
 	} else {
 		if (g_strcmp0(adapter->stored_alias, name) == 0) {
 			/* alias already set, nothing to do */
@@ -2708,7 +3188,7 @@ static void property_set_alias(const GDBusPropertyTable *property,
 		}
 
 		/* set to alias */
-		ret = set_name(adapter, name);
+		ret = set_name(adapter, name, false);
 	}
 
 	if (ret >= 0) {
@@ -5009,9 +5489,83 @@ void adapter_whitelist_remove(struct btd_adapter *adapter, struct btd_device *de
 	bacpy(&cp.addr.bdaddr, device_get_address(dev));
 	cp.addr.type = BDADDR_BREDR;
 
-	mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_DEVICE,
-				adapter->dev_id, sizeof(cp), &cp,
-				remove_whitelist_complete, adapter, NULL);
+	mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_DEVICE,
+				adapter->dev_id, sizeof(cp), &cp,
+				remove_whitelist_complete, adapter, NULL);
+}
+
+static struct connect_entry *connect_entry_find(struct btd_adapter *adapter,
+							const bdaddr_t *bdaddr,
+							uint8_t bdaddr_type)
+{
+	GSList *l;
+
+	for (l = adapter->connect_applied; l; l = l->next) {
+		struct connect_entry *entry = l->data;
+
+		if (entry->bdaddr_type == bdaddr_type &&
+					!bacmp(&entry->bdaddr, bdaddr))
+			return entry;
+	}
+
+	return NULL;
+}
+
+static void connect_entry_remove(struct btd_adapter *adapter,
+							const bdaddr_t *bdaddr,
+							uint8_t bdaddr_type)
+{
+	struct connect_entry *entry;
+
+	entry = connect_entry_find(adapter, bdaddr, bdaddr_type);
+	if (!entry)
+		return;
+
+	adapter->connect_applied = g_slist_remove(adapter->connect_applied,
+									entry);
+	g_free(entry);
+}
+
+static bool connect_list_wants(struct btd_adapter *adapter,
+					const struct connect_entry *entry)
+{
+	GSList *l;
+
+	for (l = adapter->connect_list; l; l = l->next) {
+		struct btd_device *dev = l->data;
+
+		if (btd_device_get_bdaddr_type(dev) == entry->bdaddr_type &&
+				!bacmp(device_get_address(dev), &entry->bdaddr))
+			return true;
+	}
+
+	return false;
+}
+
+static void connect_list_sent(struct btd_adapter *adapter)
+{
+	struct connect_list_stats *stats = &adapter->connect_stats;
+
+	if (!stats->pending++)
+		stats->busy_start = g_get_monotonic_time();
+
+	stats->sent++;
+}
+
+static void connect_list_done(struct btd_adapter *adapter)
+{
+	struct connect_list_stats *stats = &adapter->connect_stats;
+
+	if (!stats->pending || --stats->pending)
+		return;
+
+	stats->busy_time += g_get_monotonic_time() - stats->busy_start;
+
+	DBG("hci%u connect list: %u changes, %u commands, %u avoided, "
+			"%lld ms updating", adapter->dev_id, stats->changes,
+			stats->sent, stats->changes > stats->sent ?
+			stats->changes - stats->sent : 0,
+			(long long) stats->busy_time / 1000);
 }
 
 static void add_device_complete(uint8_t status, uint16_t length,
@@ -5022,6 +5576,8 @@ static void add_device_complete(uint8_t status, uint16_t length,
 	struct btd_device *dev;
 	char addr[18];
 
+	connect_list_done(adapter);
+
 	if (length < sizeof(*rp)) {
 		btd_error(adapter->dev_id,
 				"Too small Add Device complete event");
@@ -5030,6 +5586,9 @@ static void add_device_complete(uint8_t status, uint16_t length,
 
 	ba2str(&rp->addr.bdaddr, addr);
 
+	if (status != MGMT_STATUS_SUCCESS)
+		connect_entry_remove(adapter, &rp->addr.bdaddr, rp->addr.type);
+
 	dev = btd_adapter_find_device(adapter, &rp->addr.bdaddr,
 							rp->addr.type);
 	if (!dev) {
@@ -5050,14 +5609,125 @@ static void add_device_complete(uint8_t status, uint16_t length,
 	DBG("%s (%u) added to kernel connect list", addr, rp->addr.type);
 }
 
-void adapter_auto_connect_add(struct btd_adapter *adapter,
-					struct btd_device *device)
+static void remove_device_complete(uint8_t status, uint16_t length,
+					const void *param, void *user_data)
+{
+	const struct mgmt_rp_remove_device *rp = param;
+	struct btd_adapter *adapter = user_data;
+	char addr[18];
+
+	connect_list_done(adapter);
+
+	if (length < sizeof(*rp)) {
+		error("Too small Remove Device complete event");
+		return;
+	}
+
+	ba2str(&rp->addr.bdaddr, addr);
+
+	if (status != MGMT_STATUS_SUCCESS) {
+		error("Failed to remove device %s (%u): %s (0x%02x)",
+			addr, rp->addr.type, mgmt_errstr(status), status);
+		return;
+	}
+
+	DBG("%s (%u) removed from kernel connect list", addr, rp->addr.type);
+}
+
+static bool connect_list_send(struct btd_adapter *adapter, uint16_t opcode,
+					const struct connect_entry *entry)
 {
 	struct mgmt_cp_add_device cp;
-	const bdaddr_t *bdaddr;
-	uint8_t bdaddr_type;
-	unsigned int id;
+	mgmt_request_func_t func;
+	uint16_t len;
+
+	memset(&cp, 0, sizeof(cp));
+	bacpy(&cp.addr.bdaddr, &entry->bdaddr);
+	cp.addr.type = entry->bdaddr_type;
+
+	if (opcode == MGMT_OP_ADD_DEVICE) {
+		cp.action = 0x02;
+		len = sizeof(struct mgmt_cp_add_device);
+		func = add_device_complete;
+	} else {
+		len = sizeof(struct mgmt_cp_remove_device);
+		func = remove_device_complete;
+	}
+
+	if (!mgmt_send(adapter->mgmt, opcode, adapter->dev_id, len, &cp,
+							func, adapter, NULL))
+		return false;
+
+	connect_list_sent(adapter);
+
+	return true;
+}
+
+/* Every Add/Remove Device makes the kernel pause scanning and rewrite the
+ * controller accept and resolving lists, so changes are collected for a
+ * short while and only the difference between what the kernel has been
+ * given and what is wanted now is sent, back to back.
+ */
+static gboolean connect_list_sync(gpointer user_data)
+{
+	struct btd_adapter *adapter = user_data;
+	GSList *l, *next;
+
+	adapter->connect_sync_id = 0;
+
+	/* Removals first so additions find room in the controller lists */
+	for (l = adapter->connect_applied; l; l = next) {
+		struct connect_entry *entry = l->data;
+
+		next = l->next;
+
+		if (connect_list_wants(adapter, entry))
+			continue;
+
+		if (!connect_list_send(adapter, MGMT_OP_REMOVE_DEVICE, entry))
+			continue;
+
+		adapter->connect_applied = g_slist_delete_link(
+						adapter->connect_applied, l);
+		g_free(entry);
+	}
+
+	for (l = adapter->connect_list; l; l = l->next) {
+		struct btd_device *dev = l->data;
+		struct connect_entry entry;
 
+		bacpy(&entry.bdaddr, device_get_address(dev));
+		entry.bdaddr_type = btd_device_get_bdaddr_type(dev);
+
+		if (connect_entry_find(adapter, &entry.bdaddr,
+							entry.bdaddr_type))
+			continue;
+
+		if (!connect_list_send(adapter, MGMT_OP_ADD_DEVICE, &entry))
+			continue;
+
+		adapter->connect_applied = g_slist_append(
+					adapter->connect_applied,
+					g_memdup(&entry, sizeof(entry)));
+	}
+
+	return FALSE;
+}
+
+static void connect_list_changed(struct btd_adapter *adapter)
+{
+	adapter->connect_stats.changes++;
+
+	if (adapter->connect_sync_id)
+		return;
+
+	adapter->connect_sync_id = g_timeout_add(CONNECT_LIST_DELAY,
+						connect_list_sync, adapter);
+}
+
+void adapter_auto_connect_add(struct btd_adapter *adapter,
+					struct btd_device *device)
+{
 	if (!btd_has_kernel_features(KERNEL_CONN_CONTROL))
 		return;
 
@@ -5067,26 +5737,14 @@ void adapter_auto_connect_add(struct btd_adapter *adapter,
 		return;
 	}
 
-	bdaddr = device_get_address(device);
-	bdaddr_type = btd_device_get_bdaddr_type(device);
-
-	if (bdaddr_type == BDADDR_BREDR) {
+	if (btd_device_get_bdaddr_type(device) == BDADDR_BREDR) {
 		DBG("auto-connection feature is not avaiable for BR/EDR");
 		return;
 	}
 
-	memset(&cp, 0, sizeof(cp));
-	bacpy(&cp.addr.bdaddr, bdaddr);
-	cp.addr.type = bdaddr_type;
-	cp.action = 0x02;
-
-	id = mgmt_send(adapter->mgmt, MGMT_OP_ADD_DEVICE,
-			adapter->dev_id, sizeof(cp), &cp, add_device_complete,
-			adapter, NULL);
-	if (id == 0)
-		return;
-
 	adapter->connect_list = g_slist_append(adapter->connect_list, device);
+
+	connect_list_changed(adapter);
 }
 
 static void set_device_wakeable_complete(uint8_t status, uint16_t length,
@@ -5177,36 +5835,9 @@ static void device_flags_changed_callback(uint16_t index, uint16_t length,
 }
 
 
-static void remove_device_complete(uint8_t status, uint16_t length,
-					const void *param, void *user_data)
-{
-	const struct mgmt_rp_remove_device *rp = param;
-	char addr[18];
-
-	if (length < sizeof(*rp)) {
-		error("Too small Remove Device complete event");
-		return;
-	}
-
-	ba2str(&rp->addr.bdaddr, addr);
-
-	if (status != MGMT_STATUS_SUCCESS) {
-		error("Failed to remove device %s (%u): %s (0x%02x)",
-			addr, rp->addr.type, mgmt_errstr(status), status);
-		return;
-	}
-
-	DBG("%s (%u) removed from kernel connect list", addr, rp->addr.type);
-}
-
 void adapter_auto_connect_remove(struct btd_adapter *adapter,
 					struct btd_device *device)
 {
-	struct mgmt_cp_remove_device cp;
-	const bdaddr_t *bdaddr;
-	uint8_t bdaddr_type;
-	unsigned int id;
-
 	if (!btd_has_kernel_features(KERNEL_CONN_CONTROL))
 		return;
 
@@ -5215,25 +5846,14 @@ void adapter_auto_connect_remove(struct btd_adapter *adapter,
 		return;
 	}
 
-	bdaddr = device_get_address(device);
-	bdaddr_type = btd_device_get_bdaddr_type(device);
-
-	if (bdaddr_type == BDADDR_BREDR) {
+	if (btd_device_get_bdaddr_type(device) == BDADDR_BREDR) {
 		DBG("auto-connection feature is not avaiable for BR/EDR");
 		return;
 	}
 
-	memset(&cp, 0, sizeof(cp));
-	bacpy(&cp.addr.bdaddr, bdaddr);
-	cp.addr.type = bdaddr_type;
-
-	id = mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_DEVICE,
-			adapter->dev_id, sizeof(cp), &cp,
-			remove_device_complete, adapter, NULL);
-	if (id == 0)
-		return;
-
 	adapter->connect_list = g_slist_remove(adapter->connect_list, device);
+
+	connect_list_changed(adapter);
 }
 
 static void adapter_start(struct btd_adapter *adapter)
@@ -5308,6 +5928,34 @@ static void remove_discovery_list(struct btd_adapter *adapter)
 	adapter->discovery_list = NULL;
 }
 
+static void confirm_name_cleanup(struct btd_adapter *adapter)
+{
+	if (adapter->confirm_name_flush > 0) {
+		g_source_remove(adapter->confirm_name_flush);
+		adapter->confirm_name_flush = 0;
+	}
+
+	if (adapter->confirm_name_timeout > 0) {
+		g_source_remove(adapter->confirm_name_timeout);
+		adapter->confirm_name_timeout = 0;
+	}
+
+	g_slist_free_full(adapter->confirm_queue, g_free);
+	adapter->confirm_queue = NULL;
+
+	while (adapter->confirm_pending) {
+		struct name_request *req = adapter->confirm_pending->data;
+
+		mgmt_cancel(adapter->mgmt, req->id);
+		adapter->confirm_pending = g_slist_remove(
+					adapter->confirm_pending, req);
+		g_free(req);
+	}
+
+	g_slist_free_full(adapter->name_resolving, g_free);
+	adapter->name_resolving = NULL;
+}
+
 static void adapter_free(gpointer user_data)
 {
 	struct btd_adapter *adapter = user_data;
@@ -5332,8 +5980,17 @@ static void adapter_free(gpointer user_data)
 	if (adapter->load_ltks_timeout > 0)
 		g_source_remove(adapter->load_ltks_timeout);
 
-	if (adapter->confirm_name_timeout > 0)
-		g_source_remove(adapter->confirm_name_timeout);
+	if (adapter->eir_update_id > 0)
+		g_source_remove(adapter->eir_update_id);
+
+	g_slist_free_full(adapter->uuid_changes, g_free);
+	g_free(adapter->pending_name);
+
+	confirm_name_cleanup(adapter);
+
+	seen_devices_clear(adapter);
+	if (adapter->seen_devices)
+		g_hash_table_destroy(adapter->seen_devices);
 
 	if (adapter->pair_device_timeout > 0)
 		g_source_remove(adapter->pair_device_timeout);
@@ -6323,6 +6980,14 @@ static void adapter_remove(struct btd_adapter *adapter)
 	g_slist_free(adapter->connect_list);
 	adapter->connect_list = NULL;
 
+	if (adapter->connect_sync_id > 0) {
+		g_source_remove(adapter->connect_sync_id);
+		adapter->connect_sync_id = 0;
+	}
+
+	g_slist_free_full(adapter->connect_applied, g_free);
+	adapter->connect_applied = NULL;
+
 	for (l = adapter->devices; l; l = l->next)
 		device_remove(l->data, FALSE);
 
@@ -6366,6 +7031,78 @@ const bdaddr_t *btd_adapter_get_address(struct btd_adapter *adapter)
 	return &adapter->bdaddr;
 }
 
+static gint name_request_cmp(gconstpointer a, gconstpointer b)
+{
+	const struct name_request *req = a;
+	const struct name_request *queued = b;
+
+	/* Priority requests go after the queued priority ones and
+	 * everything else at the end, keeping both in arrival order.
+	 */
+	if (req->priority && !queued->priority)
+		return -1;
+
+	return 1;
+}
+
+static gint name_request_match(gconstpointer a, gconstpointer b)
+{
+	const struct name_request *req = a;
+	const bdaddr_t *bdaddr = b;
+
+	return bacmp(&req->bdaddr, bdaddr);
+}
+
+static void name_resolved(struct btd_adapter *adapter, const bdaddr_t *bdaddr)
+{
+	struct name_stats *stats = &adapter->name_stats;
+	struct name_request *req;
+	unsigned int ms;
+	GSList *l;
+
+	l = g_slist_find_custom(adapter->name_resolving, bdaddr,
+							name_request_match);
+	if (!l)
+		return;
+
+	req = l->data;
+	adapter->name_resolving = g_slist_delete_link(adapter->name_resolving,
+									l);
+
+	ms = (g_get_monotonic_time() - req->found) / 1000;
+
+	stats->resolved++;
+	stats->total_ms += ms;
+	if (ms > stats->max_ms)
+		stats->max_ms = ms;
+
+	DBG("hci%u name resolved after %u ms", adapter->dev_id, ms);
+
+	g_free(req);
+}
+
+static void confirm_name_done(struct btd_adapter *adapter,
+						struct name_request *req)
+{
+	adapter->confirm_pending = g_slist_remove(adapter->confirm_pending,
+									req);
+
+	if (!adapter->confirm_pending && adapter->confirm_name_timeout > 0) {
+		g_source_remove(adapter->confirm_name_timeout);
+		adapter->confirm_name_timeout = 0;
+	}
+
+	/* Keep track of names the kernel still has to resolve */
+	if (!req->name_known && adapter->discovery_list) {
+		req->id = 0;
+		adapter->name_resolving = g_slist_prepend(
+						adapter->name_resolving, req);
+		return;
+	}
+
+	g_free(req);
+}
+
 static gboolean confirm_name_timeout(gpointer user_data)
 {
 	struct btd_adapter *adapter = user_data;
@@ -6375,8 +7112,12 @@ static gboolean confirm_name_timeout(gpointer user_data)
 
 	adapter->confirm_name_timeout = 0;
 
-	mgmt_cancel(adapter->mgmt, adapter->confirm_name_id);
-	adapter->confirm_name_id = 0;
+	while (adapter->confirm_pending) {
+		struct name_request *req = adapter->confirm_pending->data;
+
+		mgmt_cancel(adapter->mgmt, req->id);
+		confirm_name_done(adapter, req);
+	}
 
 	return FALSE;
 }
@@ -6384,74 +7125,130 @@ static gboolean confirm_name_timeout(gpointer user_data)
 static void confirm_name_complete(uint8_t status, uint16_t length,
 					const void *param, void *user_data)
 {
-	struct btd_adapter *adapter = user_data;
+	struct name_request *req = user_data;
+	struct btd_adapter *adapter = req->adapter;
 
 	if (status != MGMT_STATUS_SUCCESS) {
 		btd_error(adapter->dev_id,
 				"Failed to confirm name for hci%u: %s (0x%02x)",
 				adapter->dev_id, mgmt_errstr(status), status);
+		req->name_known = true;
 	}
 
-	adapter->confirm_name_id = 0;
-
-	g_source_remove(adapter->confirm_name_timeout);
-	adapter->confirm_name_timeout = 0;
-
-	DBG("Confirm name complete for hci%u", adapter->dev_id);
+	confirm_name_done(adapter, req);
 }
 
-static void confirm_name(struct btd_adapter *adapter, const bdaddr_t *bdaddr,
-					uint8_t bdaddr_type, bool name_known)
+static void confirm_name_send(gpointer data, gpointer user_data)
 {
+	struct name_request *req = data;
+	struct btd_adapter *adapter = user_data;
 	struct mgmt_cp_confirm_name cp;
-	char addr[18];
-
-	ba2str(bdaddr, addr);
-	DBG("hci%d bdaddr %s name_known %u", adapter->dev_id, addr,
-								name_known);
-
-	/*
-	 * If the kernel does not answer the confirm name command with
-	 * a command complete or command status in time, this might
-	 * race against another device found event that also requires
-	 * to confirm the name. If there is a pending command, just
-	 * cancel it to be safe here.
-	 */
-	if (adapter->confirm_name_id > 0) {
-		btd_warn(adapter->dev_id,
-				"Found pending confirm name for hci%u",
-							adapter->dev_id);
-		mgmt_cancel(adapter->mgmt, adapter->confirm_name_id);
-	}
-
-	if (adapter->confirm_name_timeout > 0) {
-		g_source_remove(adapter->confirm_name_timeout);
-		adapter->confirm_name_timeout = 0;
-	}
 
 	memset(&cp, 0, sizeof(cp));
-	bacpy(&cp.addr.bdaddr, bdaddr);
-	cp.addr.type = bdaddr_type;
-	cp.name_known = name_known;
+	bacpy(&cp.addr.bdaddr, &req->bdaddr);
+	cp.addr.type = req->bdaddr_type;
+	cp.name_known = req->name_known;
 
-	adapter->confirm_name_id = mgmt_reply(adapter->mgmt,
-					MGMT_OP_CONFIRM_NAME,
+	req->id = mgmt_reply(adapter->mgmt, MGMT_OP_CONFIRM_NAME,
 					adapter->dev_id, sizeof(cp), &cp,
-					confirm_name_complete, adapter, NULL);
-
-	if (adapter->confirm_name_id == 0) {
+					confirm_name_complete, req, NULL);
+	if (req->id == 0) {
 		btd_error(adapter->dev_id, "Failed to confirm name for hci%u",
 							adapter->dev_id);
+		g_free(req);
 		return;
 	}
 
+	adapter->name_stats.confirmed++;
+	if (!req->name_known)
+		adapter->name_stats.requested++;
+
+	adapter->confirm_pending = g_slist_prepend(adapter->confirm_pending,
+									req);
+}
+
+static gboolean confirm_name_flush(gpointer user_data)
+{
+	struct btd_adapter *adapter = user_data;
+	GSList *queue = adapter->confirm_queue;
+
+	adapter->confirm_name_flush = 0;
+	adapter->confirm_queue = NULL;
+
+	DBG("hci%u sending %u name confirmations", adapter->dev_id,
+						g_slist_length(queue));
+
+	/* Replies are written back-to-back without waiting for each
+	 * other's completion, so the whole batch reaches the kernel in
+	 * priority order within a single mainloop iteration.
+	 */
+	g_slist_foreach(queue, confirm_name_send, adapter);
+	g_slist_free(queue);
+
 	/*
 	 * This timeout handling is needed since the kernel is stupid
 	 * and forgets to send a command complete response. However in
 	 * case of failures it does send a command status.
 	 */
-	adapter->confirm_name_timeout = g_timeout_add_seconds(2,
+	if (adapter->confirm_pending && !adapter->confirm_name_timeout)
+		adapter->confirm_name_timeout = g_timeout_add_seconds(2,
 						confirm_name_timeout, adapter);
+
+	return FALSE;
+}
+
+static bool name_request_priority(struct btd_adapter *adapter,
+						struct btd_device *dev)
+{
+	/* Devices the user already knows about or is acting upon */
+	if (device_is_bonded(dev, BDADDR_BREDR) || device_is_trusted(dev))
+		return true;
+
+	if (device_is_bonding(dev, NULL) ||
+				g_slist_find(adapter->connect_list, dev))
+		return true;
+
+	return false;
+}
+
+static void confirm_name(struct btd_adapter *adapter, struct btd_device *dev,
+				const bdaddr_t *bdaddr, uint8_t bdaddr_type,
+				bool name_known)
+{
+	struct name_stats *stats = &adapter->name_stats;
+	struct name_request *req;
+	char addr[18];
+
+	req = g_new0(struct name_request, 1);
+	req->adapter = adapter;
+	bacpy(&req->bdaddr, bdaddr);
+	req->bdaddr_type = bdaddr_type;
+	req->name_known = name_known;
+	req->priority = name_request_priority(adapter, dev);
+	req->found = g_get_monotonic_time();
+
+	/*
+	 * The kernel resolves every unknown name once inquiry is over, one
+	 * at a time. When enough of them are already waiting, settle for
+	 * the shortened name of devices nobody asked for.
+	 */
+	if (!name_known && !req->priority && device_name_known(dev) &&
+			stats->requested - stats->resolved >=
+							NAME_RESOLVE_BUDGET) {
+		req->name_known = true;
+		stats->deferred++;
+	}
+
+	ba2str(bdaddr, addr);
+	DBG("hci%d bdaddr %s name_known %u priority %u", adapter->dev_id,
+					addr, req->name_known, req->priority);
+
+	adapter->confirm_queue = g_slist_insert_sorted(adapter->confirm_queue,
+							req, name_request_cmp);
+
+	if (!adapter->confirm_name_flush)
+		adapter->confirm_name_flush = g_idle_add(confirm_name_flush,
+								adapter);
 }
 
 static void adapter_msd_notify(struct btd_adapter *adapter,
@@ -6601,6 +7398,11 @@ static void update_found_devices(struct btd_adapter *adapter,
 	char addr[18];
 	bool duplicate = false;
 
+	dev = btd_adapter_find_device(adapter, bdaddr, bdaddr_type);
+	if (!dev && seen_device_report(adapter, bdaddr, bdaddr_type, rssi,
+							data, data_len))
+		return;
+
 	memset(&eir_data, 0, sizeof(eir_data));
 	eir_parse(&eir_data, data, data_len);
 
@@ -6609,9 +7411,17 @@ static void update_found_devices(struct btd_adapter *adapter,
 	discoverable = device_is_discoverable(adapter, &eir_data, addr,
 							bdaddr_type);
 
-	dev = btd_adapter_find_device(adapter, bdaddr, bdaddr_type);
 	if (!dev) {
-		if (!discoverable) {
+		/*
+		 * Only create a device when a discovery client is going to
+		 * be told about it, otherwise just keep track of it.
+		 */
+		if (!discoverable || !adapter->discovery_list ||
+				(adapter->filtered_discovery &&
+				!is_filter_match(adapter->discovery_list,
+							&eir_data, rssi))) {
+			seen_device_update(adapter, bdaddr, bdaddr_type, rssi,
+							data, data_len);
 			eir_data_free(&eir_data);
 			return;
 		}
@@ -6641,9 +7451,13 @@ static void update_found_devices(struct btd_adapter *adapter,
 		device_update_last_seen(dev, BDADDR_BREDR);
 	}
 
-	if (eir_data.name != NULL && eir_data.name_complete)
+	if (eir_data.name != NULL && eir_data.name_complete) {
 		device_store_cached_name(dev, eir_data.name);
 
+		if (adapter->name_resolving)
+			name_resolved(adapter, bdaddr);
+	}
+
 	/*
 	 * Only skip devices that are not connected, are temporary and there
 	 * is no active discovery session ongoing.
@@ -6726,7 +7540,7 @@ static void update_found_devices(struct btd_adapter *adapter,
 		return;
 
 	if (confirm)
-		confirm_name(adapter, bdaddr, bdaddr_type, name_known);
+		confirm_name(adapter, dev, bdaddr, bdaddr_type, name_known);
 
 	adapter->discovery_found = g_slist_prepend(adapter->discovery_found,
 									dev);
@@ -6850,6 +7664,8 @@ static void adapter_stop(struct btd_adapter *adapter)
 
 	discovery_cleanup(adapter, 0);
 
+	seen_devices_clear(adapter);
+
 	adapter->filtered_discovery = false;
 	adapter->no_scan_restart_delay = false;
 	g_free(adapter->current_discovery_filter);
@@ -9003,8 +9819,11 @@ static int clear_devices(struct btd_adapter *adapter)
 
 	if (mgmt_send(adapter->mgmt, MGMT_OP_REMOVE_DEVICE,
 				adapter->dev_id, sizeof(cp), &cp,
-				clear_devices_complete, adapter, NULL) > 0)
+				clear_devices_complete, adapter, NULL) > 0) {
+		g_slist_free_full(adapter->connect_applied, g_free);
+		adapter->connect_applied = NULL;
 		return 0;
+	}
 
 	btd_error(adapter->dev_id, "Failed to clear devices for index %u",
 							adapter->dev_id);
@@ -9436,7 +10255,7 @@ static void read_info_complete(uint8_t status, uint16_t length,
 
 	set_dev_class(adapter);
 
-	set_name(adapter, btd_adapter_get_name(adapter));
+	set_name(adapter, btd_adapter_get_name(adapter), true);
 
 	if (btd_has_kernel_features(KERNEL_BLOCKED_KEYS_SUPPORTED) &&
 	    !set_blocked_keys(adapter)) {
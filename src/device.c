@@ -81,6 +81,19 @@
 static DBusConnection *dbus_conn = NULL;
 static unsigned service_state_cb_id;
 
+/*
+ * Databases restored from the cache are shared by the devices exposing the
+ * same attribute table, e.g. many units of the same product, until one of
+ * them needs to modify its copy.
+ */
+struct shared_db {
+	uint8_t hash[16];
+	struct gatt_db *db;
+	unsigned int users;
+};
+
+static GSList *shared_dbs;
+
 struct btd_disconnect_data {
 	guint id;
 	disconnect_watch watch;
@@ -216,6 +229,7 @@ struct btd_device {
 	GSList		*primaries;		/* List of primary services */
 	GSList		*services;		/* List of btd_service */
 	GSList		*pending;		/* Pending services */
+	gint64		connect_start;		/* Pending services since */
 	GSList		*watches;		/* List of disconnect_data */
 	bool		temporary;
 	bool		connectable;
@@ -241,6 +255,8 @@ struct btd_device {
 	 */
 	struct gatt_db *db;			/* GATT db cache */
 	unsigned int db_id;
+	struct shared_db *shared_db;		/* Set while db is shared */
+	struct gatt_db *split_db;		/* Shared db before split */
 	struct bt_gatt_client *client;		/* GATT client instance */
 	struct bt_gatt_server *server;		/* GATT server instance */
 	unsigned int gatt_ready_id;
@@ -282,6 +298,10 @@ static const uint16_t uuid_list[] = {
 
 static int device_browse_gatt(struct btd_device *device, DBusMessage *msg);
 static int device_browse_sdp(struct btd_device *device, DBusMessage *msg);
+static void gatt_service_added(struct gatt_db_attribute *attr,
+							void *user_data);
+static void gatt_service_removed(struct gatt_db_attribute *attr,
+							void *user_data);
 
 static struct bearer_state *get_state(struct btd_device *dev,
 							uint8_t bdaddr_type)
@@ -564,11 +584,112 @@ static bool gatt_cache_is_enabled(struct btd_device *device)
 	}
 }
 
+static void shared_db_release(struct btd_device *device)
+{
+	struct shared_db *shared = device->shared_db;
+
+	if (!shared)
+		return;
+
+	device->shared_db = NULL;
+
+	if (--shared->users)
+		return;
+
+	shared_dbs = g_slist_remove(shared_dbs, shared);
+	gatt_db_unref(shared->db);
+	g_free(shared);
+}
+
+static void device_set_db(struct btd_device *device, struct gatt_db *db)
+{
+	gatt_db_unregister(device->db, device->db_id);
+	gatt_db_unref(device->db);
+
+	device->db = gatt_db_ref(db);
+	device->db_id = gatt_db_register(device->db, gatt_service_added,
+					gatt_service_removed, device, NULL);
+
+	btd_gatt_client_set_db(device->client_dbus, device->db);
+}
+
+/* Replaces the database just restored from the cache by a shared one */
+static void share_gatt_db(struct btd_device *device)
+{
+	struct shared_db *shared = NULL;
+	const uint8_t *hash;
+	GSList *l;
+
+	hash = gatt_db_get_hash(device->db);
+	if (!hash || gatt_db_isempty(device->db))
+		return;
+
+	for (l = shared_dbs; l; l = g_slist_next(l)) {
+		shared = l->data;
+
+		if (!memcmp(shared->hash, hash, sizeof(shared->hash)) &&
+					gatt_db_equal(shared->db, device->db))
+			break;
+	}
+
+	if (l) {
+		device_set_db(device, shared->db);
+	} else {
+		shared = g_new0(struct shared_db, 1);
+		memcpy(shared->hash, hash, sizeof(shared->hash));
+		shared->db = gatt_db_ref(device->db);
+		shared_dbs = g_slist_prepend(shared_dbs, shared);
+	}
+
+	shared->users++;
+	device->shared_db = shared;
+
+	DBG("%s: gatt db shared by %u device(s)", device->path, shared->users);
+}
+
+/*
+ * Gives the device a database of its own before it is modified, the last
+ * user simply takes over the shared one. The old database is kept around
+ * since services and profiles may still reference its attributes.
+ */
+static struct gatt_db *split_gatt_db(struct gatt_db *db, void *user_data)
+{
+	struct btd_device *device = user_data;
+	struct gatt_db *clone;
+
+	if (!device->shared_db || device->db != db)
+		return device->db;
+
+	if (device->shared_db->users == 1) {
+		shared_db_release(device);
+		return device->db;
+	}
+
+	clone = gatt_db_clone(device->db);
+	if (!clone) {
+		error("Unable to split gatt db of %s", device->path);
+		return device->db;
+	}
+
+	DBG("%s: gatt db split", device->path);
+
+	shared_db_release(device);
+
+	gatt_db_unref(device->split_db);
+	device->split_db = gatt_db_ref(device->db);
+
+	device_set_db(device, clone);
+	gatt_db_unref(clone);
+
+	return device->db;
+}
+
 static void gatt_cache_cleanup(struct btd_device *device)
 {
 	if (gatt_cache_is_enabled(device))
 		return;
 
+	split_gatt_db(device->db, device);
 	gatt_db_clear(device->db);
 }
 
@@ -579,6 +700,7 @@ static void gatt_client_cleanup(struct btd_device *device)
 
 	gatt_cache_cleanup(device);
 	bt_gatt_client_set_service_changed(device->client, NULL, NULL, NULL);
+	bt_gatt_client_set_db_split(device->client, NULL, NULL, NULL);
 
 	if (device->gatt_ready_id > 0) {
 		bt_gatt_client_ready_unregister(device->client,
@@ -673,7 +795,9 @@ static void device_free(gpointer user_data)
 
 	attio_cleanup(device);
 
+	shared_db_release(device);
 	gatt_db_unref(device->db);
+	gatt_db_unref(device->split_db);
 
 	bt_ad_unref(device->ad);
 
@@ -1612,6 +1736,7 @@ void device_request_disconnect(struct btd_device *device, DBusMessage *msg)
 
 	g_slist_free(device->pending);
 	device->pending = NULL;
+	device->connect_start = 0;
 
 	while (device->watches) {
 		struct btd_disconnect_data *data = device->watches->data;
@@ -1704,11 +1829,79 @@ static DBusMessage *dev_disconnect(DBusConnection *conn, DBusMessage *msg,
 	return NULL;
 }
 
+static bool service_waits_for(struct btd_device *dev,
+					struct btd_service *service)
+{
+	struct btd_profile *p = btd_service_get_profile(service);
+	const char * const *uuid;
+	GSList *l;
+
+	if (!p->after_services)
+		return false;
+
+	for (l = dev->pending; l; l = g_slist_next(l)) {
+		struct btd_profile *other = btd_service_get_profile(l->data);
+
+		if (!other->remote_uuid)
+			continue;
+
+		for (uuid = p->after_services; *uuid; uuid++) {
+			if (!strcasecmp(*uuid, other->remote_uuid))
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/* Connects every pending service whose dependencies are done, services
+ * already connecting stay in the list until device_profile_connected.
+ */
+static int connect_parallel(struct btd_device *dev)
+{
+	GSList *l, *next;
+	bool busy;
+	int err;
+
+again:
+	busy = false;
+	err = -ENOENT;
+
+	for (l = dev->pending; l; l = next) {
+		struct btd_service *service = l->data;
+
+		next = g_slist_next(l);
+
+		if (service_waits_for(dev, service)) {
+			busy = true;
+			continue;
+		}
+
+		err = btd_service_connect(service);
+		if (!err) {
+			busy = true;
+			continue;
+		}
+
+		dev->pending = g_slist_delete_link(dev->pending, l);
+
+		/* Services waiting for this one may be able to start now */
+		if (busy)
+			goto again;
+	}
+
+	return busy ? 0 : err;
+}
+
 static int connect_next(struct btd_device *dev)
 {
 	struct btd_service *service;
 	int err = -ENOENT;
 
+	/* The first profile brings the link up, the others follow at once */
+	if (main_opts.parallel_connect && btd_device_is_connected(dev))
+		return connect_parallel(dev);
+
 	while (dev->pending) {
 		service = dev->pending->data;
 
@@ -1753,9 +1946,12 @@ static void device_profile_connected(struct btd_device *dev,
 
 	/* Only continue connecting the next profile if it matches the first
 	 * pending, otherwise it will trigger another connect to the same
-	 * profile
+	 * profile. In parallel mode any pending profile may complete first.
 	 */
-	if (profile != btd_service_get_profile(pending))
+	if (main_opts.parallel_connect && btd_device_is_connected(dev)) {
+		if (l == NULL)
+			return;
+	} else if (profile != btd_service_get_profile(pending))
 		return;
 
 	if (connect_next(dev) == 0)
@@ -1765,6 +1961,13 @@ done:
 	g_slist_free(dev->pending);
 	dev->pending = NULL;
 
+	if (dev->connect_start) {
+		DBG("%s services ready in %lld ms", dev->path,
+			(long long) (g_get_monotonic_time() -
+						dev->connect_start) / 1000);
+		dev->connect_start = 0;
+	}
+
 	if (!dev->connect)
 		return;
 
@@ -1977,6 +2180,8 @@ int btd_device_connect_services(struct btd_device *dev, GSList *services)
 		dev->pending = create_pending_list(dev, NULL);
 	}
 
+	dev->connect_start = g_get_monotonic_time();
+
 	return connect_next(dev);
 }
 
@@ -2015,6 +2220,8 @@ static DBusMessage *connect_profiles(struct btd_device *dev, uint8_t bdaddr_type
 		goto resolve_services;
 	}
 
+	dev->connect_start = g_get_monotonic_time();
+
 	err = connect_next(dev);
 	if (err < 0) {
 		if (err == -EALREADY)
@@ -3764,6 +3971,8 @@ static void load_gatt_db(struct btd_device *device, const char *local,
 
 	if (load_gatt_db_impl(key_file, keys, device->db))
 		warn("Unable to load gatt db from file for %s", peer);
+	else
+		share_gatt_db(device);
 
 	g_strfreev(keys);
 	g_key_file_free(key_file);
@@ -3814,7 +4023,6 @@ static void add_gatt_service(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct btd_device *device = user_data;
 	struct btd_service *service;
-	struct btd_profile *profile;
 	bt_uuid_t uuid;
 	char uuid_str[MAX_LEN_UUID_STR];
 	GSList *l;
@@ -3840,18 +4048,39 @@ done:
 	gatt_db_service_set_active(attr, true);
 
 	service = l->data;
-	profile = btd_service_get_profile(service);
-
-	/* Claim attributes of internal profiles */
-	if (!profile->external) {
-		/* Mark the service as claimed by the existing profile. */
-		gatt_db_service_set_claimed(attr, true);
-	}
 
 	/* Notify driver about the new connection */
 	service_accept(service);
 }
 
+/*
+ * Attributes of internal profiles are claimed by the profile. This is not
+ * stored in the db since it may be shared with devices that do not have the
+ * profile probed.
+ */
+bool btd_device_gatt_service_claimed(struct btd_device *device,
+					struct gatt_db_attribute *attr)
+{
+	struct btd_profile *profile;
+	bt_uuid_t uuid;
+	char uuid_str[MAX_LEN_UUID_STR];
+	GSList *l;
+
+	if (!device || !attr)
+		return false;
+
+	gatt_db_attribute_get_service_uuid(attr, &uuid);
+	bt_uuid_to_string(&uuid, uuid_str, sizeof(uuid_str));
+
+	l = find_service_with_uuid(device->services, uuid_str);
+	if (!l)
+		return false;
+
+	profile = btd_service_get_profile(l->data);
+
+	return !profile->external;
+}
+
 static void device_add_gatt_services(struct btd_device *device)
 {
 	char addr[18];
@@ -4470,6 +4699,7 @@ void device_remove(struct btd_device *device, gboolean remove_stored)
 
 	g_slist_free(device->pending);
 	device->pending = NULL;
+	device->connect_start = 0;
 
 	if (btd_device_is_connected(device)) {
 		if (device->disconn_timer > 0)
@@ -5181,6 +5411,10 @@ static void gatt_client_init(struct btd_device *device)
 
 	bt_gatt_client_set_debug(device->client, gatt_debug, NULL, NULL);
 
+	if (device->shared_db)
+		bt_gatt_client_set_db_split(device->client, split_gatt_db,
+								device, NULL);
+
 	/*
 	 * Notify notify existing service about the new connection so they can
 	 * react to notifications while discovering services
@@ -12,6 +12,7 @@
 #define DEVICE_INTERFACE	"org.bluez.Device1"
 
 struct btd_device;
+struct gatt_db_attribute;
 
 struct btd_device *device_create(struct btd_adapter *adapter,
 				const bdaddr_t *address, uint8_t bdaddr_type);
@@ -61,6 +62,8 @@ struct gatt_primary *btd_device_get_primary(struct btd_device *device,
 GSList *btd_device_get_primaries(struct btd_device *device);
 struct gatt_db *btd_device_get_gatt_db(struct btd_device *device);
 struct bt_gatt_client *btd_device_get_gatt_client(struct btd_device *device);
+bool btd_device_gatt_service_claimed(struct btd_device *device,
+					struct gatt_db_attribute *attr);
 struct bt_gatt_server *btd_device_get_gatt_server(struct btd_device *device);
 void *btd_device_get_attrib(struct btd_device *device);
 void btd_device_gatt_set_service_changed(struct btd_device *device,
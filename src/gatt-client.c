@@ -18,6 +18,7 @@
 #include <errno.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <sys/uio.h>
 
 #include <dbus/dbus.h>
 
@@ -102,6 +103,7 @@ struct characteristic {
 	uint16_t ext_props_handle;
 	bt_uuid_t uuid;
 	char *path;
+	struct iovec *value;
 
 	unsigned int ready_id;
 	struct sock_io *write_io;
@@ -122,6 +124,7 @@ struct descriptor {
 	uint16_t handle;
 	bt_uuid_t uuid;
 	char *path;
+	struct iovec *value;
 
 	struct async_dbus_op *read_op;
 	struct async_dbus_op *write_op;
@@ -161,6 +164,64 @@ static gboolean descriptor_get_characteristic(
 	return TRUE;
 }
 
+/*
+ * Values read from or notified by the remote are stored with the object
+ * instead of in the attribute since the database may be shared by other
+ * devices with the same attribute table.
+ */
+static bool cache_value(struct iovec **cache, uint16_t offset,
+					const uint8_t *value, uint16_t length)
+{
+	struct iovec *iov = *cache;
+	size_t len = offset + length;
+
+	if (!iov)
+		iov = *cache = new0(struct iovec, 1);
+
+	if (!offset)
+		iov->iov_len = 0;
+
+	if (iov->iov_len < len) {
+		uint8_t *buf;
+
+		buf = realloc(iov->iov_base, len);
+		if (!buf)
+			return false;
+
+		memset(buf + iov->iov_len, 0, len - iov->iov_len);
+		iov->iov_base = buf;
+		iov->iov_len = len;
+	}
+
+	if (length)
+		memcpy(iov->iov_base + offset, value, length);
+
+	return true;
+}
+
+static void free_value(struct iovec *iov)
+{
+	if (!iov)
+		return;
+
+	free(iov->iov_base);
+	free(iov);
+}
+
+static void read_cached_value(struct gatt_db_attribute *attr,
+				struct iovec *cache,
+				gatt_db_attribute_read_t func, void *user_data)
+{
+	/* Fallback to the value stored in the db, e.g. the Database Hash */
+	if (!cache) {
+		gatt_db_attribute_read(attr, 0, 0, NULL, func, user_data);
+		return;
+	}
+
+	func(attr, 0, cache->iov_len ? cache->iov_base : NULL, cache->iov_len,
+								user_data);
+}
+
 static void read_cb(struct gatt_db_attribute *attrib, int err,
 				const uint8_t *value, size_t length,
 				void *user_data)
@@ -182,7 +243,7 @@ static gboolean descriptor_get_value(const GDBusPropertyTable *property,
 
 	dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, "y", &array);
 
-	gatt_db_attribute_read(desc->attr, 0, 0, NULL, read_cb, &array);
+	read_cached_value(desc->attr, desc->value, read_cb, &array);
 
 	dbus_message_iter_close_container(iter, &array);
 
@@ -209,7 +270,7 @@ static gboolean descriptor_value_exists(const GDBusPropertyTable *property,
 	struct descriptor *desc = data;
 	gboolean ret;
 
-	gatt_db_attribute_read(desc->attr, 0, 0, NULL, read_check_cb, &ret);
+	read_cached_value(desc->attr, desc->value, read_check_cb, &ret);
 
 	return ret;
 }
@@ -357,22 +418,16 @@ static void desc_read_cb(bool success, uint8_t att_ecode,
 	if (!success)
 		goto fail;
 
-	if (!op->offset)
-		gatt_db_attribute_reset(desc->attr);
-
-	if (!gatt_db_attribute_write(desc->attr, op->offset, value, length, 0,
-					NULL, write_descriptor_cb, desc)) {
+	if (!cache_value(&desc->value, op->offset, value, length)) {
 		error("Failed to store attribute");
 		att_ecode = BT_ATT_ERROR_UNLIKELY;
 		goto fail;
 	}
 
-	/* Read the stored data from db */
-	if (!gatt_db_attribute_read(desc->attr, 0, 0, NULL, read_op_cb, op)) {
-		error("Failed to read database");
-		att_ecode = BT_ATT_ERROR_UNLIKELY;
-		goto fail;
-	}
+	write_descriptor_cb(desc->attr, 0, desc);
+
+	/* Reply with the whole value stored so far */
+	read_cached_value(desc->attr, desc->value, read_op_cb, op);
 
 	desc->read_op = NULL;
 
@@ -654,6 +709,7 @@ static void descriptor_free(void *data)
 {
 	struct descriptor *desc = data;
 
+	free_value(desc->value);
 	g_free(desc->path);
 	free(desc);
 }
@@ -743,7 +799,7 @@ static gboolean characteristic_get_value(const GDBusPropertyTable *property,
 
 	dbus_message_iter_open_container(iter, DBUS_TYPE_ARRAY, "y", &array);
 
-	gatt_db_attribute_read(chrc->attr, 0, 0, NULL, read_cb, &array);
+	read_cached_value(chrc->attr, chrc->value, read_cb, &array);
 
 	dbus_message_iter_close_container(iter, &array);
 
@@ -756,7 +812,7 @@ static gboolean characteristic_value_exists(const GDBusPropertyTable *property,
 	struct characteristic *chrc = data;
 	gboolean ret;
 
-	gatt_db_attribute_read(chrc->attr, 0, 0, NULL, read_check_cb, &ret);
+	read_cached_value(chrc->attr, chrc->value, read_check_cb, &ret);
 
 	return ret;
 }
@@ -895,22 +951,16 @@ static void chrc_read_cb(bool success, uint8_t att_ecode, const uint8_t *value,
 	if (!success)
 		goto fail;
 
-	if (!op->offset)
-		gatt_db_attribute_reset(chrc->attr);
-
-	if (!gatt_db_attribute_write(chrc->attr, op->offset, value, length, 0,
-					NULL, write_characteristic_cb, chrc)) {
+	if (!cache_value(&chrc->value, op->offset, value, length)) {
 		error("Failed to store attribute");
 		att_ecode = BT_ATT_ERROR_UNLIKELY;
 		goto fail;
 	}
 
-	/* Read the stored data from db */
-	if (!gatt_db_attribute_read(chrc->attr, 0, 0, NULL, read_op_cb, op)) {
-		error("Failed to read database");
-		att_ecode = BT_ATT_ERROR_UNLIKELY;
-		goto fail;
-	}
+	write_characteristic_cb(chrc->attr, 0, chrc);
+
+	/* Reply with the whole value stored so far */
+	read_cached_value(chrc->attr, chrc->value, read_op_cb, op);
 
 	chrc->read_op = NULL;
 
@@ -1383,9 +1433,8 @@ static void notify_cb(uint16_t value_handle, const uint8_t *value,
 	 * signal so that we propagate the notification/indication to
 	 * applications.
 	 */
-	gatt_db_attribute_reset(chrc->attr);
-	gatt_db_attribute_write(chrc->attr, 0, value, length, 0, NULL,
-						write_characteristic_cb, chrc);
+	if (cache_value(&chrc->value, 0, value, length))
+		write_characteristic_cb(chrc->attr, 0, chrc);
 }
 
 static void create_notify_reply(struct async_dbus_op *op, bool success,
@@ -1701,6 +1750,7 @@ static void characteristic_free(void *data)
 
 	queue_destroy(chrc->notify_clients, remove_client);
 
+	free_value(chrc->value);
 	g_free(chrc->path);
 	free(chrc);
 }
@@ -1892,9 +1942,6 @@ static struct service *service_create(struct gatt_db_attribute *attr,
 	/* Set service active so we can skip discovering next time */
 	gatt_db_service_set_active(attr, true);
 
-	/* Mark the service as claimed since it going to be exported */
-	gatt_db_service_set_claimed(attr, true);
-
 	return service;
 }
 
@@ -2001,12 +2048,32 @@ static bool create_characteristics(struct gatt_db_attribute *attr,
 	return !data.failed;
 }
 
+static bool match_service_handle(const void *a, const void *b)
+{
+	const struct service *service = a;
+	uint16_t start_handle = PTR_TO_UINT(b);
+
+	return service->start_handle == start_handle;
+}
+
 static void export_service(struct gatt_db_attribute *attr, void *user_data)
 {
 	struct btd_gatt_client *client = user_data;
 	struct service *service;
+	uint16_t start_handle;
+
+	/*
+	 * Skip services already exported by this client or claimed by a
+	 * profile of the device, the db may be shared with other devices so
+	 * this is not recorded in it.
+	 */
+	gatt_db_attribute_get_service_handles(attr, &start_handle, NULL);
+
+	if (queue_find(client->services, match_service_handle,
+						UINT_TO_PTR(start_handle)))
+		return;
 
-	if (gatt_db_service_get_claimed(attr))
+	if (btd_device_gatt_service_claimed(client->device, attr))
 		return;
 
 	service = service_create(attr, client);
@@ -2022,14 +2089,6 @@ static void export_service(struct gatt_db_attribute *attr, void *user_data)
 	queue_push_tail(client->services, service);
 }
 
-static bool match_service_handle(const void *a, const void *b)
-{
-	const struct service *service = a;
-	uint16_t start_handle = PTR_TO_UINT(b);
-
-	return service->start_handle == start_handle;
-}
-
 struct update_incl_data {
 	struct service *service;
 	bool changed;
@@ -2126,6 +2185,73 @@ void btd_gatt_client_destroy(struct btd_gatt_client *client)
 	free(client);
 }
 
+static void rebind_desc(void *data, void *user_data)
+{
+	struct descriptor *desc = data;
+	struct gatt_db *db = user_data;
+
+	desc->attr = gatt_db_get_attribute(db, desc->handle);
+}
+
+static void rebind_chrc(void *data, void *user_data)
+{
+	struct characteristic *chrc = data;
+	struct gatt_db *db = user_data;
+
+	chrc->attr = gatt_db_get_attribute(db, chrc->value_handle);
+
+	queue_foreach(chrc->descs, rebind_desc, db);
+}
+
+static void rebind_service(void *data, void *user_data)
+{
+	struct service *service = data;
+
+	queue_foreach(service->chrcs, rebind_chrc, user_data);
+}
+
+static bool match_desc_unbound(const void *a, const void *b)
+{
+	const struct descriptor *desc = a;
+
+	return !desc->attr;
+}
+
+static bool match_chrc_unbound(const void *a, const void *b)
+{
+	const struct characteristic *chrc = a;
+
+	return !chrc->attr || queue_find(chrc->descs, match_desc_unbound, NULL);
+}
+
+static bool match_service_unbound(const void *a, const void *b)
+{
+	const struct service *service = a;
+
+	return queue_find(service->chrcs, match_chrc_unbound, NULL);
+}
+
+/*
+ * Moves the exported objects to the database the device now uses, e.g. a
+ * private copy of a shared one, so they follow the changes made to it. The
+ * attributes are looked up again by handle.
+ */
+void btd_gatt_client_set_db(struct btd_gatt_client *client,
+						struct gatt_db *db)
+{
+	if (!client || !db || client->db == db)
+		return;
+
+	gatt_db_unref(client->db);
+	client->db = gatt_db_ref(db);
+
+	queue_foreach(client->services, rebind_service, db);
+
+	/* Objects left without an attribute cannot be used anymore */
+	queue_remove_all(client->services, match_service_unbound, NULL,
+							unregister_service);
+}
+
 static void register_notify(void *data, void *user_data)
 {
 	struct notify_client *notify_client = data;
@@ -12,6 +12,8 @@ struct btd_gatt_client;
 
 struct btd_gatt_client *btd_gatt_client_new(struct btd_device *device);
 void btd_gatt_client_destroy(struct btd_gatt_client *client);
+void btd_gatt_client_set_db(struct btd_gatt_client *client,
+						struct gatt_db *db);
 
 void btd_gatt_client_ready(struct btd_gatt_client *client);
 void btd_gatt_client_connected(struct btd_gatt_client *client);
@@ -50,6 +50,13 @@
 #define UUID_GATT	0x1801
 #define UUID_DIS	0x180a
 
+/* Operations forwarded to applications waiting for a reply */
+#define APP_MAX_IN_FLIGHT	32
+#define CONN_MAX_IN_FLIGHT	8
+
+/* Write commands are dropped once this many operations are waiting */
+#define CONN_MAX_BACKLOG	64
+
 #ifndef MIN
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
 #endif
@@ -77,6 +84,16 @@ struct btd_gatt_database {
 	struct gatt_db_attribute *eatt;
 	struct queue *apps;
 	struct queue *profiles;
+	struct queue *conns;
+	guint dispatch_id;
+};
+
+struct op_stats {
+	unsigned int sent;
+	unsigned int queued;
+	unsigned int dropped;
+	unsigned int max_backlog;
+	uint64_t busy;			/* Time spent in flight (usec) */
 };
 
 struct gatt_app {
@@ -89,6 +106,24 @@ struct gatt_app {
 	struct queue *profiles;
 	struct queue *services;
 	struct queue *proxies;
+	struct queue *ops;		/* Operations in flight */
+	struct op_stats stats;
+};
+
+/*
+ * Operations forwarded to applications on behalf of a connected device. The
+ * ones exceeding the in-flight limits of the device or of the application
+ * wait in the backlog, which is serviced in round-robin order with the
+ * backlogs of the other connections.
+ */
+struct gatt_conn {
+	struct btd_gatt_database *database;
+	struct btd_device *device;
+	struct bt_att *att;
+	unsigned int disc_id;
+	struct queue *ops;		/* Operations in flight */
+	struct queue *backlog;
+	struct op_stats stats;
 };
 
 struct external_service {
@@ -150,6 +185,15 @@ struct pending_op {
 	struct iovec data;
 	bool is_characteristic;
 	bool prep_authorize;
+	bool is_read;
+	bool own_data;
+	struct gatt_app *app;
+	struct gatt_conn *conn;
+	GDBusProxy *proxy;
+	const char *method;
+	GDBusSetupFunction setup;
+	GDBusReturnFunction reply;
+	int64_t sent;
 };
 
 struct notify {
@@ -445,6 +489,293 @@ static void cancel_pending_write(void *data)
 	op->owner_queue = NULL;
 }
 
+static void op_stats_log(const char *name, const struct op_stats *stats)
+{
+	if (!stats->sent && !stats->queued)
+		return;
+
+	DBG("%s: %u sent %u queued %u dropped, backlog peak %u, %u ms busy",
+			name, stats->sent, stats->queued, stats->dropped,
+			stats->max_backlog,
+			(unsigned int) (stats->busy / 1000));
+}
+
+static gboolean dispatch_ops(gpointer user_data);
+
+static void schedule_dispatch(struct btd_gatt_database *database)
+{
+	if (!database->dispatch_id)
+		database->dispatch_id = g_idle_add(dispatch_ops, database);
+}
+
+/* Releases the room taken by an operation that got a reply */
+static void op_done(struct pending_op *op)
+{
+	int64_t busy;
+
+	if (!op->sent)
+		return;
+
+	busy = g_get_monotonic_time() - op->sent;
+
+	if (op->app) {
+		queue_remove(op->app->ops, op);
+		op->app->stats.busy += busy;
+		schedule_dispatch(op->app->database);
+	}
+
+	if (op->conn) {
+		queue_remove(op->conn->ops, op);
+		op->conn->stats.busy += busy;
+		schedule_dispatch(op->conn->database);
+	}
+}
+
+static void pending_op_free(void *data)
+{
+	struct pending_op *op = data;
+
+	if (op->owner_queue)
+		queue_remove(op->owner_queue, op);
+
+	op_done(op);
+
+	if (op->own_data)
+		free(op->data.iov_base);
+
+	free(op);
+}
+
+/* Completes an operation that was never sent to the application */
+static void op_cancel(void *data)
+{
+	struct pending_op *op = data;
+	struct queue *owner_queue = op->owner_queue;
+
+	/* Write commands were already completed when submitted */
+	if (owner_queue) {
+		queue_remove(owner_queue, op);
+
+		if (op->is_read)
+			cancel_pending_read(op);
+		else
+			cancel_pending_write(op);
+	}
+
+	pending_op_free(op);
+}
+
+static void op_detach_app(void *data)
+{
+	struct pending_op *op = data;
+
+	op->app = NULL;
+}
+
+static void op_detach_conn(void *data)
+{
+	struct pending_op *op = data;
+
+	op->conn = NULL;
+}
+
+static void conn_free(void *data)
+{
+	struct gatt_conn *conn = data;
+
+	op_stats_log(device_get_path(conn->device), &conn->stats);
+
+	queue_destroy(conn->backlog, op_cancel);
+	queue_destroy(conn->ops, op_detach_conn);
+
+	bt_att_unregister_disconnect(conn->att, conn->disc_id);
+	bt_att_unref(conn->att);
+
+	free(conn);
+}
+
+static void conn_disconnected(int err, void *user_data)
+{
+	struct gatt_conn *conn = user_data;
+
+	conn->disc_id = 0;
+
+	queue_remove(conn->database->conns, conn);
+	conn_free(conn);
+}
+
+static bool match_conn_device(const void *a, const void *b)
+{
+	const struct gatt_conn *conn = a;
+
+	return conn->device == b;
+}
+
+static struct gatt_conn *get_conn(struct btd_gatt_database *database,
+						struct btd_device *device)
+{
+	struct gatt_conn *conn;
+	struct bt_att *att;
+
+	conn = queue_find(database->conns, match_conn_device, device);
+	if (conn)
+		return conn;
+
+	att = bt_gatt_server_get_att(btd_device_get_gatt_server(device));
+	if (!att)
+		return NULL;
+
+	conn = new0(struct gatt_conn, 1);
+	conn->database = database;
+	conn->device = device;
+	conn->att = bt_att_ref(att);
+	conn->disc_id = bt_att_register_disconnect(att, conn_disconnected,
+								conn, NULL);
+	conn->ops = queue_new();
+	conn->backlog = queue_new();
+
+	queue_push_tail(database->conns, conn);
+
+	return conn;
+}
+
+static bool op_has_room(struct pending_op *op)
+{
+	if (op->conn && queue_length(op->conn->ops) >= CONN_MAX_IN_FLIGHT)
+		return false;
+
+	return !op->app || queue_length(op->app->ops) < APP_MAX_IN_FLIGHT;
+}
+
+static bool op_send(struct pending_op *op)
+{
+	if (!g_dbus_proxy_method_call(op->proxy, op->method, op->setup,
+					op->reply, op, pending_op_free))
+		return false;
+
+	/* Without a connection there is nothing to account for */
+	if (!op->conn)
+		return true;
+
+	op->sent = g_get_monotonic_time();
+
+	queue_push_tail(op->conn->ops, op);
+	queue_push_tail(op->app->ops, op);
+	op->conn->stats.sent++;
+	op->app->stats.sent++;
+
+	return true;
+}
+
+/* Sends one waiting operation per connection per round */
+static gboolean dispatch_ops(gpointer user_data)
+{
+	struct btd_gatt_database *database = user_data;
+	unsigned int i, count;
+	bool progress;
+
+	database->dispatch_id = 0;
+
+	do {
+		progress = false;
+		count = queue_length(database->conns);
+
+		for (i = 0; i < count; i++) {
+			struct gatt_conn *conn;
+			struct pending_op *op;
+
+			conn = queue_pop_head(database->conns);
+			queue_push_tail(database->conns, conn);
+
+			op = queue_peek_head(conn->backlog);
+			if (!op || !op_has_room(op))
+				continue;
+
+			queue_pop_head(conn->backlog);
+
+			if (!op_send(op))
+				op_cancel(op);
+
+			progress = true;
+		}
+	} while (progress);
+
+	return FALSE;
+}
+
+static bool op_backlog(struct pending_op *op)
+{
+	struct gatt_conn *conn = op->conn;
+	unsigned int len = queue_length(conn->backlog);
+	void *value;
+
+	if (!op->owner_queue && len >= CONN_MAX_BACKLOG) {
+		conn->stats.dropped++;
+		op->app->stats.dropped++;
+		pending_op_free(op);
+		return true;
+	}
+
+	/* The value is only valid until the attribute callback returns */
+	if (op->data.iov_len) {
+		value = malloc(op->data.iov_len);
+		if (!value)
+			return false;
+
+		memcpy(value, op->data.iov_base, op->data.iov_len);
+		op->data.iov_base = value;
+		op->own_data = true;
+	}
+
+	queue_push_tail(conn->backlog, op);
+
+	conn->stats.queued++;
+	op->app->stats.queued++;
+	conn->stats.max_backlog = MAX(conn->stats.max_backlog, len + 1);
+	op->app->stats.max_backlog = MAX(op->app->stats.max_backlog, len + 1);
+
+	return true;
+}
+
+/*
+ * Sends the operation right away if there is room for it, otherwise it waits
+ * in the connection backlog. Write commands have no response so they are
+ * completed here, and dropped if the peer keeps sending them faster than the
+ * application takes them.
+ */
+static bool op_submit(struct pending_op *op)
+{
+	struct gatt_conn *conn = op->conn;
+	struct gatt_db_attribute *attrib = op->attrib;
+	unsigned int id = op->id;
+	bool cmd = !op->owner_queue && !op->is_read;
+
+	if (!conn || (queue_isempty(conn->backlog) && op_has_room(op))) {
+		if (!op_send(op))
+			return false;
+	} else if (!op_backlog(op))
+		return false;
+
+	if (cmd)
+		gatt_db_attribute_write_result(attrib, id, 0);
+
+	return true;
+}
+
+static bool match_op_attrib(const void *a, const void *b)
+{
+	const struct pending_op *op = a;
+
+	return op->attrib == b;
+}
+
+static void cancel_backlog(void *data, void *user_data)
+{
+	struct gatt_conn *conn = data;
+
+	queue_remove_all(conn->backlog, match_op_attrib, user_data, op_cancel);
+}
+
 static void chrc_free(void *data)
 {
 	struct external_chrc *chrc = data;
@@ -452,6 +783,8 @@ static void chrc_free(void *data)
 	io_destroy(chrc->write_io);
 	io_destroy(chrc->notify_io);
 
+	queue_foreach(chrc->service->app->database->conns, cancel_backlog,
+							chrc->attrib);
 	queue_destroy(chrc->pending_reads, cancel_pending_read);
 	queue_destroy(chrc->pending_writes, cancel_pending_write);
 
@@ -467,6 +800,8 @@ static void desc_free(void *data)
 {
 	struct external_desc *desc = data;
 
+	queue_foreach(desc->service->app->database->conns, cancel_backlog,
+							desc->attrib);
 	queue_destroy(desc->pending_reads, cancel_pending_read);
 	queue_destroy(desc->pending_writes, cancel_pending_write);
 
@@ -543,9 +878,13 @@ static void app_free(void *data)
 {
 	struct gatt_app *app = data;
 
+	if (app->path)
+		op_stats_log(app->path, &app->stats);
+
 	queue_destroy(app->profiles, profile_free);
 	queue_destroy(app->services, service_free);
 	queue_destroy(app->proxies, NULL);
+	queue_destroy(app->ops, op_detach_app);
 
 	if (app->client) {
 		g_dbus_client_set_disconnect_watch(app->client, NULL, NULL);
@@ -599,9 +938,13 @@ static void gatt_database_free(void *data)
 	queue_destroy(database->apps, app_free);
 	queue_destroy(database->profiles, profile_free);
 	queue_destroy(database->ccc_callbacks, ccc_cb_free);
+	queue_destroy(database->conns, conn_free);
 	database->device_states = NULL;
 	database->ccc_callbacks = NULL;
 
+	if (database->dispatch_id)
+		g_source_remove(database->dispatch_id);
+
 	gatt_db_unref(database->db);
 
 	btd_adapter_unref(database->adapter);
@@ -824,7 +1167,7 @@ static void populate_gap_service(struct btd_gatt_database *database)
 
 	/* Add the GAP service */
 	bt_uuid16_create(&uuid, UUID_GAP);
-	service = gatt_db_add_service(database->db, &uuid, true, 5);
+	service = gatt_db_add_static_service(database->db, &uuid, true, 5);
 
 	/*
 	 * Device Name characteristic.
@@ -943,16 +1286,6 @@ static struct pending_op *pending_ccc_new(struct bt_att *att,
 	return op;
 }
 
-static void pending_op_free(void *data)
-{
-	struct pending_op *op = data;
-
-	if (op->owner_queue)
-		queue_remove(op->owner_queue, op);
-
-	free(op);
-}
-
 static void gatt_ccc_write_cb(struct gatt_db_attribute *attrib,
 					unsigned int id, uint16_t offset,
 					const uint8_t *value, size_t len,
@@ -1185,7 +1518,7 @@ static void populate_gatt_service(struct btd_gatt_database *database)
 
 	/* Add the GATT service */
 	bt_uuid16_create(&uuid, UUID_GATT);
-	service = gatt_db_add_service(database->db, &uuid, true, 10);
+	service = gatt_db_add_static_service(database->db, &uuid, true, 10);
 
 	bt_uuid16_create(&uuid, GATT_CHARAC_SERVICE_CHANGED);
 	database->svc_chngd = gatt_db_service_add_characteristic(service, &uuid,
@@ -1246,7 +1579,7 @@ static void populate_devinfo_service(struct btd_gatt_database *database)
 	bt_uuid_t uuid;
 
 	bt_uuid16_create(&uuid, UUID_DIS);
-	service = gatt_db_add_service(database->db, &uuid, true, 3);
+	service = gatt_db_add_static_service(database->db, &uuid, true, 3);
 
 	if (main_opts.did_source > 0) {
 		bt_uuid16_create(&uuid, GATT_CHARAC_PNP_ID);
@@ -2220,7 +2553,7 @@ static void read_setup_cb(DBusMessageIter *iter, void *user_data)
 	dbus_message_iter_close_container(iter, &dict);
 }
 
-static struct pending_op *send_read(struct btd_device *device,
+static bool send_read(struct gatt_app *app, struct btd_device *device,
 					struct gatt_db_attribute *attrib,
 					GDBusProxy *proxy,
 					struct queue *owner_queue,
@@ -2233,13 +2566,20 @@ static struct pending_op *send_read(struct btd_device *device,
 	op = pending_read_new(device, owner_queue, attrib, id, offset,
 							link_type);
 
-	if (g_dbus_proxy_method_call(proxy, "ReadValue", read_setup_cb,
-				read_reply_cb, op, pending_op_free) == TRUE)
-		return op;
+	op->is_read = true;
+	op->app = app;
+	op->conn = get_conn(app->database, device);
+	op->proxy = proxy;
+	op->method = "ReadValue";
+	op->setup = read_setup_cb;
+	op->reply = read_reply_cb;
+
+	if (op_submit(op))
+		return true;
 
 	pending_op_free(op);
 
-	return NULL;
+	return false;
 }
 
 static void write_setup_cb(DBusMessageIter *iter, void *user_data)
@@ -2262,10 +2602,17 @@ static void write_setup_cb(DBusMessageIter *iter, void *user_data)
 	append_options(&dict, op);
 
 	dbus_message_iter_close_container(iter, &dict);
+}
 
-	if (!op->owner_queue) {
-		gatt_db_attribute_write_result(op->attrib, op->id, 0);
-		pending_op_free(op);
+static void write_cmd_reply_cb(DBusMessage *message, void *user_data)
+{
+	DBusError err;
+
+	dbus_error_init(&err);
+
+	if (dbus_set_error_from_message(&err, message) == TRUE) {
+		DBG("Failed to write value: %s: %s", err.name, err.message);
+		dbus_error_free(&err);
 	}
 }
 
@@ -2346,7 +2693,7 @@ static struct pending_op *pending_write_new(struct btd_device *device,
 	return op;
 }
 
-static struct pending_op *send_write(struct btd_device *device,
+static bool send_write(struct gatt_app *app, struct btd_device *device,
 					struct gatt_db_attribute *attrib,
 					GDBusProxy *proxy,
 					struct queue *owner_queue,
@@ -2362,14 +2709,21 @@ static struct pending_op *send_write(struct btd_device *device,
 					offset, link_type, is_characteristic,
 					prep_authorize);
 
-	if (g_dbus_proxy_method_call(proxy, "WriteValue", write_setup_cb,
-					owner_queue ? write_reply_cb : NULL,
-					op, pending_op_free) == TRUE)
-		return op;
+	op->app = app;
+	op->conn = get_conn(app->database, device);
+	op->proxy = proxy;
+	op->method = "WriteValue";
+	op->setup = write_setup_cb;
+
+	/* Replies to commands only release the room taken in flight */
+	op->reply = owner_queue ? write_reply_cb : write_cmd_reply_cb;
+
+	if (op_submit(op))
+		return true;
 
 	pending_op_free(op);
 
-	return NULL;
+	return false;
 }
 
 static bool sock_hup(struct io *io, void *user_data)
@@ -2491,9 +2845,10 @@ static void acquire_write_reply(DBusMessage *message, void *user_data)
 	return;
 
 retry:
-	send_write(op->device, op->attrib, chrc->proxy, NULL, op->id,
-				op->data.iov_base, op->data.iov_len, 0,
-				op->link_type, false, false);
+	send_write(chrc->service->app, op->device, op->attrib, chrc->proxy,
+				NULL, op->id, op->data.iov_base,
+				op->data.iov_len, 0, op->link_type, false,
+				false);
 }
 
 static void acquire_write_setup(DBusMessageIter *iter, void *user_data)
@@ -2803,8 +3158,9 @@ static void desc_read_cb(struct gatt_db_attribute *attrib,
 		goto fail;
 	}
 
-	if (send_read(device, attrib, desc->proxy, desc->pending_reads, id,
-					offset, bt_att_get_link_type(att)))
+	if (send_read(desc->service->app, device, attrib, desc->proxy,
+					desc->pending_reads, id, offset,
+					bt_att_get_link_type(att)))
 		return;
 
 fail:
@@ -2835,10 +3191,11 @@ static void desc_write_cb(struct gatt_db_attribute *attrib,
 	if (opcode == BT_ATT_OP_PREP_WRITE_REQ) {
 		if (!device_is_trusted(device) && !desc->prep_authorized &&
 						desc->req_prep_authorization)
-			send_write(device, attrib, desc->proxy,
-					desc->pending_writes, id, value, len,
-					offset, bt_att_get_link_type(att),
-					false, true);
+			send_write(desc->service->app, device, attrib,
+					desc->proxy, desc->pending_writes, id,
+					value, len, offset,
+					bt_att_get_link_type(att), false,
+					true);
 		else
 			gatt_db_attribute_write_result(attrib, id, 0);
 
@@ -2848,9 +3205,9 @@ static void desc_write_cb(struct gatt_db_attribute *attrib,
 	if (opcode == BT_ATT_OP_EXEC_WRITE_REQ)
 		desc->prep_authorized = false;
 
-	if (send_write(device, attrib, desc->proxy, desc->pending_writes, id,
-			value, len, offset, bt_att_get_link_type(att), false,
-			false))
+	if (send_write(desc->service->app, device, attrib, desc->proxy,
+			desc->pending_writes, id, value, len, offset,
+			bt_att_get_link_type(att), false, false))
 		return;
 
 fail:
@@ -2929,8 +3286,9 @@ static void chrc_read_cb(struct gatt_db_attribute *attrib,
 		goto fail;
 	}
 
-	if (send_read(device, attrib, chrc->proxy, chrc->pending_reads, id,
-					offset, bt_att_get_link_type(att)))
+	if (send_read(chrc->service->app, device, attrib, chrc->proxy,
+					chrc->pending_reads, id, offset,
+					bt_att_get_link_type(att)))
 		return;
 
 fail:
@@ -2968,9 +3326,10 @@ static void chrc_write_cb(struct gatt_db_attribute *attrib,
 	if (opcode == BT_ATT_OP_PREP_WRITE_REQ) {
 		if (!device_is_trusted(device) && !chrc->prep_authorized &&
 						chrc->req_prep_authorization)
-			send_write(device, attrib, chrc->proxy, queue,
-					id, value, len, offset,
-					bt_att_get_link_type(att), true, true);
+			send_write(chrc->service->app, device, attrib,
+					chrc->proxy, queue, id, value, len,
+					offset, bt_att_get_link_type(att),
+					true, true);
 		else
 			gatt_db_attribute_write_result(attrib, id, 0);
 
@@ -2996,8 +3355,9 @@ static void chrc_write_cb(struct gatt_db_attribute *attrib,
 			return;
 	}
 
-	if (send_write(device, attrib, chrc->proxy, queue, id, value, len,
-			offset, bt_att_get_link_type(att), false, false))
+	if (send_write(chrc->service->app, device, attrib, chrc->proxy, queue,
+			id, value, len, offset, bt_att_get_link_type(att),
+			false, false))
 		return;
 
 fail:
@@ -3135,7 +3495,8 @@ static bool database_add_service(struct external_service *service)
 		return false;
 	}
 
-	service->attrib = gatt_db_insert_service(service->app->database->db,
+	service->attrib = gatt_db_insert_static_service(
+						service->app->database->db,
 						handle, &uuid,
 						primary, service->attr_cnt);
 	if (!service->attrib)
@@ -3476,6 +3837,7 @@ static struct gatt_app *create_app(DBusConnection *conn, DBusMessage *msg,
 	app->services = queue_new();
 	app->profiles = queue_new();
 	app->proxies = queue_new();
+	app->ops = queue_new();
 	app->reg = dbus_message_ref(msg);
 
 	g_dbus_client_set_disconnect_watch(app->client, client_disconnect_cb,
@@ -3623,6 +3985,7 @@ struct btd_gatt_database *btd_gatt_database_new(struct btd_adapter *adapter)
 	database->apps = queue_new();
 	database->profiles = queue_new();
 	database->ccc_callbacks = queue_new();
+	database->conns = queue_new();
 
 	addr = btd_adapter_get_address(adapter);
 	database->le_io = bt_io_listen(connect_cb, NULL, NULL, NULL, &gerr,
@@ -88,6 +88,7 @@ struct main_opts {
 	gboolean	debug_keys;
 	gboolean	fast_conn;
 	gboolean	refresh_discovery;
+	gboolean	parallel_connect;
 
 	uint16_t	did_source;
 	uint16_t	did_vendor;
@@ -78,6 +78,7 @@ static const char *supported_options[] = {
 	"Privacy",
 	"JustWorksRepairing",
 	"TemporaryTimeout",
+	"ParallelConnect",
 	NULL
 };
 
@@ -119,6 +120,8 @@ static const char *policy_options[] = {
 	"ReconnectIntervals",
 	"AutoEnable",
 	"ResumeDelay",
+	"ReconnectPages",
+	"ReconnectLEConnections",
 	NULL
 };
 
@@ -622,6 +625,13 @@ static void parse_config(GKeyFile *config)
 	else
 		main_opts.refresh_discovery = boolean;
 
+	boolean = g_key_file_get_boolean(config, "General",
+						"ParallelConnect", &err);
+	if (err)
+		g_clear_error(&err);
+	else
+		main_opts.parallel_connect = boolean;
+
 	str = g_key_file_get_string(config, "GATT", "Cache", &err);
 	if (err) {
 		DBG("%s", err->message);
@@ -19,22 +19,28 @@
 #ifdef HAVE_UDEV_HWDB_NEW
 #include <libudev.h>
 
+static struct udev *udev;
+static struct udev_hwdb *hwdb;
+
 char *batocomp(const bdaddr_t *ba)
 {
-	struct udev *udev;
-	struct udev_hwdb *hwdb;
 	struct udev_list_entry *head, *entry;
 	char modalias[11], *comp = NULL;
 
 	sprintf(modalias, "OUI:%2.2X%2.2X%2.2X", ba->b[5], ba->b[4], ba->b[3]);
 
-	udev = udev_new();
-	if (!udev)
-		return NULL;
+	/* Keep the database open for the lookups of other addresses */
+	if (!udev) {
+		udev = udev_new();
+		if (!udev)
+			return NULL;
+	}
 
-	hwdb = udev_hwdb_new(udev);
-	if (!hwdb)
-		goto done;
+	if (!hwdb) {
+		hwdb = udev_hwdb_new(udev);
+		if (!hwdb)
+			return NULL;
+	}
 
 	head = udev_hwdb_get_properties_list_entry(hwdb, modalias, 0);
 
@@ -47,11 +53,6 @@ char *batocomp(const bdaddr_t *ba)
 		}
 	}
 
-	hwdb = udev_hwdb_unref(hwdb);
-
-done:
-	udev = udev_unref(udev);
-
 	return comp;
 }
 #else
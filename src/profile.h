@@ -27,6 +27,10 @@ struct btd_profile {
 	 * from being claimed internally.
 	 */
 	bool external;
+	/* Remote UUIDs of the profiles to be connected before this one when
+	 * the profiles of a device are connected in parallel, NULL terminated.
+	 */
+	const char * const *after_services;
 
 	int (*device_probe) (struct btd_service *service);
 	void (*device_remove) (struct btd_service *service);
@@ -211,6 +211,27 @@ uint32_t btsnoop_get_format(struct btsnoop *btsnoop)
 	return btsnoop->format;
 }
 
+off_t btsnoop_get_offset(struct btsnoop *btsnoop)
+{
+	if (!btsnoop)
+		return -1;
+
+	return lseek(btsnoop->fd, 0, SEEK_CUR);
+}
+
+bool btsnoop_set_offset(struct btsnoop *btsnoop, off_t offset)
+{
+	if (!btsnoop)
+		return false;
+
+	if (lseek(btsnoop->fd, offset, SEEK_SET) != offset)
+		return false;
+
+	btsnoop->aborted = false;
+
+	return true;
+}
+
 static bool btsnoop_rotate(struct btsnoop *btsnoop)
 {
 	struct btsnoop_hdr hdr;
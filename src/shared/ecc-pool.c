@@ -0,0 +1,205 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <pthread.h>
+
+#include "src/shared/util.h"
+#include "src/shared/ecc.h"
+#include "src/shared/ecc-pool.h"
+
+struct ecc_keypair {
+	uint8_t public_key[64];
+	uint8_t private_key[32];
+};
+
+struct ecc_pool {
+	pthread_t thread;
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	bool stop;
+	struct ecc_keypair *keys;
+	unsigned int depth;
+	unsigned int head;
+	unsigned int count;
+	unsigned int misses;
+};
+
+static void wipe(void *buf, size_t len)
+{
+#ifdef HAVE_EXPLICIT_BZERO
+	explicit_bzero(buf, len);
+#else
+	volatile uint8_t *p = buf;
+
+	while (len--)
+		*p++ = 0;
+#endif
+}
+
+static void *refill_thread(void *user_data)
+{
+	struct ecc_pool *pool = user_data;
+	struct ecc_keypair key;
+
+	pthread_mutex_lock(&pool->lock);
+
+	while (!pool->stop) {
+		unsigned int tail;
+
+		if (pool->count == pool->depth) {
+			pthread_cond_wait(&pool->cond, &pool->lock);
+			continue;
+		}
+
+		/* Generate without holding the lock so that takers never
+		 * wait for a scalar multiplication.
+		 */
+		pthread_mutex_unlock(&pool->lock);
+
+		if (!ecc_make_key(key.public_key, key.private_key)) {
+			pthread_mutex_lock(&pool->lock);
+			break;
+		}
+
+		pthread_mutex_lock(&pool->lock);
+
+		tail = (pool->head + pool->count) % pool->depth;
+		pool->keys[tail] = key;
+		pool->count++;
+	}
+
+	pthread_mutex_unlock(&pool->lock);
+
+	wipe(&key, sizeof(key));
+
+	return NULL;
+}
+
+struct ecc_pool *ecc_pool_new(unsigned int depth)
+{
+	struct ecc_pool *pool;
+
+	if (!depth)
+		return NULL;
+
+	pool = new0(struct ecc_pool, 1);
+	pool->keys = new0(struct ecc_keypair, depth);
+	pool->depth = depth;
+
+	/* The worker thread must not race with the lazy table setup */
+	ecc_precompute();
+
+	/* The first keypair is generated in place */
+	if (!ecc_make_key(pool->keys[0].public_key,
+					pool->keys[0].private_key))
+		goto failed;
+
+	pool->count = 1;
+
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->cond, NULL);
+
+	if (pthread_create(&pool->thread, NULL, refill_thread, pool)) {
+		pthread_cond_destroy(&pool->cond);
+		pthread_mutex_destroy(&pool->lock);
+		goto failed;
+	}
+
+	return pool;
+
+failed:
+	wipe(pool->keys, depth * sizeof(*pool->keys));
+	free(pool->keys);
+	free(pool);
+	return NULL;
+}
+
+void ecc_pool_free(struct ecc_pool *pool)
+{
+	if (!pool)
+		return;
+
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = true;
+	pthread_cond_signal(&pool->cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	pthread_join(pool->thread, NULL);
+
+	pthread_cond_destroy(&pool->cond);
+	pthread_mutex_destroy(&pool->lock);
+
+	wipe(pool->keys, pool->depth * sizeof(*pool->keys));
+	free(pool->keys);
+	free(pool);
+}
+
+bool ecc_pool_get(struct ecc_pool *pool, uint8_t public_key[64],
+						uint8_t private_key[32])
+{
+	struct ecc_keypair *key;
+
+	if (!pool)
+		return ecc_make_key(public_key, private_key);
+
+	pthread_mutex_lock(&pool->lock);
+
+	if (!pool->count) {
+		pool->misses++;
+		pthread_mutex_unlock(&pool->lock);
+		return ecc_make_key(public_key, private_key);
+	}
+
+	key = &pool->keys[pool->head];
+	memcpy(public_key, key->public_key, sizeof(key->public_key));
+	memcpy(private_key, key->private_key, sizeof(key->private_key));
+
+	/* Never hand out the same keypair twice */
+	wipe(key, sizeof(*key));
+
+	pool->head = (pool->head + 1) % pool->depth;
+	pool->count--;
+
+	pthread_cond_signal(&pool->cond);
+	pthread_mutex_unlock(&pool->lock);
+
+	return true;
+}
+
+unsigned int ecc_pool_get_count(struct ecc_pool *pool)
+{
+	unsigned int count;
+
+	if (!pool)
+		return 0;
+
+	pthread_mutex_lock(&pool->lock);
+	count = pool->count;
+	pthread_mutex_unlock(&pool->lock);
+
+	return count;
+}
+
+unsigned int ecc_pool_get_misses(struct ecc_pool *pool)
+{
+	unsigned int misses;
+
+	if (!pool)
+		return 0;
+
+	pthread_mutex_lock(&pool->lock);
+	misses = pool->misses;
+	pthread_mutex_unlock(&pool->lock);
+
+	return misses;
+}
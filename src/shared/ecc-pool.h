@@ -0,0 +1,25 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+ * Pool of ephemeral P-256 keypairs generated ahead of time by a worker
+ * thread. Every keypair is handed out exactly once and wiped from the pool
+ * when taken; an empty pool falls back to generating a keypair in place.
+ */
+struct ecc_pool;
+
+struct ecc_pool *ecc_pool_new(unsigned int depth);
+void ecc_pool_free(struct ecc_pool *pool);
+
+bool ecc_pool_get(struct ecc_pool *pool, uint8_t public_key[64],
+						uint8_t private_key[32]);
+
+unsigned int ecc_pool_get_count(struct ecc_pool *pool);
+unsigned int ecc_pool_get_misses(struct ecc_pool *pool);
@@ -583,9 +583,83 @@ static bool ecc_point_is_zero(const struct ecc_point *point)
 	return (vli_is_zero(point->x) && vli_is_zero(point->y));
 }
 
-/* Point multiplication algorithm using Montgomery's ladder with co-Z
- * coordinates. From http://eprint.iacr.org/2011/338.pdf
+/* Point multiplication uses Jacobian coordinates, (x, y, z) standing for
+ * the affine point (x / z^2, y / z^3), with mixed additions of precomputed
+ * affine points. Every scalar runs through the same sequence of doublings
+ * and additions, table entries are picked with masks rather than indexing
+ * and the results of additions of zero digits are discarded with masks.
  */
+struct ecc_jacobian {
+	uint64_t x[NUM_ECC_DIGITS];
+	uint64_t y[NUM_ECC_DIGITS];
+	uint64_t z[NUM_ECC_DIGITS];
+};
+
+/* Generator multiplication uses a comb: bit i of each of the COMB_TEETH
+ * scalar slices of COMB_SPACING bits selects one of the precomputed sums
+ * of 2^(t * COMB_SPACING) * G, so only COMB_SPACING doublings are needed.
+ */
+#define COMB_TEETH	8
+#define COMB_SPACING	(ECC_BYTES * 8 / COMB_TEETH)
+#define COMB_POINTS	(1 << COMB_TEETH)
+
+/* Other points are multiplied with a fixed window of WINDOW_BITS bits */
+#define WINDOW_BITS	4
+#define WINDOW_POINTS	(1 << WINDOW_BITS)
+
+static struct ecc_point comb_table[COMB_POINTS];
+static bool comb_ready;
+
+/* Returns all ones if a == b, zero otherwise. */
+static uint64_t ct_mask_eq(uint64_t a, uint64_t b)
+{
+	uint64_t diff = a ^ b;
+
+	return ((diff | (0 - diff)) >> 63) - 1;
+}
+
+/* Computes dest = mask ? src : dest. */
+static void vli_select(uint64_t *dest, const uint64_t *src, uint64_t mask)
+{
+	int i;
+
+	for (i = 0; i < NUM_ECC_DIGITS; i++)
+		dest[i] ^= (dest[i] ^ src[i]) & mask;
+}
+
+static void ecc_jacobian_select(struct ecc_jacobian *dest,
+				const struct ecc_jacobian *src, uint64_t mask)
+{
+	vli_select(dest->x, src->x, mask);
+	vli_select(dest->y, src->y, mask);
+	vli_select(dest->z, src->z, mask);
+}
+
+static void ecc_jacobian_set(struct ecc_jacobian *dest,
+						const struct ecc_point *src)
+{
+	vli_set(dest->x, src->x);
+	vli_set(dest->y, src->y);
+	vli_clear(dest->z);
+	dest->z[0] = 1;
+}
+
+/* Reads table[index] into point, reading every entry of the table. The
+ * point is left untouched for index 0.
+ */
+static void ecc_point_lookup(struct ecc_point *point,
+				const struct ecc_point *table,
+				unsigned int count, unsigned int index)
+{
+	unsigned int i;
+
+	for (i = 1; i < count; i++) {
+		uint64_t mask = ct_mask_eq(i, index);
+
+		vli_select(point->x, table[i].x, mask);
+		vli_select(point->y, table[i].y, mask);
+	}
+}
 
 /* Double in place */
 static void ecc_point_double_jacobian(uint64_t *x1, uint64_t *y1, uint64_t *z1)
@@ -593,6 +667,8 @@ static void ecc_point_double_jacobian(uint64_t *x1, uint64_t *y1, uint64_t *z1)
 	/* t1 = x, t2 = y, t3 = z */
 	uint64_t t4[NUM_ECC_DIGITS];
 	uint64_t t5[NUM_ECC_DIGITS];
+	uint64_t t6[NUM_ECC_DIGITS];
+	uint64_t carry, mask;
 
 	if (vli_is_zero(z1))
 		return;
@@ -610,13 +686,11 @@ static void ecc_point_double_jacobian(uint64_t *x1, uint64_t *y1, uint64_t *z1)
 
 	vli_mod_add(z1, x1, x1, curve_p); /* t3 = 2*(x1^2 - z1^4) */
 	vli_mod_add(x1, x1, z1, curve_p); /* t1 = 3*(x1^2 - z1^4) */
-	if (vli_test_bit(x1, 0)) {
-		uint64_t carry = vli_add(x1, x1, curve_p);
-		vli_rshift1(x1);
-		x1[NUM_ECC_DIGITS - 1] |= carry << 63;
-	} else {
-		vli_rshift1(x1);
-	}
+	mask = 0 - vli_test_bit(x1, 0);
+	carry = vli_add(t6, x1, curve_p) & mask;
+	vli_select(x1, t6, mask);
+	vli_rshift1(x1);
+	x1[NUM_ECC_DIGITS - 1] |= carry << 63;
 	/* t1 = 3/2*(x1^2 - z1^4) = B */
 
 	vli_mod_square_fast(z1, x1);      /* t3 = B^2 */
@@ -642,134 +716,244 @@ static void apply_z(uint64_t *x1, uint64_t *y1, uint64_t *z)
 	vli_mod_mult_fast(y1, y1, t1); /* y1 * z^3 */
 }
 
-/* P = (x1, y1) => 2P, (x2, y2) => P' */
-static void xycz_initial_double(uint64_t *x1, uint64_t *y1, uint64_t *x2,
-					uint64_t *y2, uint64_t *p_initial_z)
+/* Computes R = R + Q for Jacobian R and affine Q. The result is garbage if
+ * R is the point at infinity; callers discard it with masks in that case.
+ */
+static void ecc_point_add_mixed(struct ecc_jacobian *r,
+						const struct ecc_point *q)
 {
-	uint64_t z[NUM_ECC_DIGITS];
+	uint64_t t1[NUM_ECC_DIGITS];
+	uint64_t t2[NUM_ECC_DIGITS];
+	uint64_t h[NUM_ECC_DIGITS];
+	uint64_t s[NUM_ECC_DIGITS];
+
+	vli_mod_square_fast(t1, r->z);         /* t1 = z1^2 */
+	vli_mod_mult_fast(t2, t1, r->z);       /* t2 = z1^3 */
+	vli_mod_mult_fast(t1, t1, q->x);       /* t1 = x2*z1^2 = U2 */
+	vli_mod_mult_fast(t2, t2, q->y);       /* t2 = y2*z1^3 = S2 */
+	vli_mod_sub(h, t1, r->x, curve_p);     /* h = U2 - x1 = H */
+	vli_mod_sub(s, t2, r->y, curve_p);     /* s = S2 - y1 = R */
+
+	/* R = Q or R = -Q, which the multiplications below only reach for
+	 * scalars outside of [1, n-1] or with negligible probability.
+	 */
+	if (vli_is_zero(h)) {
+		if (vli_is_zero(s)) {
+			ecc_jacobian_set(r, q);
+			ecc_point_double_jacobian(r->x, r->y, r->z);
+		} else {
+			vli_clear(r->z);
+		}
+		return;
+	}
 
-	vli_set(x2, x1);
-	vli_set(y2, y1);
+	vli_mod_mult_fast(r->z, r->z, h);      /* z3 = z1*H */
+	vli_mod_square_fast(t1, h);            /* t1 = H^2 */
+	vli_mod_mult_fast(t2, t1, h);          /* t2 = H^3 */
+	vli_mod_mult_fast(t1, t1, r->x);       /* t1 = x1*H^2 */
+	vli_mod_square_fast(r->x, s);          /* x3 = R^2 */
+	vli_mod_sub(r->x, r->x, t2, curve_p);  /* x3 = R^2 - H^3 */
+	vli_mod_sub(r->x, r->x, t1, curve_p);
+	vli_mod_sub(r->x, r->x, t1, curve_p);  /* x3 = R^2 - H^3 - 2*x1*H^2 */
+	vli_mod_mult_fast(t2, t2, r->y);       /* t2 = y1*H^3 */
+	vli_mod_sub(t1, t1, r->x, curve_p);    /* t1 = x1*H^2 - x3 */
+	vli_mod_mult_fast(t1, t1, s);          /* t1 = R*(x1*H^2 - x3) */
+	vli_mod_sub(r->y, t1, t2, curve_p);    /* y3 = t1 - y1*H^3 */
+}
 
-	vli_clear(z);
-	z[0] = 1;
+/* Converts count points to affine coordinates with a single inversion.
+ * The point at infinity is converted to (0, 0).
+ */
+static void ecc_point_normalize(struct ecc_point *result,
+				const struct ecc_jacobian *points, int count)
+{
+	uint64_t acc[COMB_POINTS][NUM_ECC_DIGITS];
+	uint64_t inv[NUM_ECC_DIGITS];
+	uint64_t zinv[NUM_ECC_DIGITS];
+	uint64_t t1[NUM_ECC_DIGITS];
+	int i;
 
-	if (p_initial_z)
-		vli_set(z, p_initial_z);
+	/* acc[i] = z0 * z1 * ... * zi */
+	vli_set(acc[0], points[0].z);
+	for (i = 1; i < count; i++)
+		vli_mod_mult_fast(acc[i], acc[i - 1], points[i].z);
 
-	apply_z(x1, y1, z);
+	vli_mod_inv(inv, acc[count - 1], curve_p);
 
-	ecc_point_double_jacobian(x1, y1, z);
+	for (i = count - 1; i >= 0; i--) {
+		if (i > 0) {
+			vli_mod_mult_fast(zinv, inv, acc[i - 1]);
+			vli_mod_mult_fast(inv, inv, points[i].z);
+		} else {
+			vli_set(zinv, inv);
+		}
 
-	apply_z(x2, y2, z);
+		vli_mod_square_fast(t1, zinv);                 /* 1 / z^2 */
+		vli_mod_mult_fast(result[i].x, points[i].x, t1);
+		vli_mod_mult_fast(t1, t1, zinv);               /* 1 / z^3 */
+		vli_mod_mult_fast(result[i].y, points[i].y, t1);
+	}
 }
 
-/* Input P = (x1, y1, Z), Q = (x2, y2, Z)
- * Output P' = (x1', y1', Z3), P + Q = (x3, y3, Z3)
- * or P => P', Q => P + Q
- */
-static void xycz_add(uint64_t *x1, uint64_t *y1, uint64_t *x2, uint64_t *y2)
+void ecc_precompute(void)
 {
-	/* t1 = X1, t2 = Y1, t3 = X2, t4 = Y2 */
-	uint64_t t5[NUM_ECC_DIGITS];
+	struct ecc_jacobian points[COMB_POINTS - 1];
+	struct ecc_jacobian teeth[COMB_TEETH];
+	struct ecc_point base[COMB_TEETH];
+	int i, t;
+
+	if (comb_ready)
+		return;
+
+	/* base[t] = 2^(t * COMB_SPACING) * G */
+	ecc_jacobian_set(&teeth[0], &curve_g);
+
+	for (t = 1; t < COMB_TEETH; t++) {
+		teeth[t] = teeth[t - 1];
+
+		for (i = 0; i < COMB_SPACING; i++)
+			ecc_point_double_jacobian(teeth[t].x, teeth[t].y,
+								teeth[t].z);
+	}
 
-	vli_mod_sub(t5, x2, x1, curve_p); /* t5 = x2 - x1 */
-	vli_mod_square_fast(t5, t5);      /* t5 = (x2 - x1)^2 = A */
-	vli_mod_mult_fast(x1, x1, t5);    /* t1 = x1*A = B */
-	vli_mod_mult_fast(x2, x2, t5);    /* t3 = x2*A = C */
-	vli_mod_sub(y2, y2, y1, curve_p); /* t4 = y2 - y1 */
-	vli_mod_square_fast(t5, y2);      /* t5 = (y2 - y1)^2 = D */
+	ecc_point_normalize(base, teeth, COMB_TEETH);
 
-	vli_mod_sub(t5, t5, x1, curve_p); /* t5 = D - B */
-	vli_mod_sub(t5, t5, x2, curve_p); /* t5 = D - B - C = x3 */
-	vli_mod_sub(x2, x2, x1, curve_p); /* t3 = C - B */
-	vli_mod_mult_fast(y1, y1, x2);    /* t2 = y1*(C - B) */
-	vli_mod_sub(x2, x1, t5, curve_p); /* t3 = B - x3 */
-	vli_mod_mult_fast(y2, y2, x2);    /* t4 = (y2 - y1)*(B - x3) */
-	vli_mod_sub(y2, y2, y1, curve_p); /* t4 = y3 */
+	/* comb_table[i] = sum of base[t] for every bit t set in i */
+	for (i = 1; i < COMB_POINTS; i++) {
+		for (t = 0; !(i & (1 << t)); t++)
+			;
 
-	vli_set(x2, t5);
+		if (i == 1 << t) {
+			ecc_jacobian_set(&points[i - 1], &base[t]);
+			continue;
+		}
+
+		points[i - 1] = points[(i & (i - 1)) - 1];
+		ecc_point_add_mixed(&points[i - 1], &base[t]);
+	}
+
+	ecc_point_normalize(&comb_table[1], points, COMB_POINTS - 1);
+
+	comb_ready = true;
 }
 
-/* Input P = (x1, y1, Z), Q = (x2, y2, Z)
- * Output P + Q = (x3, y3, Z3), P - Q = (x3', y3', Z3)
- * or P => P - Q, Q => P + Q
- */
-static void xycz_add_c(uint64_t *x1, uint64_t *y1, uint64_t *x2, uint64_t *y2)
+/* Computes result = scalar * G */
+static void ecc_point_mult_g(struct ecc_point *result,
+						const uint64_t *scalar)
 {
-	/* t1 = X1, t2 = Y1, t3 = X2, t4 = Y2 */
-	uint64_t t5[NUM_ECC_DIGITS];
-	uint64_t t6[NUM_ECC_DIGITS];
-	uint64_t t7[NUM_ECC_DIGITS];
+	struct ecc_jacobian r, sum, first;
+	struct ecc_point q;
+	uint64_t infinity = ~0ull;
+	int i, t;
 
-	vli_mod_sub(t5, x2, x1, curve_p); /* t5 = x2 - x1 */
-	vli_mod_square_fast(t5, t5);      /* t5 = (x2 - x1)^2 = A */
-	vli_mod_mult_fast(x1, x1, t5);    /* t1 = x1*A = B */
-	vli_mod_mult_fast(x2, x2, t5);    /* t3 = x2*A = C */
-	vli_mod_add(t5, y2, y1, curve_p); /* t4 = y2 + y1 */
-	vli_mod_sub(y2, y2, y1, curve_p); /* t4 = y2 - y1 */
+	ecc_precompute();
 
-	vli_mod_sub(t6, x2, x1, curve_p); /* t6 = C - B */
-	vli_mod_mult_fast(y1, y1, t6);    /* t2 = y1 * (C - B) */
-	vli_mod_add(t6, x1, x2, curve_p); /* t6 = B + C */
-	vli_mod_square_fast(x2, y2);      /* t3 = (y2 - y1)^2 */
-	vli_mod_sub(x2, x2, t6, curve_p); /* t3 = x3 */
+	/* Start from the point at infinity, (1, 1, 0) */
+	vli_clear(r.x);
+	vli_clear(r.y);
+	vli_clear(r.z);
+	r.x[0] = 1;
+	r.y[0] = 1;
 
-	vli_mod_sub(t7, x1, x2, curve_p); /* t7 = B - x3 */
-	vli_mod_mult_fast(y2, y2, t7);    /* t4 = (y2 - y1)*(B - x3) */
-	vli_mod_sub(y2, y2, y1, curve_p); /* t4 = y3 */
+	for (i = COMB_SPACING - 1; i >= 0; i--) {
+		unsigned int index = 0;
+		uint64_t skip;
 
-	vli_mod_square_fast(t7, t5);      /* t7 = (y2 + y1)^2 = F */
-	vli_mod_sub(t7, t7, t6, curve_p); /* t7 = x3' */
-	vli_mod_sub(t6, t7, x1, curve_p); /* t6 = x3' - B */
-	vli_mod_mult_fast(t6, t6, t5);    /* t6 = (y2 + y1)*(x3' - B) */
-	vli_mod_sub(y1, t6, y1, curve_p); /* t2 = y3' */
+		for (t = 0; t < COMB_TEETH; t++) {
+			unsigned int bit = t * COMB_SPACING + i;
+
+			index |= ((scalar[bit / 64] >> (bit % 64)) & 1) << t;
+		}
 
-	vli_set(x1, t7);
+		ecc_point_double_jacobian(r.x, r.y, r.z);
+
+		q = comb_table[1];
+		ecc_point_lookup(&q, comb_table, COMB_POINTS, index);
+
+		sum = r;
+		ecc_point_add_mixed(&sum, &q);
+
+		/* Q itself is the sum while R is still at infinity */
+		ecc_jacobian_set(&first, &q);
+		ecc_jacobian_select(&sum, &first, infinity);
+
+		skip = ct_mask_eq(index, 0);
+		ecc_jacobian_select(&r, &sum, ~skip);
+		infinity &= skip;
+	}
+
+	ecc_point_normalize(result, &r, 1);
 }
 
+static unsigned int vli_window(const uint64_t *vli, unsigned int window)
+{
+	unsigned int bit = window * WINDOW_BITS;
+
+	return (vli[bit / 64] >> (bit % 64)) & (WINDOW_POINTS - 1);
+}
+
+/* Computes result = scalar * point, num_bits being the bit length of the
+ * scalar. The initial_z value randomizes the projective coordinates.
+ */
 static void ecc_point_mult(struct ecc_point *result,
 				const struct ecc_point *point,
-				uint64_t *scalar, uint64_t *initial_z,
-				int num_bits)
+				const uint64_t *scalar, uint64_t *initial_z,
+				unsigned int num_bits)
 {
-	/* R0 and R1 */
-	uint64_t rx[2][NUM_ECC_DIGITS];
-	uint64_t ry[2][NUM_ECC_DIGITS];
-	uint64_t z[NUM_ECC_DIGITS];
-	int i, nb;
+	struct ecc_jacobian points[WINDOW_POINTS - 1];
+	struct ecc_point table[WINDOW_POINTS];
+	struct ecc_jacobian r, sum;
+	struct ecc_point q;
+	int i, j;
+
+	if (!num_bits) {
+		vli_clear(result->x);
+		vli_clear(result->y);
+		return;
+	}
 
-	vli_set(rx[1], point->x);
-	vli_set(ry[1], point->y);
+	/* table[i] = i * point */
+	ecc_jacobian_set(&points[0], point);
 
-	xycz_initial_double(rx[1], ry[1], rx[0], ry[0], initial_z);
+	points[1] = points[0];
+	ecc_point_double_jacobian(points[1].x, points[1].y, points[1].z);
 
-	for (i = num_bits - 2; i > 0; i--) {
-		nb = !vli_test_bit(scalar, i);
-		xycz_add_c(rx[1 - nb], ry[1 - nb], rx[nb], ry[nb]);
-		xycz_add(rx[nb], ry[nb], rx[1 - nb], ry[1 - nb]);
+	for (i = 2; i < WINDOW_POINTS - 1; i++) {
+		points[i] = points[i - 1];
+		ecc_point_add_mixed(&points[i], point);
 	}
 
-	nb = !vli_test_bit(scalar, 0);
-	xycz_add_c(rx[1 - nb], ry[1 - nb], rx[nb], ry[nb]);
+	ecc_point_normalize(&table[1], points, WINDOW_POINTS - 1);
 
-	/* Find final 1/Z value. */
-	vli_mod_sub(z, rx[1], rx[0], curve_p); /* X1 - X0 */
-	vli_mod_mult_fast(z, z, ry[1 - nb]); /* Yb * (X1 - X0) */
-	vli_mod_mult_fast(z, z, point->x);   /* xP * Yb * (X1 - X0) */
-	vli_mod_inv(z, z, curve_p);          /* 1 / (xP * Yb * (X1 - X0)) */
-	vli_mod_mult_fast(z, z, point->y);   /* yP / (xP * Yb * (X1 - X0)) */
-	vli_mod_mult_fast(z, z, rx[1 - nb]); /* Xb * yP / (xP * Yb * (X1 - X0)) */
-	/* End 1/Z calculation */
+	/* The topmost window is never zero */
+	i = (num_bits - 1) / WINDOW_BITS;
 
-	xycz_add(rx[nb], ry[nb], rx[1 - nb], ry[1 - nb]);
+	q = table[1];
+	ecc_point_lookup(&q, table, WINDOW_POINTS, vli_window(scalar, i));
+	ecc_jacobian_set(&r, &q);
 
-	apply_z(rx[0], ry[0], z);
+	if (initial_z) {
+		apply_z(r.x, r.y, initial_z);
+		vli_set(r.z, initial_z);
+	}
 
-	vli_set(result->x, rx[0]);
-	vli_set(result->y, ry[0]);
-}
+	for (i--; i >= 0; i--) {
+		unsigned int digit = vli_window(scalar, i);
+
+		for (j = 0; j < WINDOW_BITS; j++)
+			ecc_point_double_jacobian(r.x, r.y, r.z);
 
+		q = table[1];
+		ecc_point_lookup(&q, table, WINDOW_POINTS, digit);
+
+		sum = r;
+		ecc_point_add_mixed(&sum, &q);
+
+		ecc_jacobian_select(&r, &sum, ~ct_mask_eq(digit, 0));
+	}
+
+	ecc_point_normalize(result, &r, 1);
+}
 static bool ecc_valid_point(const struct ecc_point *point)
 {
 	uint64_t tmp1[NUM_ECC_DIGITS];
@@ -853,7 +1037,7 @@ bool ecc_make_public_key(const uint8_t private_key[32], uint8_t public_key[64])
 	if (vli_cmp(curve_n, priv) != 1)
 		return false;
 
-	ecc_point_mult(&pk, &curve_g, priv, NULL, vli_num_bits(priv));
+	ecc_point_mult_g(&pk, priv);
 
 	if (ecc_point_is_zero(&pk))
 		return false;
@@ -881,7 +1065,7 @@ bool ecc_make_key(uint8_t public_key[64], uint8_t private_key[32])
 		if (vli_cmp(curve_n, priv) != 1)
 			continue;
 
-		ecc_point_mult(&pk, &curve_g, priv, NULL, vli_num_bits(priv));
+		ecc_point_mult_g(&pk, priv);
 	} while (ecc_point_is_zero(&pk));
 
 	ecc_native2bytes(priv, private_key);
@@ -8,6 +8,15 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+/* Build the precomputed tables used for multiplications with the
+ * generator point.
+ *
+ * The tables are otherwise built on first use, which is not safe when
+ * the functions below are called from more than one thread. This must
+ * then be called before any other thread is started.
+ */
+void ecc_precompute(void);
+
 /* Create a public key from a private key.
  *
  * Inputs:
@@ -66,6 +66,11 @@ struct bt_gatt_client {
 	bool in_init;
 	bool ready;
 
+	/* Called once before the database is modified for the first time */
+	bt_gatt_client_db_split_func_t db_split_func;
+	bt_gatt_client_destroy_func_t db_split_destroy;
+	void *db_split_data;
+
 	/*
 	 * Queue of long write requests. An error during "prepare write"
 	 * requests can result in a cancel through "execute write". To prevent
@@ -1318,10 +1323,116 @@ static void notify_client_ready(struct bt_gatt_client *client, bool success,
 	bt_gatt_client_unref(client);
 }
 
+static struct gatt_db_attribute *rebase_attr(struct gatt_db *db,
+					struct gatt_db_attribute *attr)
+{
+	if (!attr)
+		return NULL;
+
+	return gatt_db_get_attribute(db, gatt_db_attribute_get_handle(attr));
+}
+
+static struct queue *rebase_attr_queue(struct gatt_db *db, struct queue *q)
+{
+	const struct queue_entry *entry;
+	struct queue *attrs = queue_new();
+
+	for (entry = queue_get_entries(q); entry; entry = entry->next)
+		queue_push_tail(attrs, rebase_attr(db, entry->data));
+
+	queue_destroy(q, NULL);
+
+	return attrs;
+}
+
+static void discovery_op_rebase(struct discovery_op *op, struct gatt_db *db)
+{
+	if (op->db_id) {
+		gatt_db_unregister(op->client->db, op->db_id);
+		op->db_id = gatt_db_register(db, discovery_service_changed,
+						discovery_service_changed,
+						op, NULL);
+	}
+
+	op->pending_svcs = rebase_attr_queue(db, op->pending_svcs);
+	op->ext_prop_desc = rebase_attr_queue(db, op->ext_prop_desc);
+	op->cur_svc = rebase_attr(db, op->cur_svc);
+	op->hash = rebase_attr(db, op->hash);
+}
+
+static void notify_chrc_rebase(void *data, void *user_data)
+{
+	struct notify_chrc *chrc = data;
+	struct gatt_db *db = user_data;
+
+	if (chrc->notify_id)
+		gatt_db_attribute_unregister(chrc->attr, chrc->notify_id);
+
+	chrc->attr = rebase_attr(db, chrc->attr);
+	chrc->notify_id = gatt_db_attribute_register(chrc->attr, chrc_removed,
+								chrc, NULL);
+}
+
+static void client_set_db(struct bt_gatt_client *client, struct gatt_db *db)
+{
+	const struct queue_entry *entry;
+
+	queue_foreach(client->notify_chrcs, notify_chrc_rebase, db);
+
+	gatt_db_unref(client->db);
+	client->db = gatt_db_ref(db);
+
+	for (entry = queue_get_entries(client->clones); entry;
+							entry = entry->next)
+		client_set_db(entry->data, db);
+}
+
+/*
+ * The database may be shared with clients of other devices with the same
+ * attribute table, give its owner the chance to hand over a private copy
+ * before it is modified. Attributes kept by the client, and by the given
+ * discovery operation, are moved over to the new database by handle.
+ */
+static void db_split(struct bt_gatt_client *client, struct discovery_op *op)
+{
+	bt_gatt_client_db_split_func_t func;
+	struct gatt_db *db;
+
+	while (client->parent)
+		client = client->parent;
+
+	func = client->db_split_func;
+	if (!func)
+		return;
+
+	client->db_split_func = NULL;
+
+	db = func(client->db, client->db_split_data);
+
+	if (client->db_split_destroy)
+		client->db_split_destroy(client->db_split_data);
+
+	client->db_split_destroy = NULL;
+	client->db_split_data = NULL;
+
+	if (!db || db == client->db)
+		return;
+
+	util_debug(client->debug_callback, client->debug_data,
+					"Database split from shared copy");
+
+	if (op)
+		discovery_op_rebase(op, db);
+
+	client_set_db(client, db);
+}
+
 static void discover_all(struct discovery_op *op)
 {
 	struct bt_gatt_client *client = op->client;
 
+	db_split(client, op);
+
 	client->discovery_req = bt_gatt_discover_all_primary_services(
 							client->att, NULL,
 							discover_primary_cb,
@@ -1401,6 +1512,8 @@ static void db_hash_read_cb(bool success, uint8_t att_ecode,
 	util_hexdump(' ', value, len, client->debug_callback,
 						client->debug_data);
 
+	db_split(client, op);
+
 	/* Store ithe new hash in the db */
 	gatt_db_attribute_write(op->hash, 0, value, len, 0, NULL,
 					db_hash_write_value_cb, client);
@@ -1857,6 +1970,8 @@ static void process_service_changed(struct bt_gatt_client *client,
 {
 	struct discovery_op *op;
 
+	db_split(client, NULL);
+
 	op = discovery_op_create(client, start_handle, end_handle,
 						service_changed_complete,
 						service_changed_failure);
@@ -1931,6 +2046,9 @@ static void write_server_features(struct bt_gatt_client *client, uint8_t feat)
 	bt_uuid_t uuid;
 	struct gatt_db_attribute *attr = NULL;
 
+	/* The value is specific to the peer, store it in a copy of its own */
+	db_split(client, NULL);
+
 	bt_uuid16_create(&uuid, GATT_CHARAC_SERVER_FEAT);
 
 	gatt_db_find_by_type(client->db, 0x0001, 0xffff, &uuid,
@@ -2069,6 +2187,8 @@ discover:
 		goto done;
 	}
 
+	db_split(client, op);
+
 	client->discovery_req = bt_gatt_discover_all_primary_services(
 							client->att, NULL,
 							discover_primary_cb,
@@ -2210,6 +2330,9 @@ static void bt_gatt_client_free(struct bt_gatt_client *client)
 	if (client->debug_destroy)
 		client->debug_destroy(client->debug_data);
 
+	if (client->db_split_destroy)
+		client->db_split_destroy(client->db_split_data);
+
 	if (client->att) {
 		bt_att_unregister_disconnect(client->att, client->disc_id);
 		bt_att_unregister(client->att, client->nfy_id);
@@ -2419,6 +2542,24 @@ bool bt_gatt_client_set_service_changed(struct bt_gatt_client *client,
 	return true;
 }
 
+bool bt_gatt_client_set_db_split(struct bt_gatt_client *client,
+				bt_gatt_client_db_split_func_t callback,
+				void *user_data,
+				bt_gatt_client_destroy_func_t destroy)
+{
+	if (!client || client->parent)
+		return false;
+
+	if (client->db_split_destroy)
+		client->db_split_destroy(client->db_split_data);
+
+	client->db_split_func = callback;
+	client->db_split_destroy = destroy;
+	client->db_split_data = user_data;
+
+	return true;
+}
+
 bool bt_gatt_client_set_debug(struct bt_gatt_client *client,
 					bt_gatt_client_debug_func_t callback,
 					void *user_data,
@@ -94,9 +94,9 @@ struct pending_write {
 struct gatt_db_attribute {
 	struct gatt_db_service *service;
 	uint16_t handle;
+	uint16_t value_len;
 	bt_uuid_t uuid;
 	uint32_t permissions;
-	uint16_t value_len;
 	uint8_t *value;
 
 	gatt_db_read_t read_func;
@@ -104,21 +104,31 @@ struct gatt_db_attribute {
 	void *user_data;
 
 	unsigned int read_id;
-	struct queue *pending_reads;
-
 	unsigned int write_id;
-	struct queue *pending_writes;
-
 	unsigned int next_notify_id;
+
+	/* Queues are only created once something is added to them */
+	struct queue *pending_reads;
+	struct queue *pending_writes;
 	struct queue *notify_list;
 };
 
+/* Attribute of a service laid out in a single allocation, declaration
+ * values fit in place.
+ */
+struct static_attribute {
+	struct gatt_db_attribute attr;
+	uint8_t value[MAX_CHAR_DECL_VALUE_LEN];
+};
+
 struct gatt_db_service {
 	struct gatt_db *db;
 	bool active;
 	bool claimed;
 	uint16_t num_handles;
 	struct gatt_db_attribute **attributes;
+	struct static_attribute *static_attrs;
+	uint16_t static_used;
 };
 
 static void set_attribute_data(struct gatt_db_attribute *attribute,
@@ -178,6 +188,16 @@ static void attribute_notify_destroy(void *data)
 	free(notify);
 }
 
+static bool value_is_inline(const struct gatt_db_attribute *attribute)
+{
+	const struct static_attribute *slot = (const void *) attribute;
+
+	if (!attribute->service->static_attrs)
+		return false;
+
+	return attribute->value == slot->value;
+}
+
 static void attribute_destroy(struct gatt_db_attribute *attribute)
 {
 	/* Attribute was not initialized by user */
@@ -188,8 +208,27 @@ static void attribute_destroy(struct gatt_db_attribute *attribute)
 	queue_destroy(attribute->pending_writes, pending_write_free);
 	queue_destroy(attribute->notify_list, attribute_notify_destroy);
 
-	free(attribute->value);
-	free(attribute);
+	if (!value_is_inline(attribute))
+		free(attribute->value);
+
+	/* Static attributes are part of the service allocation */
+	if (!attribute->service->static_attrs)
+		free(attribute);
+}
+
+/* Undoes new_attribute() for an attribute that could not be inserted */
+static void discard_attribute(struct gatt_db_attribute *attribute)
+{
+	struct gatt_db_service *service = attribute->service;
+
+	attribute_destroy(attribute);
+
+	/* Give the slot back, it is always the last one reserved */
+	if (service->static_attrs) {
+		service->static_used--;
+		memset(&service->static_attrs[service->static_used], 0,
+					sizeof(*service->static_attrs));
+	}
 }
 
 static struct gatt_db_attribute *new_attribute(struct gatt_db_service *service,
@@ -199,14 +238,25 @@ static struct gatt_db_attribute *new_attribute(struct gatt_db_service *service,
 							uint16_t len)
 {
 	struct gatt_db_attribute *attribute;
+	struct static_attribute *slot = NULL;
+
+	if (service->static_attrs) {
+		if (service->static_used == service->num_handles)
+			return NULL;
 
-	attribute = new0(struct gatt_db_attribute, 1);
+		slot = &service->static_attrs[service->static_used++];
+		attribute = &slot->attr;
+	} else
+		attribute = new0(struct gatt_db_attribute, 1);
 
 	attribute->service = service;
 	attribute->handle = handle;
 	attribute->uuid = *type;
 	attribute->value_len = len;
-	if (len) {
+	if (slot && len && len <= sizeof(slot->value)) {
+		attribute->value = slot->value;
+		memcpy(attribute->value, val, len);
+	} else if (len) {
 		attribute->value = malloc0(len);
 		if (!attribute->value)
 			goto failed;
@@ -214,14 +264,10 @@ static struct gatt_db_attribute *new_attribute(struct gatt_db_service *service,
 		memcpy(attribute->value, val, len);
 	}
 
-	attribute->pending_reads = queue_new();
-	attribute->pending_writes = queue_new();
-	attribute->notify_list = queue_new();
-
 	return attribute;
 
 failed:
-	attribute_destroy(attribute);
+	discard_attribute(attribute);
 	return NULL;
 }
 
@@ -422,7 +468,9 @@ static void gatt_db_service_destroy(void *data)
 	for (i = 0; i < service->num_handles; i++)
 		attribute_destroy(service->attributes[i]);
 
-	free(service->attributes);
+	if (!service->static_attrs)
+		free(service->attributes);
+
 	free(service);
 }
 
@@ -466,6 +514,133 @@ bool gatt_db_isempty(struct gatt_db *db)
 	return queue_isempty(db->services);
 }
 
+static struct gatt_db_service *service_clone(struct gatt_db *db,
+					const struct gatt_db_service *orig)
+{
+	struct gatt_db_service *service;
+	int i;
+
+	service = new0(struct gatt_db_service, 1);
+	service->db = db;
+	service->active = orig->active;
+	service->claimed = orig->claimed;
+	service->num_handles = orig->num_handles;
+	service->attributes = new0(struct gatt_db_attribute *,
+							orig->num_handles);
+
+	for (i = 0; i < orig->num_handles; i++) {
+		const struct gatt_db_attribute *attr = orig->attributes[i];
+
+		if (!attr)
+			continue;
+
+		service->attributes[i] = new_attribute(service, attr->handle,
+							&attr->uuid, attr->value,
+							attr->value_len);
+		if (!service->attributes[i]) {
+			service->active = false;
+			gatt_db_service_destroy(service);
+			return NULL;
+		}
+
+		set_attribute_data(service->attributes[i], attr->read_func,
+					attr->write_func, attr->permissions,
+					attr->user_data);
+	}
+
+	return service;
+}
+
+/*
+ * Creates a database with the same services, handles and values as db.
+ * Registrations, pending operations and the authorize callback are not
+ * copied, so the clone can be modified without anyone else noticing.
+ */
+struct gatt_db *gatt_db_clone(struct gatt_db *db)
+{
+	const struct queue_entry *entry;
+	struct gatt_db *clone;
+
+	if (!db)
+		return NULL;
+
+	clone = gatt_db_new();
+	clone->next_handle = db->next_handle;
+
+	/* A pending update means the hash is stale, let it be regenerated */
+	if (!db->hash_id)
+		memcpy(clone->hash, db->hash, sizeof(clone->hash));
+
+	for (entry = queue_get_entries(db->services); entry;
+							entry = entry->next) {
+		struct gatt_db_service *service;
+
+		service = service_clone(clone, entry->data);
+		if (!service) {
+			gatt_db_unref(clone);
+			return NULL;
+		}
+
+		queue_push_tail(clone->services, service);
+	}
+
+	return clone;
+}
+
+static bool attribute_equal(const struct gatt_db_attribute *a,
+					const struct gatt_db_attribute *b)
+{
+	if (!a || !b)
+		return a == b;
+
+	if (a->handle != b->handle || a->permissions != b->permissions ||
+					a->value_len != b->value_len)
+		return false;
+
+	if (bt_uuid_cmp(&a->uuid, &b->uuid))
+		return false;
+
+	return !a->value_len || !memcmp(a->value, b->value, a->value_len);
+}
+
+static bool service_equal(const struct gatt_db_service *a,
+					const struct gatt_db_service *b)
+{
+	int i;
+
+	if (a->active != b->active || a->num_handles != b->num_handles)
+		return false;
+
+	for (i = 0; i < a->num_handles; i++) {
+		if (!attribute_equal(a->attributes[i], b->attributes[i]))
+			return false;
+	}
+
+	return true;
+}
+
+/*
+ * Compares the attributes stored in both databases, including values that
+ * are not covered by the Database Hash.
+ */
+bool gatt_db_equal(struct gatt_db *db1, struct gatt_db *db2)
+{
+	const struct queue_entry *a, *b;
+
+	if (!db1 || !db2)
+		return false;
+
+	a = queue_get_entries(db1->services);
+	b = queue_get_entries(db2->services);
+
+	for (; a && b; a = a->next, b = b->next) {
+		if (!service_equal(a->data, b->data))
+			return false;
+	}
+
+	return !a && !b;
+}
+
 static int uuid_to_le(const bt_uuid_t *uuid, uint8_t *dst)
 {
 	bt_uuid_t uuid128;
@@ -506,7 +681,8 @@ static bool le_to_uuid(const uint8_t *src, size_t len, bt_uuid_t *uuid)
 static struct gatt_db_service *gatt_db_service_create(const bt_uuid_t *uuid,
 							uint16_t handle,
 							bool primary,
-							uint16_t num_handles)
+							uint16_t num_handles,
+							bool fixed)
 {
 	struct gatt_db_service *service;
 	const bt_uuid_t *type;
@@ -516,8 +692,23 @@ static struct gatt_db_service *gatt_db_service_create(const bt_uuid_t *uuid,
 	if (num_handles < 1)
 		return NULL;
 
-	service = new0(struct gatt_db_service, 1);
-	service->attributes = new0(struct gatt_db_attribute *, num_handles);
+	if (fixed) {
+		/* Service, attribute table and attributes in one block */
+		service = malloc0(sizeof(*service) + num_handles *
+					(sizeof(struct gatt_db_attribute *) +
+					sizeof(struct static_attribute)));
+		if (!service)
+			return NULL;
+
+		service->attributes = (void *) (service + 1);
+		service->static_attrs = (void *) (service->attributes +
+								num_handles);
+		service->num_handles = num_handles;
+	} else {
+		service = new0(struct gatt_db_service, 1);
+		service->attributes = new0(struct gatt_db_attribute *,
+								num_handles);
+	}
 
 	if (primary)
 		type = &primary_service_uuid;
@@ -673,11 +864,12 @@ static struct gatt_db_service *find_insert_loc(struct gatt_db *db,
 	return NULL;
 }
 
-struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
+static struct gatt_db_attribute *insert_service(struct gatt_db *db,
 							uint16_t handle,
 							const bt_uuid_t *uuid,
 							bool primary,
-							uint16_t num_handles)
+							uint16_t num_handles,
+							bool fixed)
 {
 	struct gatt_db_service *service, *after;
 
@@ -715,7 +907,8 @@ struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
 		return NULL;
 	}
 
-	service = gatt_db_service_create(uuid, handle, primary, num_handles);
+	service = gatt_db_service_create(uuid, handle, primary, num_handles,
+									fixed);
 
 	if (!service)
 		return NULL;
@@ -741,6 +934,15 @@ fail:
 	return NULL;
 }
 
+struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
+							uint16_t handle,
+							const bt_uuid_t *uuid,
+							bool primary,
+							uint16_t num_handles)
+{
+	return insert_service(db, handle, uuid, primary, num_handles, false);
+}
+
 struct gatt_db_attribute *gatt_db_add_service(struct gatt_db *db,
 						const bt_uuid_t *uuid,
 						bool primary,
@@ -749,6 +951,29 @@ struct gatt_db_attribute *gatt_db_add_service(struct gatt_db *db,
 	return gatt_db_insert_service(db, 0, uuid, primary, num_handles);
 }
 
+/*
+ * Static services keep their attributes, and the declaration values, in a
+ * single allocation sized for num_handles attributes. They are meant for
+ * local services whose layout does not change once registered.
+ */
+struct gatt_db_attribute *gatt_db_insert_static_service(struct gatt_db *db,
+							uint16_t handle,
+							const bt_uuid_t *uuid,
+							bool primary,
+							uint16_t num_handles)
+{
+	return insert_service(db, handle, uuid, primary, num_handles, true);
+}
+
+struct gatt_db_attribute *gatt_db_add_static_service(struct gatt_db *db,
+							const bt_uuid_t *uuid,
+							bool primary,
+							uint16_t num_handles)
+{
+	return gatt_db_insert_static_service(db, 0, uuid, primary,
+								num_handles);
+}
+
 unsigned int gatt_db_register(struct gatt_db *db,
 					gatt_db_attribute_cb_t service_added,
 					gatt_db_attribute_cb_t service_removed,
@@ -884,7 +1109,8 @@ service_insert_characteristic(struct gatt_db_service *service,
 
 	service->attributes[i] = new_attribute(service, handle, uuid, NULL, 0);
 	if (!service->attributes[i]) {
-		free(service->attributes[i - 1]);
+		discard_attribute(service->attributes[i - 1]);
+		service->attributes[i - 1] = NULL;
 		return NULL;
 	}
 
@@ -1863,6 +2089,9 @@ bool gatt_db_attribute_read(struct gatt_db_attribute *attrib, uint16_t offset,
 		p->func = func;
 		p->user_data = user_data;
 
+		if (!attrib->pending_reads)
+			attrib->pending_reads = queue_new();
+
 		queue_push_tail(attrib->pending_reads, p);
 
 		attrib->read_func(attrib, p->id, offset, opcode, att,
@@ -1951,6 +2180,9 @@ bool gatt_db_attribute_write(struct gatt_db_attribute *attrib, uint16_t offset,
 		p->func = func;
 		p->user_data = user_data;
 
+		if (!attrib->pending_writes)
+			attrib->pending_writes = queue_new();
+
 		queue_push_tail(attrib->pending_writes, p);
 
 		attrib->write_func(attrib, p->id, offset, value, len, opcode,
@@ -1967,9 +2199,17 @@ bool gatt_db_attribute_write(struct gatt_db_attribute *attrib, uint16_t offset,
 				len > (unsigned) (attrib->value_len - offset)) {
 		void *buf;
 
-		buf = realloc(attrib->value, len + offset);
-		if (!buf)
-			return false;
+		if (value_is_inline(attrib)) {
+			buf = malloc(len + offset);
+			if (!buf)
+				return false;
+
+			memcpy(buf, attrib->value, attrib->value_len);
+		} else {
+			buf = realloc(attrib->value, len + offset);
+			if (!buf)
+				return false;
+		}
 
 		attrib->value = buf;
 
@@ -2014,7 +2254,8 @@ bool gatt_db_attribute_reset(struct gatt_db_attribute *attrib)
 	if (!attrib->value || !attrib->value_len)
 		return true;
 
-	free(attrib->value);
+	if (!value_is_inline(attrib))
+		free(attrib->value);
 	attrib->value = NULL;
 	attrib->value_len = 0;
 
@@ -2057,6 +2298,9 @@ unsigned int gatt_db_attribute_register(struct gatt_db_attribute *attrib,
 
 	notify->id = attrib->next_notify_id++;
 
+	if (!attrib->notify_list)
+		attrib->notify_list = queue_new();
+
 	if (!queue_push_tail(attrib->notify_list, notify)) {
 		free(notify);
 		return 0;
@@ -17,6 +17,8 @@ struct gatt_db *gatt_db_ref(struct gatt_db *db);
 void gatt_db_unref(struct gatt_db *db);
 
 bool gatt_db_isempty(struct gatt_db *db);
+struct gatt_db *gatt_db_clone(struct gatt_db *db);
+bool gatt_db_equal(struct gatt_db *db1, struct gatt_db *db2);
 
 struct gatt_db_attribute *gatt_db_add_service(struct gatt_db *db,
 						const bt_uuid_t *uuid,
@@ -37,6 +39,16 @@ struct gatt_db_attribute *gatt_db_insert_service(struct gatt_db *db,
 							bool primary,
 							uint16_t num_handles);
 
+struct gatt_db_attribute *gatt_db_add_static_service(struct gatt_db *db,
+							const bt_uuid_t *uuid,
+							bool primary,
+							uint16_t num_handles);
+struct gatt_db_attribute *gatt_db_insert_static_service(struct gatt_db *db,
+							uint16_t handle,
+							const bt_uuid_t *uuid,
+							bool primary,
+							uint16_t num_handles);
+
 typedef void (*gatt_db_read_t) (struct gatt_db_attribute *attrib,
 					unsigned int id, uint16_t offset,
 					uint8_t opcode, struct bt_att *att,
@@ -41,6 +41,24 @@
 
 #define NFY_MULT_TIMEOUT 10
 
+/*
+ * Number of attribute reads a Read By Type or Read Multiple request keeps in
+ * flight, the values are added to the response in handle order.
+ */
+#define MAX_CONCURRENT_READS 4
+
+struct async_read_op;
+
+struct async_read_result {
+	struct async_read_op *op;
+	struct gatt_db_attribute *attr;
+	uint16_t handle;
+	bool done;
+	uint8_t ecode;
+	uint8_t *value;
+	size_t len;
+};
+
 struct async_read_op {
 	struct bt_att_chan *chan;
 	struct bt_gatt_server *server;
@@ -49,7 +67,13 @@ struct async_read_op {
 	uint8_t *pdu;
 	size_t pdu_len;
 	size_t value_len;
-	struct queue *db_data;
+	uint16_t mtu;
+	struct async_read_result *results;
+	size_t num_results;
+	size_t issued;
+	size_t appended;
+	unsigned int pending;
+	bool processing;
 };
 
 struct async_write_op {
@@ -322,69 +346,48 @@ error:
 	bt_att_chan_send_error_rsp(chan, opcode, ehandle, ecode);
 }
 
-static void async_read_op_destroy(struct async_read_op *op)
+static struct async_read_op *async_read_op_new(struct bt_gatt_server *server,
+						struct bt_att_chan *chan,
+						uint8_t opcode,
+						size_t num_results)
 {
-	if (op->server)
-		op->server->pending_read_op = NULL;
+	struct async_read_op *op;
+	size_t i;
 
-	queue_destroy(op->db_data, NULL);
-	free(op->pdu);
-	free(op);
-}
+	op = new0(struct async_read_op, 1);
+	op->chan = chan;
+	op->opcode = opcode;
+	op->server = server;
+	op->mtu = bt_att_get_mtu(server->att);
+	op->pdu = new0(uint8_t, op->mtu);
+	op->num_results = num_results;
+	op->results = new0(struct async_read_result, num_results);
+
+	for (i = 0; i < num_results; i++)
+		op->results[i].op = op;
 
-static void process_read_by_type(struct async_read_op *op);
+	return op;
+}
 
-static void read_by_type_read_complete_cb(struct gatt_db_attribute *attr,
-						int err, const uint8_t *value,
-						size_t len, void *user_data)
+static void async_read_op_destroy(struct async_read_op *op)
 {
-	struct async_read_op *op = user_data;
-	struct bt_gatt_server *server = op->server;
-	uint16_t mtu;
-	uint16_t handle;
+	size_t i;
 
-	if (!server) {
-		async_read_op_destroy(op);
-		return;
-	}
+	if (op->server && op->server->pending_read_op == op)
+		op->server->pending_read_op = NULL;
 
-	mtu = bt_att_get_mtu(server->att);
-	handle = gatt_db_attribute_get_handle(attr);
+	op->server = NULL;
 
-	/* Terminate the operation if there was an error */
-	if (err) {
-		bt_att_chan_send_error_rsp(op->chan, BT_ATT_OP_READ_BY_TYPE_REQ,
-								handle, err);
-		async_read_op_destroy(op);
+	/* Reads still in flight complete into the results */
+	if (op->pending)
 		return;
-	}
 
-	if (op->pdu_len == 0) {
-		op->value_len = MIN(MIN((unsigned) mtu - 4, 253), len);
-		op->pdu[0] = op->value_len + 2;
-		op->pdu_len++;
-	} else if (len != op->value_len) {
-		op->done = true;
-		goto done;
-	}
+	for (i = 0; i < op->num_results; i++)
+		free(op->results[i].value);
 
-	/* Stop if this would surpass the MTU */
-	if (op->pdu_len + op->value_len + 2 > (unsigned) mtu - 1) {
-		op->done = true;
-		goto done;
-	}
-
-	/* Encode the current value */
-	put_le16(handle, op->pdu + op->pdu_len);
-	memcpy(op->pdu + op->pdu_len + 2, value, op->value_len);
-
-	op->pdu_len += op->value_len + 2;
-
-	if (op->pdu_len == (unsigned) mtu - 1)
-		op->done = true;
-
-done:
-	process_read_by_type(op);
+	free(op->results);
+	free(op->pdu);
+	free(op);
 }
 
 static bool check_min_key_size(uint8_t min_size, uint8_t size)
@@ -445,37 +448,197 @@ static uint8_t check_permissions(struct bt_gatt_server *server,
 	return 0;
 }
 
-static void process_read_by_type(struct async_read_op *op)
+static void append_read_by_type(struct async_read_op *op,
+					struct async_read_result *result)
 {
-	struct bt_gatt_server *server = op->server;
-	uint8_t ecode;
-	struct gatt_db_attribute *attr;
+	uint16_t mtu = op->mtu;
 
-	attr = queue_pop_head(op->db_data);
+	if (op->pdu_len == 0) {
+		op->value_len = MIN(MIN((unsigned) mtu - 4, 253), result->len);
+		op->pdu[0] = op->value_len + 2;
+		op->pdu_len++;
+	} else if (result->len != op->value_len) {
+		op->done = true;
+		return;
+	}
 
-	if (op->done || !attr) {
-		bt_att_chan_send_rsp(op->chan, BT_ATT_OP_READ_BY_TYPE_RSP,
-						op->pdu, op->pdu_len);
-		async_read_op_destroy(op);
+	/* Stop if this would surpass the MTU */
+	if (op->pdu_len + op->value_len + 2 > (unsigned) mtu - 1) {
+		op->done = true;
 		return;
 	}
 
-	ecode = check_permissions(server, attr, BT_ATT_PERM_READ |
+	/* Encode the current value */
+	put_le16(result->handle, op->pdu + op->pdu_len);
+	memcpy(op->pdu + op->pdu_len + 2, result->value, op->value_len);
+
+	op->pdu_len += op->value_len + 2;
+
+	if (op->pdu_len == (unsigned) mtu - 1)
+		op->done = true;
+}
+
+static void append_read_multiple(struct async_read_op *op,
+					struct async_read_result *result)
+{
+	size_t mtu = op->mtu;
+	uint16_t length;
+
+	length = op->opcode == BT_ATT_OP_READ_MULT_VL_REQ ?
+			MIN(result->len, MAX(mtu - op->pdu_len, 3) - 3) :
+			MIN(result->len, mtu - op->pdu_len - 1);
+
+	if (op->opcode == BT_ATT_OP_READ_MULT_VL_REQ) {
+		/* The Length Value Tuple List may be truncated within the first
+		 * two octets of a tuple due to the size limits of the current
+		 * ATT_MTU, but the first two octets cannot be separated.
+		 */
+		if (mtu - op->pdu_len >= 3) {
+			put_le16(result->len, op->pdu + op->pdu_len);
+			op->pdu_len += 2;
+		}
+	}
+
+	memcpy(op->pdu + op->pdu_len, result->value, length);
+	op->pdu_len += length;
+}
+
+static void process_read_results(struct async_read_op *op);
+
+static void read_result_complete_cb(struct gatt_db_attribute *attr, int err,
+					const uint8_t *value, size_t len,
+					void *user_data)
+{
+	struct async_read_result *result = user_data;
+	struct async_read_op *op = result->op;
+
+	op->pending--;
+
+	result->done = true;
+	result->ecode = err;
+
+	/* Nothing past the MTU ends up in the response */
+	if (op->server && !err && len) {
+		result->len = len;
+		result->value = malloc(MIN(len, op->mtu));
+		if (result->value)
+			memcpy(result->value, value, MIN(len, op->mtu));
+		else
+			result->ecode = BT_ATT_ERROR_INSUFFICIENT_RESOURCES;
+	}
+
+	process_read_results(op);
+}
+
+static void issue_read(struct async_read_op *op,
+					struct async_read_result *result)
+{
+	struct bt_gatt_server *server = op->server;
+
+	if (op->opcode != BT_ATT_OP_READ_BY_TYPE_REQ) {
+		util_debug(server->debug_callback, server->debug_data,
+				"%s Req - #%zu of %zu: 0x%04x",
+				op->opcode == BT_ATT_OP_READ_MULT_REQ ?
+				"Read Multiple" :
+				"Read Multiple Variable Length",
+				op->issued, op->num_results, result->handle);
+
+		result->attr = gatt_db_get_attribute(server->db,
+							result->handle);
+	}
+
+	if (!result->attr) {
+		result->ecode = BT_ATT_ERROR_INVALID_HANDLE;
+		goto done;
+	}
+
+	result->ecode = check_permissions(server, result->attr,
+						BT_ATT_PERM_READ |
 						BT_ATT_PERM_READ_AUTHEN |
 						BT_ATT_PERM_READ_ENCRYPT);
-	if (ecode)
-		goto error;
+	if (result->ecode)
+		goto done;
 
-	if (gatt_db_attribute_read(attr, 0, op->opcode, server->att,
-					read_by_type_read_complete_cb, op))
+	op->pending++;
+
+	if (gatt_db_attribute_read(result->attr, 0, op->opcode, server->att,
+					read_result_complete_cb, result))
 		return;
 
-	ecode = BT_ATT_ERROR_UNLIKELY;
+	op->pending--;
+	result->ecode = BT_ATT_ERROR_UNLIKELY;
 
-error:
-	bt_att_chan_send_error_rsp(op->chan, BT_ATT_OP_READ_BY_TYPE_REQ,
-				gatt_db_attribute_get_handle(attr), ecode);
-	async_read_op_destroy(op);
+done:
+	result->done = true;
+}
+
+/*
+ * Keeps up to MAX_CONCURRENT_READS reads in flight and adds the values to the
+ * response in handle order, the first error, or a value that does not fit,
+ * ends the request without waiting for the reads issued after it.
+ */
+static void process_read_results(struct async_read_op *op)
+{
+	struct async_read_result *result;
+
+	/* Reads completing while issuing are picked up by the loop below */
+	if (op->processing)
+		return;
+
+	op->processing = true;
+	op->pending++;
+
+	while (op->server) {
+		if (op->done || op->appended == op->num_results) {
+			bt_att_chan_send_rsp(op->chan, op->opcode + 1,
+						op->pdu, op->pdu_len);
+			async_read_op_destroy(op);
+			break;
+		}
+
+		result = &op->results[op->appended];
+
+		if (op->appended < op->issued && result->done) {
+			op->appended++;
+
+			/* Read By Type returns the values before the error */
+			if (result->ecode && op->pdu_len &&
+					op->opcode == BT_ATT_OP_READ_BY_TYPE_REQ) {
+				op->done = true;
+				continue;
+			}
+
+			if (result->ecode) {
+				bt_att_chan_send_error_rsp(op->chan,
+							op->opcode,
+							result->handle,
+							result->ecode);
+				async_read_op_destroy(op);
+				break;
+			}
+
+			if (op->opcode == BT_ATT_OP_READ_BY_TYPE_REQ)
+				append_read_by_type(op, result);
+			else
+				append_read_multiple(op, result);
+
+			free(result->value);
+			result->value = NULL;
+			continue;
+		}
+
+		if (op->issued == op->num_results ||
+				op->issued - op->appended >= MAX_CONCURRENT_READS)
+			break;
+
+		issue_read(op, &op->results[op->issued++]);
+	}
+
+	op->processing = false;
+	op->pending--;
+
+	if (!op->server)
+		async_read_op_destroy(op);
 }
 
 static void read_by_type_cb(struct bt_att_chan *chan, uint8_t opcode,
@@ -489,6 +652,7 @@ static void read_by_type_cb(struct bt_att_chan *chan, uint8_t opcode,
 	uint8_t ecode;
 	struct queue *q = NULL;
 	struct async_read_op *op;
+	size_t i;
 
 	if (length != 6 && length != 20) {
 		ecode = BT_ATT_ERROR_INVALID_PDU;
@@ -529,21 +693,19 @@ static void read_by_type_cb(struct bt_att_chan *chan, uint8_t opcode,
 		goto error;
 	}
 
-	op = new0(struct async_read_op, 1);
-	op->pdu = malloc(bt_att_get_mtu(server->att));
-	if (!op->pdu) {
-		free(op);
-		ecode = BT_ATT_ERROR_INSUFFICIENT_RESOURCES;
-		goto error;
+	op = async_read_op_new(server, chan, opcode, queue_length(q));
+
+	for (i = 0; i < op->num_results; i++) {
+		struct async_read_result *result = &op->results[i];
+
+		result->attr = queue_pop_head(q);
+		result->handle = gatt_db_attribute_get_handle(result->attr);
 	}
 
-	op->chan = chan;
-	op->opcode = opcode;
-	op->server = server;
-	op->db_data = q;
+	queue_destroy(q, NULL);
 	server->pending_read_op = op;
 
-	process_read_by_type(op);
+	process_read_results(op);
 
 	return;
 
@@ -1014,179 +1176,32 @@ static void read_blob_cb(struct bt_att_chan *chan, uint8_t opcode,
 	handle_read_req(chan, server, opcode, handle, offset);
 }
 
-struct read_mult_data {
-	struct bt_att_chan *chan;
-	struct bt_gatt_server *server;
-	uint8_t opcode;
-	uint16_t *handles;
-	size_t cur_handle;
-	size_t num_handles;
-	uint8_t *rsp_data;
-	size_t length;
-	size_t mtu;
-};
-
-static void read_mult_data_free(struct read_mult_data *data)
-{
-	free(data->handles);
-	free(data->rsp_data);
-	free(data);
-}
-
-static void read_multiple_complete_cb(struct gatt_db_attribute *attr, int err,
-					const uint8_t *value, size_t len,
-					void *user_data)
-{
-	struct read_mult_data *data = user_data;
-	struct gatt_db_attribute *next_attr;
-	uint16_t handle = gatt_db_attribute_get_handle(attr);
-	uint8_t ecode;
-	uint16_t length;
-
-	if (err != 0) {
-		ecode = err;
-		goto error;
-	}
-
-	length = data->opcode == BT_ATT_OP_READ_MULT_VL_REQ ?
-			MIN(len, MAX(data->mtu - data->length, 3) - 3) :
-			MIN(len, data->mtu - data->length - 1);
-
-	if (data->opcode == BT_ATT_OP_READ_MULT_VL_REQ) {
-		/* The Length Value Tuple List may be truncated within the first
-		 * two octets of a tuple due to the size limits of the current
-		 * ATT_MTU, but the first two octets cannot be separated.
-		 */
-		if (data->mtu - data->length >= 3) {
-			put_le16(len, data->rsp_data + data->length);
-			data->length += 2;
-		}
-	}
-
-	memcpy(data->rsp_data + data->length, value, length);
-	data->length += length;
-
-	data->cur_handle++;
-
-	if (data->cur_handle == data->num_handles) {
-		bt_att_chan_send_rsp(data->chan, data->opcode + 1,
-						data->rsp_data, data->length);
-		read_mult_data_free(data);
-		return;
-	}
-
-	handle = data->handles[data->cur_handle];
-
-	util_debug(data->server->debug_callback, data->server->debug_data,
-				"%s Req - #%zu of %zu: 0x%04x",
-				data->opcode == BT_ATT_OP_READ_MULT_REQ ?
-				"Read Multiple" :
-				"Read Multiple Variable Length",
-				data->cur_handle + 1, data->num_handles,
-				handle);
-
-	next_attr = gatt_db_get_attribute(data->server->db, handle);
-
-	if (!next_attr) {
-		ecode = BT_ATT_ERROR_INVALID_HANDLE;
-		goto error;
-	}
-
-	ecode = check_permissions(data->server, next_attr, BT_ATT_PERM_READ |
-						BT_ATT_PERM_READ_AUTHEN |
-						BT_ATT_PERM_READ_ENCRYPT);
-	if (ecode)
-		goto error;
-
-	if (gatt_db_attribute_read(next_attr, 0, data->opcode,
-					data->server->att,
-					read_multiple_complete_cb, data))
-		return;
-
-	ecode = BT_ATT_ERROR_UNLIKELY;
-
-error:
-	bt_att_chan_send_error_rsp(data->chan, data->opcode, handle, ecode);
-	read_mult_data_free(data);
-}
-
-static struct read_mult_data *read_mult_data_new(struct bt_gatt_server *server,
-						struct bt_att_chan *chan,
-						uint8_t opcode,
-						uint16_t num_handles)
-{
-	struct read_mult_data *data;
-
-	data = new0(struct read_mult_data, 1);
-	data->chan = chan;
-	data->opcode = opcode;
-	data->handles = new0(uint16_t, num_handles);
-	data->rsp_data = NULL;
-	data->server = server;
-	data->num_handles = num_handles;
-	data->cur_handle = 0;
-	data->mtu = bt_att_get_mtu(server->att);
-	data->length = 0;
-	data->rsp_data = new0(uint8_t, data->mtu - 1);
-
-	return data;
-}
-
 static void read_multiple_cb(struct bt_att_chan *chan, uint8_t opcode,
 					const void *pdu, uint16_t length,
 					void *user_data)
 {
 	struct bt_gatt_server *server = user_data;
-	struct gatt_db_attribute *attr;
-	struct read_mult_data *data = NULL;
-	uint8_t ecode;
-	size_t i = 0;
-	uint16_t handle = 0;
+	struct async_read_op *op;
+	size_t i;
 
 	if (length < 4) {
-		ecode = BT_ATT_ERROR_INVALID_PDU;
-		goto error;
+		bt_att_chan_send_error_rsp(chan, opcode, 0,
+						BT_ATT_ERROR_INVALID_PDU);
+		return;
 	}
 
-	data = read_mult_data_new(server, chan, opcode, length / 2);
-	if (!data)
-		goto error;
-
-	for (i = 0; i < data->num_handles; i++)
-		data->handles[i] = get_le16(pdu + i * 2);
+	op = async_read_op_new(server, chan, opcode, length / 2);
 
-	handle = data->handles[0];
+	for (i = 0; i < op->num_results; i++)
+		op->results[i].handle = get_le16(pdu + i * 2);
 
 	util_debug(server->debug_callback, server->debug_data,
 			"%s Req - %zu handles, 1st: 0x%04x",
-			data->opcode == BT_ATT_OP_READ_MULT_REQ ?
+			opcode == BT_ATT_OP_READ_MULT_REQ ?
 			"Read Multiple" : "Read Multiple Variable Length",
-			data->num_handles, handle);
-
-	attr = gatt_db_get_attribute(server->db, handle);
+			op->num_results, op->results[0].handle);
 
-	if (!attr) {
-		ecode = BT_ATT_ERROR_INVALID_HANDLE;
-		goto error;
-	}
-
-	ecode = check_permissions(data->server, attr, BT_ATT_PERM_READ |
-						BT_ATT_PERM_READ_AUTHEN |
-						BT_ATT_PERM_READ_ENCRYPT);
-	if (ecode)
-		goto error;
-
-	if (gatt_db_attribute_read(attr, 0, opcode, server->att,
-					read_multiple_complete_cb, data))
-		return;
-
-	ecode = BT_ATT_ERROR_UNLIKELY;
-
-error:
-	if (data)
-		read_mult_data_free(data);
-
-	bt_att_chan_send_error_rsp(chan, opcode, handle, ecode);
+	process_read_results(op);
 }
 
 static bool append_prep_data(struct prep_write_data *prep_data, uint16_t handle,
@@ -12,7 +12,10 @@
 #include <config.h>
 #endif
 
+#define _GNU_SOURCE
+
 #include <stdio.h>
+#include <errno.h>
 #include <unistd.h>
 #include <string.h>
 #include <sys/socket.h>
@@ -34,6 +37,13 @@ struct sockaddr_hci {
 #define HCI_CHANNEL_RAW		0
 #define HCI_CHANNEL_USER	1
 
+/* Packets read per syscall and batches read per wakeup, so a flood of
+ * events does not starve the rest of the mainloop.
+ */
+#define HCI_READ_SIZE		512
+#define HCI_READ_BATCH		16
+#define HCI_READ_MAX_BATCHES	4
+
 #define SOL_HCI		0
 #define HCI_FILTER	2
 struct hci_filter {
@@ -53,6 +63,8 @@ struct bt_hci {
 	struct queue *cmd_queue;
 	struct queue *rsp_queue;
 	struct queue *evt_list;
+	struct queue *evt_table[UINT8_MAX + 1];
+	struct queue *le_table[UINT8_MAX + 1];
 };
 
 struct cmd {
@@ -68,6 +80,7 @@ struct cmd {
 struct evt {
 	unsigned int id;
 	uint8_t event;
+	struct queue *queue;
 	bt_hci_callback_func_t callback;
 	bt_hci_destroy_func_t destroy;
 	void *user_data;
@@ -197,14 +210,34 @@ static void process_response(struct bt_hci *hci, uint16_t opcode,
 	bt_hci_unref(hci);
 }
 
+struct notify_data {
+	const void *data;
+	uint8_t size;
+};
+
 static void process_notify(void *data, void *user_data)
 {
-	struct bt_hci_evt_hdr *hdr = user_data;
+	struct notify_data *notify = user_data;
 	struct evt *evt = data;
 
-	if (evt->event == hdr->evt)
-		evt->callback(user_data + sizeof(struct bt_hci_evt_hdr),
-						hdr->plen, evt->user_data);
+	evt->callback(notify->data, notify->size, evt->user_data);
+}
+
+static void process_le_meta(struct bt_hci *hci, const void *data,
+								size_t size)
+{
+	struct notify_data notify;
+	uint8_t subevent;
+
+	if (size < 1)
+		return;
+
+	subevent = *((const uint8_t *) data);
+
+	notify.data = data + 1;
+	notify.size = size - 1;
+
+	queue_foreach(hci->le_table[subevent], process_notify, &notify);
 }
 
 static void process_event(struct bt_hci *hci, const void *data, size_t size)
@@ -212,6 +245,7 @@ static void process_event(struct bt_hci *hci, const void *data, size_t size)
 	const struct bt_hci_evt_hdr *hdr = data;
 	const struct bt_hci_evt_cmd_complete *cc;
 	const struct bt_hci_evt_cmd_status *cs;
+	struct notify_data notify;
 
 	if (size < sizeof(struct bt_hci_evt_hdr))
 		return;
@@ -242,7 +276,27 @@ static void process_event(struct bt_hci *hci, const void *data, size_t size)
 		break;
 
 	default:
-		queue_foreach(hci->evt_list, process_notify, (void *) hdr);
+		notify.data = data;
+		notify.size = size;
+
+		queue_foreach(hci->evt_table[hdr->evt], process_notify,
+								&notify);
+
+		if (hdr->evt == BT_HCI_EVT_LE_META_EVENT)
+			process_le_meta(hci, data, size);
+		break;
+	}
+}
+
+static void process_packet(struct bt_hci *hci, const uint8_t *buf,
+								size_t len)
+{
+	if (len < 1)
+		return;
+
+	switch (buf[0]) {
+	case BT_H4_EVT_PKT:
+		process_event(hci, buf + 1, len - 1);
 		break;
 	}
 }
@@ -250,9 +304,11 @@ static void process_event(struct bt_hci *hci, const void *data, size_t size)
 static bool io_read_callback(struct io *io, void *user_data)
 {
 	struct bt_hci *hci = user_data;
-	uint8_t buf[512];
-	ssize_t len;
-	int fd;
+	uint8_t buf[HCI_READ_BATCH][HCI_READ_SIZE];
+	struct iovec iov[HCI_READ_BATCH];
+	struct mmsghdr msg[HCI_READ_BATCH];
+	bool result = true;
+	int fd, batch, count, i;
 
 	fd = io_get_fd(hci->io);
 	if (fd < 0)
@@ -261,20 +317,38 @@ static bool io_read_callback(struct io *io, void *user_data)
 	if (hci->is_stream)
 		return false;
 
-	len = read(fd, buf, sizeof(buf));
-	if (len < 0)
-		return false;
+	memset(msg, 0, sizeof(msg));
 
-	if (len < 1)
-		return true;
+	for (i = 0; i < HCI_READ_BATCH; i++) {
+		iov[i].iov_base = buf[i];
+		iov[i].iov_len = HCI_READ_SIZE;
+		msg[i].msg_hdr.msg_iov = &iov[i];
+		msg[i].msg_hdr.msg_iovlen = 1;
+	}
 
-	switch (buf[0]) {
-	case BT_H4_EVT_PKT:
-		process_event(hci, buf + 1, len - 1);
-		break;
+	/* Take a reference since a callback can unref the last reference
+	 * of the user, in which case the remaining packets are dropped.
+	 */
+	bt_hci_ref(hci);
+
+	for (batch = 0; batch < HCI_READ_MAX_BATCHES; batch++) {
+		count = recvmmsg(fd, msg, HCI_READ_BATCH, MSG_DONTWAIT, NULL);
+		if (count < 0) {
+			if (batch == 0 && errno != EAGAIN && errno != EINTR)
+				result = false;
+			break;
+		}
+
+		for (i = 0; i < count && hci->ref_count > 1; i++)
+			process_packet(hci, buf[i], msg[i].msg_len);
+
+		if (count < HCI_READ_BATCH || hci->ref_count == 1)
+			break;
 	}
 
-	return true;
+	bt_hci_unref(hci);
+
+	return result;
 }
 
 static struct bt_hci *create_hci(int fd)
@@ -414,12 +488,19 @@ struct bt_hci *bt_hci_ref(struct bt_hci *hci)
 
 void bt_hci_unref(struct bt_hci *hci)
 {
+	int i;
+
 	if (!hci)
 		return;
 
 	if (__sync_sub_and_fetch(&hci->ref_count, 1))
 		return;
 
+	for (i = 0; i <= UINT8_MAX; i++) {
+		queue_destroy(hci->evt_table[i], NULL);
+		queue_destroy(hci->le_table[i], NULL);
+	}
+
 	queue_destroy(hci->evt_list, evt_free);
 	queue_destroy(hci->cmd_queue, cmd_free);
 	queue_destroy(hci->rsp_queue, cmd_free);
@@ -527,17 +608,21 @@ bool bt_hci_flush(struct bt_hci *hci)
 	return true;
 }
 
-unsigned int bt_hci_register(struct bt_hci *hci, uint8_t event,
-				bt_hci_callback_func_t callback,
+static unsigned int register_evt(struct bt_hci *hci, struct queue **table,
+				uint8_t event, bt_hci_callback_func_t callback,
 				void *user_data, bt_hci_destroy_func_t destroy)
 {
 	struct evt *evt;
 
-	if (!hci)
+	if (!hci || !callback)
 		return 0;
 
+	if (!table[event])
+		table[event] = queue_new();
+
 	evt = new0(struct evt, 1);
 	evt->event = event;
+	evt->queue = table[event];
 
 	if (hci->next_evt_id < 1)
 		hci->next_evt_id = 1;
@@ -553,9 +638,33 @@ unsigned int bt_hci_register(struct bt_hci *hci, uint8_t event,
 		return 0;
 	}
 
+	queue_push_tail(evt->queue, evt);
+
 	return evt->id;
 }
 
+unsigned int bt_hci_register(struct bt_hci *hci, uint8_t event,
+				bt_hci_callback_func_t callback,
+				void *user_data, bt_hci_destroy_func_t destroy)
+{
+	if (!hci)
+		return 0;
+
+	return register_evt(hci, hci->evt_table, event, callback, user_data,
+								destroy);
+}
+
+unsigned int bt_hci_register_le_meta(struct bt_hci *hci, uint8_t subevent,
+				bt_hci_callback_func_t callback,
+				void *user_data, bt_hci_destroy_func_t destroy)
+{
+	if (!hci)
+		return 0;
+
+	return register_evt(hci, hci->le_table, subevent, callback, user_data,
+								destroy);
+}
+
 static bool match_evt_id(const void *a, const void *b)
 {
 	const struct evt *evt = a;
@@ -575,6 +684,8 @@ bool bt_hci_unregister(struct bt_hci *hci, unsigned int id)
 	if (!evt)
 		return false;
 
+	queue_remove(evt->queue, evt);
+
 	evt_free(evt);
 
 	return true;
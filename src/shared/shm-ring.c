@@ -0,0 +1,430 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/un.h>
+#include <linux/memfd.h>
+
+#include "src/shared/util.h"
+#include "src/shared/shm-ring.h"
+
+#define SHM_RING_MAGIC		0x474e5242	/* "BRNG" */
+#define SHM_RING_VERSION	1
+#define SHM_RING_MIN_SIZE	4096
+
+#define REC_ALIGN(len)		(((len) + 15) & ~((size_t) 15))
+#define REC_FLAG_PAD		0x0001
+
+/*
+ * Shared header at the start of the mapping. Positions are byte offsets
+ * that only ever grow, the offset into the data area is the position
+ * modulo its size.
+ */
+struct shm_ring_hdr {
+	uint32_t magic;
+	uint32_t version;
+	uint64_t size;		/* size of the data area */
+	uint64_t head;		/* end of the last complete record */
+	uint64_t reserve;	/* end of the record being written */
+	uint64_t tail;		/* start of the oldest complete record */
+	uint64_t seq;		/* sequence number of the next record */
+	uint8_t  padding[16];
+} __attribute__ ((packed));
+
+struct shm_ring_rec {
+	uint32_t len;		/* payload length */
+	uint16_t flags;
+	uint16_t reserved;
+	uint64_t seq;
+} __attribute__ ((packed));
+
+struct shm_ring {
+	int fd;
+	bool writer;
+	struct shm_ring_hdr *hdr;
+	uint8_t *data;
+	size_t size;
+	size_t map_len;
+	uint64_t pos;		/* read position, or tail for the writer */
+	uint64_t overruns;
+};
+
+static size_t align_power2(size_t u)
+{
+	size_t size = SHM_RING_MIN_SIZE;
+
+	while (size < u)
+		size <<= 1;
+
+	return size;
+}
+
+static struct shm_ring *ring_map(int fd, size_t map_len, bool writer)
+{
+	struct shm_ring *ring;
+	void *ptr;
+
+	ptr = mmap(NULL, map_len, writer ? PROT_READ | PROT_WRITE : PROT_READ,
+							MAP_SHARED, fd, 0);
+	if (ptr == MAP_FAILED)
+		return NULL;
+
+	ring = new0(struct shm_ring, 1);
+	ring->fd = fd;
+	ring->writer = writer;
+	ring->hdr = ptr;
+	ring->data = (uint8_t *) ptr + sizeof(struct shm_ring_hdr);
+	ring->size = map_len - sizeof(struct shm_ring_hdr);
+	ring->map_len = map_len;
+
+	return ring;
+}
+
+struct shm_ring *shm_ring_new(const char *name, size_t size)
+{
+	struct shm_ring *ring;
+	size_t map_len;
+	int fd;
+
+	size = align_power2(size);
+	map_len = sizeof(struct shm_ring_hdr) + size;
+
+	fd = syscall(SYS_memfd_create, name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+	if (fd < 0)
+		return NULL;
+
+	if (ftruncate(fd, map_len) < 0) {
+		close(fd);
+		return NULL;
+	}
+
+#ifdef F_ADD_SEALS
+	/* Readers map the whole file, make sure it can't change size */
+	fcntl(fd, F_ADD_SEALS, F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_SEAL);
+#endif
+
+	ring = ring_map(fd, map_len, true);
+	if (!ring) {
+		close(fd);
+		return NULL;
+	}
+
+	ring->hdr->magic = SHM_RING_MAGIC;
+	ring->hdr->version = SHM_RING_VERSION;
+	ring->hdr->size = size;
+
+	return ring;
+}
+
+struct shm_ring *shm_ring_attach(int fd)
+{
+	struct shm_ring *ring;
+	struct stat st;
+
+	if (fstat(fd, &st) < 0)
+		return NULL;
+
+	if ((size_t) st.st_size < sizeof(struct shm_ring_hdr) +
+							SHM_RING_MIN_SIZE)
+		return NULL;
+
+	ring = ring_map(fd, st.st_size, false);
+	if (!ring)
+		return NULL;
+
+	if (ring->hdr->magic != SHM_RING_MAGIC ||
+			ring->hdr->version != SHM_RING_VERSION ||
+			ring->hdr->size != ring->size ||
+			(ring->size & (ring->size - 1))) {
+		munmap(ring->hdr, ring->map_len);
+		free(ring);
+		return NULL;
+	}
+
+	/* Start with the oldest packet still available */
+	ring->pos = __atomic_load_n(&ring->hdr->tail, __ATOMIC_ACQUIRE);
+
+	return ring;
+}
+
+void shm_ring_free(struct shm_ring *ring)
+{
+	if (!ring)
+		return;
+
+	munmap(ring->hdr, ring->map_len);
+	close(ring->fd);
+
+	free(ring);
+}
+
+int shm_ring_get_fd(struct shm_ring *ring)
+{
+	if (!ring)
+		return -1;
+
+	return ring->fd;
+}
+
+size_t shm_ring_get_size(struct shm_ring *ring)
+{
+	if (!ring)
+		return 0;
+
+	return ring->size;
+}
+
+bool shm_ring_write(struct shm_ring *ring, const struct iovec *iov,
+								int iovcnt)
+{
+	struct shm_ring_hdr *hdr;
+	struct shm_ring_rec rec;
+	uint64_t head, reserve;
+	size_t len = 0, stride, offset, pad = 0;
+	int i;
+
+	if (!ring || !ring->writer)
+		return false;
+
+	for (i = 0; i < iovcnt; i++)
+		len += iov[i].iov_len;
+
+	stride = REC_ALIGN(sizeof(rec) + len);
+	if (stride > ring->size / 4)
+		return false;
+
+	hdr = ring->hdr;
+	head = hdr->head;
+	offset = head & (ring->size - 1);
+
+	/* Records never wrap, fill the end of the area with padding */
+	if (ring->size - offset < stride)
+		pad = ring->size - offset;
+
+	reserve = head + pad + stride;
+
+	/* Drop the oldest records about to be overwritten */
+	while (reserve - ring->pos > ring->size) {
+		memcpy(&rec, ring->data + (ring->pos & (ring->size - 1)),
+								sizeof(rec));
+		ring->pos += REC_ALIGN(sizeof(rec) + rec.len);
+	}
+
+	__atomic_store_n(&hdr->tail, ring->pos, __ATOMIC_RELAXED);
+	__atomic_store_n(&hdr->reserve, reserve, __ATOMIC_RELAXED);
+
+	/*
+	 * Readers that observe any of the data written below are
+	 * guaranteed to also observe the new reserve position.
+	 */
+	__atomic_thread_fence(__ATOMIC_RELEASE);
+
+	if (pad) {
+		memset(&rec, 0, sizeof(rec));
+		rec.len = pad - sizeof(rec);
+		rec.flags = REC_FLAG_PAD;
+		memcpy(ring->data + offset, &rec, sizeof(rec));
+		offset = 0;
+	}
+
+	memset(&rec, 0, sizeof(rec));
+	rec.len = len;
+	rec.seq = hdr->seq;
+	memcpy(ring->data + offset, &rec, sizeof(rec));
+	offset += sizeof(rec);
+
+	for (i = 0; i < iovcnt; i++) {
+		memcpy(ring->data + offset, iov[i].iov_base, iov[i].iov_len);
+		offset += iov[i].iov_len;
+	}
+
+	__atomic_store_n(&hdr->seq, rec.seq + 1, __ATOMIC_RELAXED);
+	__atomic_store_n(&hdr->head, reserve, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+ssize_t shm_ring_read(struct shm_ring *ring, void *buf, size_t size,
+								uint64_t *seq)
+{
+	const struct shm_ring_hdr *hdr;
+	struct shm_ring_rec rec;
+	uint64_t head, reserve;
+	size_t offset, stride;
+
+	if (!ring || ring->writer)
+		return -EINVAL;
+
+	hdr = ring->hdr;
+
+	while (1) {
+		head = __atomic_load_n(&hdr->head, __ATOMIC_ACQUIRE);
+		if (ring->pos == head)
+			return -EAGAIN;
+
+		if (head - ring->pos > ring->size)
+			goto overrun;
+
+		offset = ring->pos & (ring->size - 1);
+		memcpy(&rec, ring->data + offset, sizeof(rec));
+
+		/* A torn header means the writer has lapped this reader */
+		stride = REC_ALIGN(sizeof(rec) + rec.len);
+		if (stride > ring->size / 4 || offset + stride > ring->size)
+			goto overrun;
+
+		if (!(rec.flags & REC_FLAG_PAD) && rec.len <= size)
+			memcpy(buf, ring->data + offset + sizeof(rec), rec.len);
+
+		__atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+		reserve = __atomic_load_n(&hdr->reserve, __ATOMIC_RELAXED);
+		if (reserve - ring->pos > ring->size)
+			goto overrun;
+
+		ring->pos += stride;
+
+		if (rec.flags & REC_FLAG_PAD)
+			continue;
+
+		if (rec.len > size)
+			return -EMSGSIZE;
+
+		if (seq)
+			*seq = rec.seq;
+
+		return rec.len;
+
+overrun:
+		ring->overruns++;
+		ring->pos = __atomic_load_n(&hdr->tail, __ATOMIC_ACQUIRE);
+	}
+}
+
+uint64_t shm_ring_get_overruns(struct shm_ring *ring)
+{
+	if (!ring)
+		return 0;
+
+	return ring->overruns;
+}
+
+bool shm_ring_send_fd(struct shm_ring *ring, int sk)
+{
+	uint8_t version = SHM_RING_VERSION;
+	uint8_t control[CMSG_SPACE(sizeof(int))];
+	struct cmsghdr *cmsg;
+	struct msghdr msg;
+	struct iovec iov;
+
+	if (!ring)
+		return false;
+
+	iov.iov_base = &version;
+	iov.iov_len = sizeof(version);
+
+	memset(&msg, 0, sizeof(msg));
+	memset(control, 0, sizeof(control));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_SOCKET;
+	cmsg->cmsg_type = SCM_RIGHTS;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(int));
+	memcpy(CMSG_DATA(cmsg), &ring->fd, sizeof(int));
+
+	return sendmsg(sk, &msg, MSG_NOSIGNAL) == sizeof(version);
+}
+
+static int recv_fd(int sk)
+{
+	uint8_t version;
+	uint8_t control[CMSG_SPACE(sizeof(int))];
+	struct cmsghdr *cmsg;
+	struct msghdr msg;
+	struct iovec iov;
+	int fd = -1;
+
+	iov.iov_base = &version;
+	iov.iov_len = sizeof(version);
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = control;
+	msg.msg_controllen = sizeof(control);
+
+	if (recvmsg(sk, &msg, MSG_CMSG_CLOEXEC) != sizeof(version))
+		return -1;
+
+	for (cmsg = CMSG_FIRSTHDR(&msg); cmsg;
+					cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+		if (cmsg->cmsg_level == SOL_SOCKET &&
+					cmsg->cmsg_type == SCM_RIGHTS) {
+			memcpy(&fd, CMSG_DATA(cmsg), sizeof(fd));
+			break;
+		}
+	}
+
+	if (fd >= 0 && version != SHM_RING_VERSION) {
+		close(fd);
+		return -1;
+	}
+
+	return fd;
+}
+
+struct shm_ring *shm_ring_connect(const char *path)
+{
+	struct shm_ring *ring;
+	struct sockaddr_un addr;
+	int sk, fd;
+
+	if (strlen(path) > sizeof(addr.sun_path) - 1)
+		return NULL;
+
+	sk = socket(PF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (sk < 0)
+		return NULL;
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, path);
+
+	if (connect(sk, (struct sockaddr *) &addr, sizeof(addr)) < 0) {
+		close(sk);
+		return NULL;
+	}
+
+	fd = recv_fd(sk);
+	close(sk);
+
+	if (fd < 0)
+		return NULL;
+
+	ring = shm_ring_attach(fd);
+	if (!ring)
+		close(fd);
+
+	return ring;
+}
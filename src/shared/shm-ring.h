@@ -0,0 +1,44 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+
+/*
+ * Single producer, multiple consumer packet ring living in a memfd.
+ *
+ * The producer never waits for consumers: each consumer keeps its own read
+ * position and detects overruns through gaps in the sequence numbers.
+ */
+struct shm_ring;
+
+/* Packet layout used by btmon when publishing captured traffic */
+struct shm_ring_hci_hdr {
+	uint16_t index;
+	uint16_t opcode;
+	uint32_t reserved;
+	uint64_t timestamp;	/* microseconds since the epoch */
+} __attribute__ ((packed));
+
+struct shm_ring *shm_ring_new(const char *name, size_t size);
+struct shm_ring *shm_ring_attach(int fd);
+void shm_ring_free(struct shm_ring *ring);
+
+int shm_ring_get_fd(struct shm_ring *ring);
+size_t shm_ring_get_size(struct shm_ring *ring);
+
+bool shm_ring_write(struct shm_ring *ring, const struct iovec *iov,
+								int iovcnt);
+
+ssize_t shm_ring_read(struct shm_ring *ring, void *buf, size_t size,
+								uint64_t *seq);
+uint64_t shm_ring_get_overruns(struct shm_ring *ring);
+
+bool shm_ring_send_fd(struct shm_ring *ring, int sk);
+struct shm_ring *shm_ring_connect(const char *path);
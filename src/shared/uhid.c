@@ -14,6 +14,7 @@
 
 #define _GNU_SOURCE
 #include <stdio.h>
+#include <stddef.h>
 #include <unistd.h>
 #include <string.h>
 #include <errno.h>
@@ -233,3 +234,35 @@ int bt_uhid_send(struct bt_uhid *uhid, const struct uhid_event *ev)
 	/* uHID kernel driver does not handle partial writes */
 	return len != sizeof(*ev) ? -EIO : 0;
 }
+
+int bt_uhid_input(struct bt_uhid *uhid, const void *data, size_t size)
+{
+	struct uhid_event ev;
+	ssize_t len;
+	struct iovec iov;
+
+	if (!uhid->io)
+		return -ENOTCONN;
+
+	if (size > sizeof(ev.u.input2.data))
+		return -EMSGSIZE;
+
+	/* Only the header and the report itself are written, the kernel
+	 * zero-fills the remainder of the event so there is no need to
+	 * initialize the whole structure.
+	 */
+	ev.type = UHID_INPUT2;
+	ev.u.input2.size = size;
+
+	if (size > 0)
+		memcpy(ev.u.input2.data, data, size);
+
+	iov.iov_base = &ev;
+	iov.iov_len = offsetof(struct uhid_event, u.input2.data) + size;
+
+	len = io_send(uhid->io, &iov, 1);
+	if (len < 0)
+		return len;
+
+	return (size_t) len != iov.iov_len ? -EIO : 0;
+}
@@ -14,6 +14,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "monitor/bt.h"
 #include "src/shared/hci.h"
@@ -920,6 +921,87 @@ static void test_reset_in_advertising_state(const void *test_data)
 	tester_wait(5, test_reset_in_advertising_state_timeout, NULL);
 }
 
+#define ADV_FLOOD_ROUNDS 1000
+
+static struct {
+	unsigned int rounds;
+	unsigned int reports;
+	struct timespec start;
+} adv_flood;
+
+static void test_adv_flood_report(const void *data, uint8_t size,
+							void *user_data)
+{
+	struct user_data *user = tester_get_data();
+	const struct bt_hci_evt_le_adv_report *lar = data;
+	struct timespec now;
+	long msec;
+
+	if (memcmp(lar->addr, user->bdaddr_ut, 6))
+		return;
+
+	if (++adv_flood.reports < ADV_FLOOD_ROUNDS)
+		return;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	msec = (now.tv_sec - adv_flood.start.tv_sec) * 1000 +
+			(now.tv_nsec - adv_flood.start.tv_nsec) / 1000000;
+
+	tester_print("%u advertising reports in %ld ms", adv_flood.reports,
+									msec);
+
+	tester_test_passed();
+}
+
+static void test_adv_flood_toggle(void);
+
+static void test_adv_flood_enabled(const void *data, uint8_t size,
+							void *user_data)
+{
+	uint8_t status = *((uint8_t *) data);
+
+	if (status) {
+		tester_warn("Failed to enable advertising (0x%02x)", status);
+		tester_test_failed();
+		return;
+	}
+
+	if (++adv_flood.rounds < ADV_FLOOD_ROUNDS)
+		test_adv_flood_toggle();
+}
+
+/* Every time advertising is enabled the emulator reports it to scanners */
+static void test_adv_flood_toggle(void)
+{
+	struct user_data *user = tester_get_data();
+	struct bt_hci_cmd_le_set_adv_enable lsae;
+
+	lsae.enable = 0x00;
+
+	bt_hci_send(user->hci_ut, BT_HCI_CMD_LE_SET_ADV_ENABLE,
+					&lsae, sizeof(lsae), NULL, NULL, NULL);
+
+	lsae.enable = 0x01;
+
+	bt_hci_send(user->hci_ut, BT_HCI_CMD_LE_SET_ADV_ENABLE,
+					&lsae, sizeof(lsae),
+					test_adv_flood_enabled, NULL, NULL);
+}
+
+static void test_adv_report_flood(const void *test_data)
+{
+	struct user_data *user = tester_get_data();
+
+	memset(&adv_flood, 0, sizeof(adv_flood));
+	clock_gettime(CLOCK_MONOTONIC, &adv_flood.start);
+
+	bt_hci_register_le_meta(user->hci_lt, BT_HCI_EVT_LE_ADV_REPORT,
+					test_adv_flood_report, NULL, NULL);
+
+	test_adv_flood_toggle();
+}
+
 int main(int argc, char *argv[])
 {
 	tester_init(&argc, &argv);
@@ -969,5 +1051,9 @@ int main(int argc, char *argv[])
 				setup_advertising_initiated,
 				test_reset_in_advertising_state, NULL);
 
+	test_hci("LE Advertising Report Flood", NULL,
+				setup_advertising_initiated,
+				test_adv_report_flood, NULL);
+
 	return tester_run();
 }
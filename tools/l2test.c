@@ -307,6 +307,11 @@ bool use_color(void)
 	return false;
 }
 
+FILE *display_file(void)
+{
+	return stdout;
+}
+
 static const struct bitfield_data phy_table[] = {
 	{  0, "BR1M1SLOT" },
 	{  1, "BR1M3SLOT" },
@@ -58,8 +58,7 @@ while (<>) {
         $name =~ s/"/\\"/g; # escape double quotes
         my $id = hex($identifier);
         if ($id != 65535) {
-            print "\tcase $id:\n";
-            print "\t\treturn \"$name\";\n";
+            print "\t[$id] = \"$name\",\n";
         }
         $next_is_name = 0;
     }
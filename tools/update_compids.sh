@@ -1,7 +1,8 @@
 #!/bin/bash
 # SPDX-License-Identifier: GPL-2.0-or-later
 # Download the list of company IDs from bluetooth.org and generate a diff which
-# can be applied to source tree to update bt_compidtostr(). Usage:
+# can be applied to source tree to update the table used by bt_compidtostr().
+# Usage:
 #
 # 1) ./tools/update_compids.sh | git apply -p0
 # 2) Inspect changes to make sure they are sane
@@ -22,21 +23,20 @@ cp lib/bluetooth.c $tmpdir/lib/bluetooth.c
 
 cd $tmpdir
 
-echo -e 'const char *bt_compidtostr(int compid)\n{\n\tswitch (compid) {' > new.c
+echo -e 'static const char *compids[] = {' > new.c
 
 path=specifications/assigned-numbers/company-identifiers/
 # Use "iconv -c" to strip unwanted unicode characters
 curl --insecure https://www.bluetooth.com/$path | \
     $scriptdir/tools/parse_companies.pl >> new.c
 
-if ! grep -q "return \"" new.c; then
+if ! grep -q "\] = \"" new.c; then
     echo "ERROR: could not parse company IDs from bluetooth.org" >&2
     exit 1
 fi
-echo -e '\tcase 65535:\n\t\treturn "internal use";' >> new.c
-echo -e '\tdefault:\n\t\treturn "not assigned";\n\t}\n}' >> new.c
+echo -e '};' >> new.c
 
-sed -n '/^const char \*bt_compidtostr(int compid)/,/^}/p' \
+sed -n '/^static const char \*compids\[\] = {/,/^};/p' \
     lib/bluetooth.c > old.c
 
 diff -Naur old.c new.c | patch -sp0 lib/bluetooth.c
@@ -16,8 +16,10 @@
 #include <string.h>
 #include <unistd.h>
 #include <fcntl.h>
+#include <time.h>
 
 #include "src/shared/ecc.h"
+#include "src/shared/ecc-pool.h"
 #include "src/shared/util.h"
 #include "src/shared/tester.h"
 
@@ -261,6 +263,222 @@ static void test_invalid_pub(const void *data)
 	tester_test_passed();
 }
 
+struct public_key_vector {
+	uint8_t priv[32];
+	uint8_t pub[64];
+};
+
+/* Scalars hitting the first and last comb columns and windows */
+static const struct public_key_vector public_key_vectors[] = {
+	{
+		.priv = {	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		},
+		.pub = {	0x96, 0xc2, 0x98, 0xd8, 0x45, 0x39, 0xa1, 0xf4,
+				0xa0, 0x33, 0xeb, 0x2d, 0x81, 0x7d, 0x03, 0x77,
+				0xf2, 0x40, 0xa4, 0x63, 0xe5, 0xe6, 0xbc, 0xf8,
+				0x47, 0x42, 0x2c, 0xe1, 0xf2, 0xd1, 0x17, 0x6b,
+
+				0xf5, 0x51, 0xbf, 0x37, 0x68, 0x40, 0xb6, 0xcb,
+				0xce, 0x5e, 0x31, 0x6b, 0x57, 0x33, 0xce, 0x2b,
+				0x16, 0x9e, 0x0f, 0x7c, 0x4a, 0xeb, 0xe7, 0x8e,
+				0x9b, 0x7f, 0x1a, 0xfe, 0xe2, 0x42, 0xe3, 0x4f,
+		},
+	},
+	{
+		.priv = {	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		},
+		.pub = {	0x78, 0x99, 0x66, 0x47, 0xfc, 0x48, 0x0b, 0xa6,
+				0x35, 0x1b, 0xf2, 0x77, 0xe2, 0x69, 0x89, 0xc0,
+				0xc3, 0x1a, 0xb5, 0x04, 0x03, 0x38, 0x52, 0x8a,
+				0x7e, 0x4f, 0x03, 0x8d, 0x18, 0x7b, 0xf2, 0x7c,
+
+				0xd1, 0x73, 0x78, 0x22, 0x9d, 0xb7, 0x04, 0x9e,
+				0x29, 0x82, 0xe9, 0x3c, 0xe6, 0xad, 0x7d, 0xba,
+				0xdb, 0x30, 0x74, 0x9f, 0xc6, 0x9a, 0x3d, 0x29,
+				0x40, 0xd0, 0x8e, 0xdb, 0x10, 0x55, 0x77, 0x07,
+		},
+	},
+	{
+		.priv = {	0x50, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3,
+				0x84, 0x9e, 0x17, 0xa7, 0xad, 0xfa, 0xe6, 0xbc,
+				0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+				0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+		},
+		.pub = {	0x96, 0xc2, 0x98, 0xd8, 0x45, 0x39, 0xa1, 0xf4,
+				0xa0, 0x33, 0xeb, 0x2d, 0x81, 0x7d, 0x03, 0x77,
+				0xf2, 0x40, 0xa4, 0x63, 0xe5, 0xe6, 0xbc, 0xf8,
+				0x47, 0x42, 0x2c, 0xe1, 0xf2, 0xd1, 0x17, 0x6b,
+
+				0x0a, 0xae, 0x40, 0xc8, 0x97, 0xbf, 0x49, 0x34,
+				0x31, 0xa1, 0xce, 0x94, 0xa9, 0xcc, 0x31, 0xd4,
+				0xe9, 0x61, 0xf0, 0x83, 0xb5, 0x14, 0x18, 0x71,
+				0x65, 0x80, 0xe5, 0x01, 0x1c, 0xbd, 0x1c, 0xb0,
+		},
+	},
+	{
+		.priv = {	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+				0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+		},
+		.pub = {	0x1a, 0x16, 0x15, 0xf8, 0xf9, 0x36, 0xc4, 0xfa,
+				0x4c, 0xd5, 0xa3, 0x2d, 0x95, 0x16, 0xa3, 0x6a,
+				0xf1, 0xc8, 0x2d, 0xc6, 0xf8, 0x76, 0x4b, 0xdb,
+				0x40, 0x0c, 0x06, 0x1c, 0x3c, 0x03, 0x08, 0xf8,
+
+				0x72, 0xbf, 0xa8, 0x46, 0x86, 0xcc, 0x79, 0xe9,
+				0x3f, 0x5a, 0x67, 0x6a, 0x83, 0xbf, 0x3c, 0xa8,
+				0xd1, 0x61, 0x26, 0xaf, 0xdd, 0xae, 0xbb, 0x5e,
+				0x35, 0xcc, 0x8f, 0x3c, 0x92, 0xe7, 0xf4, 0x4c,
+		},
+	},
+	{
+		.priv = {	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+				0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		},
+		.pub = {	0x16, 0xca, 0x94, 0x15, 0xce, 0x2b, 0xaa, 0x03,
+				0x81, 0x32, 0x5c, 0xa0, 0x69, 0x1a, 0xb4, 0x85,
+				0x0a, 0x0e, 0x96, 0xe6, 0x19, 0x35, 0xd4, 0xad,
+				0x1d, 0xce, 0x41, 0x92, 0x94, 0x3b, 0xf0, 0x6f,
+
+				0x4a, 0x14, 0x1c, 0xf7, 0xce, 0x89, 0xb9, 0x82,
+				0x22, 0x6e, 0xa9, 0x25, 0x7d, 0xff, 0xc6, 0x40,
+				0x8b, 0xe7, 0xee, 0xc7, 0xb0, 0xc0, 0xf6, 0x53,
+				0xdc, 0x01, 0xbf, 0x55, 0x3a, 0x75, 0x4f, 0x3c,
+		},
+	},
+};
+
+static void test_public_key(const void *data)
+{
+	unsigned int i;
+
+	for (i = 0; i < ARRAY_SIZE(public_key_vectors); i++) {
+		const struct public_key_vector *v = &public_key_vectors[i];
+		uint8_t g[64], pub[64], secret[32];
+
+		g_assert(ecc_make_public_key(v->priv, pub));
+
+		if (memcmp(pub, v->pub, sizeof(pub))) {
+			print_buf("Private key = ", (uint8_t *) v->priv, 32);
+			print_buf("Public key = ", pub, sizeof(pub));
+			g_assert_not_reached();
+		}
+
+		/* The variable base path must agree with the generator one */
+		memcpy(g, public_key_vectors[0].pub, sizeof(g));
+		g_assert(ecdh_shared_secret(g, v->priv, secret));
+		g_assert(!memcmp(secret, v->pub, sizeof(secret)));
+	}
+
+	tester_test_passed();
+}
+
+static void test_public_key_multi(const void *data)
+{
+	const uint8_t *g = public_key_vectors[0].pub;
+	uint8_t public[64], private[32], secret[32];
+	int i;
+
+	for (i = 0; i < PAIR_COUNT; i++) {
+		g_assert(ecc_make_key(public, private));
+		g_assert(ecc_valid_public_key(public));
+
+		g_assert(ecdh_shared_secret(g, private, secret));
+		g_assert(!memcmp(secret, public, sizeof(secret)));
+	}
+
+	tester_test_passed();
+}
+
+#define BENCHMARK_COUNT 100
+
+static double elapsed(const struct timespec *start)
+{
+	struct timespec now;
+
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start->tv_sec) +
+				(now.tv_nsec - start->tv_nsec) / 1e9;
+}
+
+static void test_benchmark(const void *data)
+{
+	uint8_t public1[64], public2[64];
+	uint8_t private1[32], private2[32];
+	uint8_t secret[32];
+	struct timespec start;
+	double secs;
+	int i;
+
+	ecc_make_key(public2, private2);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < BENCHMARK_COUNT; i++)
+		g_assert(ecc_make_key(public1, private1));
+
+	secs = elapsed(&start);
+	tester_debug("%.0f keypairs/sec", BENCHMARK_COUNT / secs);
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	for (i = 0; i < BENCHMARK_COUNT; i++)
+		g_assert(ecdh_shared_secret(public2, private1, secret));
+
+	secs = elapsed(&start);
+	tester_debug("%.0f ECDH/sec", BENCHMARK_COUNT / secs);
+
+	tester_test_passed();
+}
+
+#define POOL_DEPTH 4
+
+static void test_pool(const void *data)
+{
+	uint8_t public[POOL_DEPTH * 3][64];
+	uint8_t private[POOL_DEPTH * 3][32];
+	struct ecc_pool *pool;
+	int i, j;
+
+	pool = ecc_pool_new(POOL_DEPTH);
+	g_assert(pool);
+
+	/* Drain the pool past its depth, falling back to in place keys */
+	for (i = 0; i < POOL_DEPTH * 3; i++) {
+		g_assert(ecc_pool_get(pool, public[i], private[i]));
+		g_assert(ecc_valid_public_key(public[i]));
+	}
+
+	/* Every keypair is handed out only once */
+	for (i = 0; i < POOL_DEPTH * 3; i++) {
+		for (j = i + 1; j < POOL_DEPTH * 3; j++)
+			g_assert(memcmp(private[i], private[j], 32));
+	}
+
+	/* The worker refills the pool in the background */
+	for (i = 0; i < 1000 && ecc_pool_get_count(pool) < POOL_DEPTH; i++)
+		usleep(1000);
+
+	g_assert(ecc_pool_get_count(pool) == POOL_DEPTH);
+
+	tester_debug("%u keys generated in place",
+					ecc_pool_get_misses(pool));
+
+	ecc_pool_free(pool);
+
+	tester_test_passed();
+}
+
 int main(int argc, char *argv[])
 {
 	tester_init(&argc, &argv);
@@ -273,5 +491,13 @@ int main(int argc, char *argv[])
 
 	tester_add("/ecdh/invalid", NULL, NULL, test_invalid_pub, NULL);
 
+	tester_add("/ecc/public_key", NULL, NULL, test_public_key, NULL);
+	tester_add("/ecc/public_key/multi", NULL, NULL, test_public_key_multi,
+									NULL);
+
+	tester_add("/ecc/pool", NULL, NULL, test_pool, NULL);
+
+	tester_add("/ecdh/benchmark", NULL, NULL, test_benchmark, NULL);
+
 	return tester_run();
 }
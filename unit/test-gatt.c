@@ -18,6 +18,7 @@
 #include <inttypes.h>
 #include <string.h>
 #include <fcntl.h>
+#include <malloc.h>
 #include <sys/socket.h>
 
 #include <glib.h>
@@ -60,6 +61,8 @@ struct context {
 	struct bt_att *att;
 	struct gatt_db *client_db;
 	struct gatt_db *server_db;
+	struct gatt_db *split_db;
+	unsigned int split_services;
 	guint source;
 	guint process;
 	int fd;
@@ -336,6 +339,7 @@ static void destroy_context(struct context *context)
 	bt_gatt_server_unref(context->server);
 	gatt_db_unref(context->client_db);
 	gatt_db_unref(context->server_db);
+	gatt_db_unref(context->split_db);
 
 	if (context->att)
 		bt_att_unref(context->att);
@@ -615,18 +619,27 @@ static void match_services(struct gatt_db_attribute *client_serv_attr,
 static void client_ready_cb(bool success, uint8_t att_ecode, void *user_data)
 {
 	struct context *context = user_data;
+	struct gatt_db *db = context->client_db;
 
 	g_assert(success);
 
+	/* Discovery has to be stored in the copy, not in the shared db */
+	if (context->split_db) {
+		g_assert(gatt_db_isempty(context->client_db));
+		g_assert(bt_gatt_client_get_db(context->client) ==
+							context->split_db);
+		db = context->split_db;
+	}
+
 	if (!context->data->source_db) {
 		context_quit(context);
 		return;
 	}
 
 	g_assert(context->client);
-	g_assert(context->client_db);
+	g_assert(db);
 
-	gatt_db_foreach_service(context->client_db, NULL, match_services,
+	gatt_db_foreach_service(db, NULL, match_services,
 						context->data->source_db);
 
 	if (context->data->step) {
@@ -1361,7 +1374,8 @@ struct att_handle_spec {
 	}
 
 
-static struct gatt_db *make_db(const struct att_handle_spec *spec)
+static struct gatt_db *make_db_layout(const struct att_handle_spec *spec,
+								bool fixed)
 {
 	struct gatt_db *db = gatt_db_new();
 	struct gatt_db_attribute *att, *include_att;
@@ -1378,8 +1392,15 @@ static struct gatt_db *make_db(const struct att_handle_spec *spec)
 			if (att)
 				gatt_db_service_set_active(att, true);
 
-			att = gatt_db_insert_service(db, spec->handle, &uuid,
-					spec->type == PRIMARY, spec->len);
+			if (fixed)
+				att = gatt_db_insert_static_service(db,
+						spec->handle, &uuid,
+						spec->type == PRIMARY,
+						spec->len);
+			else
+				att = gatt_db_insert_service(db, spec->handle,
+						&uuid, spec->type == PRIMARY,
+						spec->len);
 			break;
 
 		case INCLUDE:
@@ -1415,6 +1436,11 @@ static struct gatt_db *make_db(const struct att_handle_spec *spec)
 	return db;
 }
 
+static struct gatt_db *make_db(const struct att_handle_spec *spec)
+{
+	return make_db_layout(spec, false);
+}
+
 static struct gatt_db *make_service_data_1_db(void)
 {
 	const struct att_handle_spec specs[] = {
@@ -1547,7 +1573,7 @@ static struct gatt_db *make_service_data_3_db(void)
  *     (although not in scrambled order)
  */
 
-static struct gatt_db *make_test_spec_small_db(void)
+static struct gatt_db *make_test_spec_small_db(bool fixed)
 {
 	const struct att_handle_spec specs[] = {
 		SECONDARY_SERVICE(0x0001, DEVICE_INFORMATION_UUID, 16),
@@ -1583,7 +1609,7 @@ static struct gatt_db *make_test_spec_small_db(void)
 		{ }
 	};
 
-	return make_db(specs);
+	return make_db_layout(specs, fixed);
 }
 
 /*
@@ -1613,7 +1639,7 @@ static struct gatt_db *make_test_spec_small_db(void)
 			"11111222223333344444555556666677777888889999900000" \
 			"111112222233"
 
-static struct gatt_db *make_test_spec_large_db_1(void)
+static struct gatt_db *make_test_spec_large_db_1(bool fixed)
 {
 	const struct att_handle_spec specs[] = {
 		PRIMARY_SERVICE(0x0080, "a00b", 7),
@@ -1892,14 +1918,322 @@ static struct gatt_db *make_test_spec_large_db_1(void)
 		{ }
 	};
 
-	return make_db(specs);
+	return make_db_layout(specs, fixed);
+}
+
+/*
+ * Characteristics whose value reads complete from the main loop, in the
+ * reverse order they were issued in. The value is the value handle, except
+ * for the characteristic at DEFERRED_ERROR_HANDLE which fails.
+ */
+#define DEFERRED_ERROR_HANDLE 0x000b
+
+struct deferred_read {
+	struct gatt_db_attribute *attrib;
+	unsigned int id;
+};
+
+static GSList *deferred_reads;
+
+static gboolean complete_deferred_reads(gpointer user_data)
+{
+	GSList *reads = deferred_reads, *l;
+
+	/* Reads issued from the completions below are deferred again */
+	deferred_reads = NULL;
+
+	for (l = reads; l; l = g_slist_next(l)) {
+		struct deferred_read *read = l->data;
+		uint16_t handle = gatt_db_attribute_get_handle(read->attrib);
+		uint8_t value[2];
+
+		put_le16(handle, value);
+
+		gatt_db_attribute_read_result(read->attrib, read->id,
+					handle == DEFERRED_ERROR_HANDLE ?
+					0x80 : 0, value, sizeof(value));
+	}
+
+	g_slist_free_full(reads, g_free);
+
+	return FALSE;
+}
+
+static void deferred_read_cb(struct gatt_db_attribute *attrib,
+					unsigned int id, uint16_t offset,
+					uint8_t opcode, struct bt_att *att,
+					void *user_data)
+{
+	struct deferred_read *read;
+
+	if (!deferred_reads)
+		g_idle_add(complete_deferred_reads, NULL);
+
+	read = g_new0(struct deferred_read, 1);
+	read->attrib = attrib;
+	read->id = id;
+
+	deferred_reads = g_slist_prepend(deferred_reads, read);
+}
+
+static struct gatt_db *make_deferred_read_db(void)
+{
+	struct gatt_db *db = gatt_db_new();
+	struct gatt_db_attribute *service;
+	bt_uuid_t uuid;
+	int i;
+
+	bt_uuid16_create(&uuid, 0xb010);
+	service = gatt_db_insert_service(db, 0x0001, &uuid, true, 13);
+
+	/* Value handles 0x0003, 0x0005 ... 0x000d */
+	bt_uuid16_create(&uuid, 0xb011);
+	for (i = 0; i < 6; i++)
+		g_assert(gatt_db_service_add_characteristic(service, &uuid,
+						BT_ATT_PERM_READ,
+						BT_GATT_CHRC_PROP_READ,
+						deferred_read_cb, NULL, NULL));
+
+	gatt_db_service_set_active(service, true);
+
+	return db;
+}
+
+static void test_static_full(gconstpointer data)
+{
+	struct gatt_db *db;
+	struct gatt_db_attribute *service, *attr;
+	bt_uuid_t uuid;
+
+	db = gatt_db_new();
+
+	/* Room for the declaration, one characteristic and one descriptor */
+	bt_uuid16_create(&uuid, 0x1800);
+	service = gatt_db_add_static_service(db, &uuid, true, 4);
+	g_assert(service);
+
+	bt_uuid16_create(&uuid, 0x2a00);
+	attr = gatt_db_service_add_characteristic(service, &uuid,
+						BT_ATT_PERM_READ,
+						BT_GATT_CHRC_PROP_READ,
+						NULL, NULL, NULL);
+	g_assert(attr);
+
+	/* A characteristic takes two handles, only one is left */
+	bt_uuid16_create(&uuid, 0x2a01);
+	attr = gatt_db_service_add_characteristic(service, &uuid,
+						BT_ATT_PERM_READ,
+						BT_GATT_CHRC_PROP_READ,
+						NULL, NULL, NULL);
+	g_assert(!attr);
+
+	/* The failed insert must not have used up the last slot */
+	bt_uuid16_create(&uuid, GATT_CLIENT_CHARAC_CFG_UUID);
+	attr = gatt_db_service_add_descriptor(service, &uuid,
+						BT_ATT_PERM_READ, NULL, NULL,
+						NULL);
+	g_assert(attr);
+	g_assert_cmpint(gatt_db_attribute_get_handle(attr), ==, 4);
+
+	attr = gatt_db_service_add_descriptor(service, &uuid,
+						BT_ATT_PERM_READ, NULL, NULL,
+						NULL);
+	g_assert(!attr);
+
+	gatt_db_unref(db);
+
+	tester_test_passed();
+}
+
+/* mallinfo2 does not see allocations made through the sanitizers */
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33) && \
+					!defined(__SANITIZE_ADDRESS__)
+#define DB_MEMORY_COUNT 16
+
+/* Heap in use per database, averaged over a few instances */
+static size_t db_heap_size(struct gatt_db *(*make_func)(bool fixed),
+								bool fixed)
+{
+	struct gatt_db *dbs[DB_MEMORY_COUNT];
+	struct mallinfo2 before, after;
+	int i;
+
+	before = mallinfo2();
+
+	for (i = 0; i < DB_MEMORY_COUNT; i++)
+		dbs[i] = make_func(fixed);
+
+	after = mallinfo2();
+
+	for (i = 0; i < DB_MEMORY_COUNT; i++)
+		gatt_db_unref(dbs[i]);
+
+	return (after.uordblks - before.uordblks) / DB_MEMORY_COUNT;
+}
+
+static void test_static_memory(gconstpointer data)
+{
+	size_t dynamic_size, static_size;
+
+	dynamic_size = db_heap_size(make_test_spec_large_db_1, false);
+	static_size = db_heap_size(make_test_spec_large_db_1, true);
+
+	tester_debug("Large database: %zu bytes, %zu bytes static",
+						dynamic_size, static_size);
+
+	g_assert(static_size < dynamic_size);
+
+	tester_test_passed();
+}
+
+#define SHARED_DB_PEERS 128
+
+/* Heap of identical peripherals with a database each or a shared one */
+static void test_shared_memory(gconstpointer data)
+{
+	struct gatt_db *db, *dbs[SHARED_DB_PEERS];
+	struct mallinfo2 before, after;
+	size_t private_size, shared_size;
+	int i;
+
+	db = make_test_spec_large_db_1(false);
+
+	before = mallinfo2();
+
+	for (i = 0; i < SHARED_DB_PEERS; i++)
+		dbs[i] = gatt_db_clone(db);
+
+	after = mallinfo2();
+	private_size = after.uordblks - before.uordblks;
+
+	for (i = 0; i < SHARED_DB_PEERS; i++)
+		gatt_db_unref(dbs[i]);
+
+	gatt_db_unref(db);
+
+	before = mallinfo2();
+
+	db = make_test_spec_large_db_1(false);
+
+	for (i = 0; i < SHARED_DB_PEERS; i++)
+		dbs[i] = gatt_db_ref(db);
+
+	after = mallinfo2();
+	shared_size = after.uordblks - before.uordblks;
+
+	for (i = 0; i < SHARED_DB_PEERS; i++)
+		gatt_db_unref(dbs[i]);
+
+	gatt_db_unref(db);
+
+	tester_debug("%d peripherals: %zu bytes private, %zu bytes shared",
+				SHARED_DB_PEERS, private_size, shared_size);
+
+	/* Sharing costs about as much as a single private copy */
+	g_assert(shared_size < 2 * private_size / SHARED_DB_PEERS);
+
+	tester_test_passed();
 }
+#endif
 
 static void test_client(gconstpointer data)
 {
 	create_context(512, data);
 }
 
+static void shared_service_added(struct gatt_db_attribute *attrib,
+							void *user_data)
+{
+	/* Nothing may change in the db other devices still use */
+	g_assert_not_reached();
+}
+
+static void split_service_added(struct gatt_db_attribute *attrib,
+							void *user_data)
+{
+	struct context *context = user_data;
+	uint16_t handle = gatt_db_attribute_get_handle(attrib);
+
+	g_assert(gatt_db_get_attribute(context->split_db, handle) == attrib);
+
+	context->split_services++;
+}
+
+static void count_service(struct gatt_db_attribute *attrib, void *user_data)
+{
+	unsigned int *count = user_data;
+
+	(*count)++;
+}
+
+static struct gatt_db *split_client_db(struct gatt_db *db, void *user_data)
+{
+	struct context *context = user_data;
+
+	g_assert(db == context->client_db);
+	g_assert(!context->split_db);
+
+	context->split_db = gatt_db_clone(db);
+
+	/* Users of the db, e.g. the D-Bus objects, move over to the copy */
+	gatt_db_register(context->split_db, split_service_added, NULL,
+							context, NULL);
+
+	return context->split_db;
+}
+
+static void test_split_db(struct context *context)
+{
+	unsigned int count = 0;
+
+	g_assert(context->split_db);
+
+	gatt_db_foreach_service(context->split_db, NULL, count_service,
+								&count);
+	g_assert_cmpint(count, >, 0);
+	g_assert_cmpint(context->split_services, ==, count);
+
+	context_quit(context);
+}
+
+static const struct test_step test_split = {
+	.func = test_split_db,
+};
+
+static void test_client_split(gconstpointer data)
+{
+	struct context *context = create_context(512, data);
+
+	gatt_db_register(context->client_db, shared_service_added, NULL,
+							context, NULL);
+	bt_gatt_client_set_db_split(context->client, split_client_db, context,
+									NULL);
+}
+
+static void test_clone(gconstpointer data)
+{
+	struct gatt_db *db = make_test_spec_small_db(false);
+	struct gatt_db *clone, *reference;
+
+	clone = gatt_db_clone(db);
+	reference = gatt_db_clone(db);
+
+	g_assert(clone && reference);
+	g_assert(gatt_db_equal(db, clone));
+
+	/* Modifying the clone leaves the original untouched */
+	gatt_db_remove_service(clone, gatt_db_get_attribute(clone, 0x0001));
+
+	g_assert(!gatt_db_equal(db, clone));
+	g_assert(gatt_db_equal(db, reference));
+
+	gatt_db_unref(reference);
+	gatt_db_unref(clone);
+	gatt_db_unref(db);
+
+	tester_test_passed();
+}
+
 static void test_server(gconstpointer data)
 {
 	struct context *context = create_context(512, data);
@@ -2335,15 +2669,20 @@ static const struct test_step test_indication_server_1 = {
 int main(int argc, char *argv[])
 {
 	struct gatt_db *service_db_1, *service_db_2, *service_db_3;
-	struct gatt_db *ts_small_db, *ts_large_db_1;
+	struct gatt_db *ts_small_db, *ts_small_static_db, *ts_large_db_1;
+	struct gatt_db *ts_small_clone_db;
+	struct gatt_db *deferred_read_db;
 
 	tester_init(&argc, &argv);
 
 	service_db_1 = make_service_data_1_db();
 	service_db_2 = make_service_data_2_db();
 	service_db_3 = make_service_data_3_db();
-	ts_small_db = make_test_spec_small_db();
-	ts_large_db_1 = make_test_spec_large_db_1();
+	ts_small_db = make_test_spec_small_db(false);
+	ts_small_static_db = make_test_spec_small_db(true);
+	ts_large_db_1 = make_test_spec_large_db_1(false);
+	ts_small_clone_db = gatt_db_clone(ts_small_db);
+	deferred_read_db = make_deferred_read_db();
 
 	/*
 	 * Server Configuration
@@ -4472,5 +4811,99 @@ int main(int argc, char *argv[])
 			raw_pdu(0xff, 0x00),
 			raw_pdu());
 
+	/*
+	 * Values of compound reads complete out of order and the response
+	 * has to follow the handle order, up to the first failing read.
+	 */
+	define_test_server("/concurrent-read/read-by-type", test_server,
+			deferred_read_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x08, 0x01, 0x00, 0x0a, 0x00, 0x11, 0xb0),
+			raw_pdu(0x09, 0x04, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00,
+				0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00,
+				0x09, 0x00));
+
+	define_test_server("/concurrent-read/read-by-type/error", test_server,
+			deferred_read_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x08, 0x01, 0x00, 0xff, 0xff, 0x11, 0xb0),
+			raw_pdu(0x09, 0x04, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00,
+				0x05, 0x00, 0x07, 0x00, 0x07, 0x00, 0x09, 0x00,
+				0x09, 0x00),
+			raw_pdu(0x08, 0x0a, 0x00, 0xff, 0xff, 0x11, 0xb0),
+			raw_pdu(0x01, 0x08, 0x0b, 0x00, 0x80));
+
+	define_test_server("/concurrent-read/read-multiple", test_server,
+			deferred_read_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x0e, 0x0d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x05,
+				0x00, 0x07, 0x00),
+			raw_pdu(0x0f, 0x0d, 0x00, 0x03, 0x00, 0x09, 0x00, 0x05,
+				0x00, 0x07, 0x00));
+
+	define_test_server("/concurrent-read/read-multiple/error",
+			test_server, deferred_read_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x0e, 0x03, 0x00, 0x0b, 0x00, 0x05, 0x00),
+			raw_pdu(0x01, 0x0e, 0x0b, 0x00, 0x80));
+
+	/*
+	 * Static services have to be indistinguishable from the ones built
+	 * attribute by attribute.
+	 */
+	define_test_server("/static-service/discover-primary", test_server,
+			ts_small_static_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			PRIMARY_DISC_SMALL_DB);
+
+	define_test_server("/static-service/read", test_server,
+			ts_small_static_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x0a, 0x03, 0x00),
+			raw_pdu(0x0b, 0x42, 0x6c, 0x75, 0x65, 0x5a));
+
+	define_test_server("/static-service/read-by-type", test_server,
+			ts_small_static_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x08, 0x01, 0x00, 0xFF, 0xFF, 0xef, 0xcd, 0xab,
+					0x89, 0x67, 0x45, 0x23, 0x01, 0x00,
+					0x00, 0x00, 0x00, 0x09, 0xB0, 0x00,
+					0x00),
+			raw_pdu(0x09, 0x03, 0x15, 0xF0, 0x09),
+			raw_pdu(0x08, 0x01, 0x00, 0xFF, 0xFF, 0x01, 0x2a),
+			raw_pdu(0x09, 0x04, 0x18, 0xF0, 0x00, 0x00));
+
+	tester_add("/static-service/full", NULL, NULL, test_static_full, NULL);
+
+#ifdef DB_MEMORY_COUNT
+	tester_add("/static-service/memory", NULL, NULL, test_static_memory,
+									NULL);
+#endif
+
+	/*
+	 * Databases shared by identical peripherals are cloned before being
+	 * modified, clones have to behave exactly as the original.
+	 */
+	tester_add("/shared-db/clone", NULL, NULL, test_clone, NULL);
+
+	define_test_server("/shared-db/clone/discover-primary", test_server,
+			ts_small_clone_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			PRIMARY_DISC_SMALL_DB);
+
+	define_test_server("/shared-db/clone/read", test_server,
+			ts_small_clone_db, NULL,
+			raw_pdu(0x03, 0x00, 0x02),
+			raw_pdu(0x0a, 0x03, 0x00),
+			raw_pdu(0x0b, 0x42, 0x6c, 0x75, 0x65, 0x5a));
+
+	define_test_client("/shared-db/split", test_client_split, service_db_1,
+			&test_split,
+			SERVICE_DATA_1_PDUS);
+
+#ifdef DB_MEMORY_COUNT
+	tester_add("/shared-db/memory", NULL, NULL, test_shared_memory, NULL);
+#endif
+
 	return tester_run();
 }
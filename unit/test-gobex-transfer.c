@@ -2321,6 +2321,184 @@ static void test_conn_put_req_seq_srm(void)
 	g_assert_no_error(d.err);
 }
 
+#define THROUGHPUT_SIZE	(8 * 1024 * 1024)
+
+struct throughput_data {
+	GMainLoop *mainloop;
+	GError *err;
+	gint64 start;
+	gsize sent;
+	gsize received;
+	guint packets;
+};
+
+static gboolean throughput_timeout(gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	t->err = g_error_new(TEST_ERROR, TEST_ERROR_TIMEOUT, "Timed out");
+	g_main_loop_quit(t->mainloop);
+
+	return FALSE;
+}
+
+static void throughput_complete(GObex *obex, GError *err, gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	if (err != NULL && t->err == NULL)
+		t->err = g_error_copy(err);
+
+	g_main_loop_quit(t->mainloop);
+}
+
+static void throughput_rsp_complete(GObex *obex, GError *err,
+							gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	if (err != NULL && t->err == NULL)
+		t->err = g_error_copy(err);
+}
+
+static gssize provide_throughput(void *buf, gsize len, gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	if (t->sent >= THROUGHPUT_SIZE)
+		return 0;
+
+	len = MIN(len, THROUGHPUT_SIZE - t->sent);
+	memset(buf, 0xaa, len);
+
+	t->sent += len;
+	t->packets++;
+
+	return len;
+}
+
+static gboolean rcv_throughput(const void *buf, gsize len, gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	t->received += len;
+
+	return TRUE;
+}
+
+static void handle_conn_throughput(GObex *obex, GObexPacket *req,
+							gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+	GObexPacket *rsp;
+
+	rsp = g_obex_packet_new(G_OBEX_RSP_SUCCESS, TRUE, G_OBEX_HDR_INVALID);
+	g_obex_send(obex, rsp, &t->err);
+}
+
+static void handle_put_throughput(GObex *obex, GObexPacket *req,
+							gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	if (g_obex_put_rsp(obex, req, rcv_throughput, throughput_rsp_complete,
+					t, &t->err, G_OBEX_HDR_INVALID) == 0)
+		g_main_loop_quit(t->mainloop);
+}
+
+static void conn_complete_throughput(GObex *obex, GError *err,
+					GObexPacket *rsp, gpointer user_data)
+{
+	struct throughput_data *t = user_data;
+
+	if (err != NULL) {
+		t->err = g_error_copy(err);
+		g_main_loop_quit(t->mainloop);
+		return;
+	}
+
+	t->start = g_get_monotonic_time();
+
+	if (g_obex_put_req(obex, provide_throughput, throughput_complete, t,
+					&t->err, G_OBEX_HDR_NAME, "random.bin",
+					G_OBEX_HDR_INVALID) == 0)
+		g_main_loop_quit(t->mainloop);
+}
+
+static GObex *create_throughput_gobex(int fd, int sock_type)
+{
+	GObexTransportType transport_type;
+	GIOChannel *io;
+	GObex *obex;
+
+	if (sock_type == SOCK_STREAM)
+		transport_type = G_OBEX_TRANSPORT_STREAM;
+	else
+		transport_type = G_OBEX_TRANSPORT_PACKET;
+
+	io = g_io_channel_unix_new(fd);
+	g_io_channel_set_close_on_unref(io, TRUE);
+
+	/* Largest OBEX packets, as negotiated over L2CAP with a big MTU */
+	obex = g_obex_new(io, transport_type, 65535, 65535);
+	g_io_channel_unref(io);
+
+	g_assert(obex != NULL);
+
+	return obex;
+}
+
+/* Measures a PUT of THROUGHPUT_SIZE bytes between two GObex instances */
+static void test_put_throughput(gconstpointer data)
+{
+	int sock_type = GPOINTER_TO_INT(data);
+	struct throughput_data t = { 0 };
+	GObex *client, *server;
+	guint timer_id;
+	gint64 elapsed;
+	int sv[2];
+
+	if (socketpair(AF_UNIX, sock_type | SOCK_NONBLOCK, 0, sv) < 0) {
+		g_printerr("socketpair: %s", strerror(errno));
+		abort();
+	}
+
+	client = create_throughput_gobex(sv[0], sock_type);
+	server = create_throughput_gobex(sv[1], sock_type);
+
+	g_obex_add_request_function(server, G_OBEX_OP_CONNECT,
+						handle_conn_throughput, &t);
+	g_obex_add_request_function(server, G_OBEX_OP_PUT,
+						handle_put_throughput, &t);
+
+	t.mainloop = g_main_loop_new(NULL, FALSE);
+
+	timer_id = g_timeout_add_seconds(10, throughput_timeout, &t);
+
+	g_obex_connect(client, conn_complete_throughput, &t, &t.err,
+							G_OBEX_HDR_INVALID);
+	g_assert_no_error(t.err);
+
+	g_main_loop_run(t.mainloop);
+
+	elapsed = g_get_monotonic_time() - t.start;
+
+	g_main_loop_unref(t.mainloop);
+
+	g_source_remove(timer_id);
+	g_obex_unref(client);
+	g_obex_unref(server);
+
+	g_assert_no_error(t.err);
+	g_assert_cmpuint(t.received, ==, THROUGHPUT_SIZE);
+
+	if (g_test_verbose())
+		g_print("%s: %zu bytes in %u packets, %.1f MB/s\n",
+				sock_type == SOCK_STREAM ? "stream" : "packet",
+				t.received, t.packets,
+				elapsed > 0 ? (double) t.received / elapsed : 0);
+}
+
 int main(int argc, char *argv[])
 {
 	g_test_init(&argc, &argv, NULL);
@@ -2394,5 +2572,12 @@ int main(int argc, char *argv[])
 	g_test_add_func("/gobex/test_conn_put_req_seq_srm",
 						test_conn_put_req_seq_srm);
 
+	g_test_add_data_func("/gobex/test_stream_put_throughput",
+				GINT_TO_POINTER(SOCK_STREAM),
+				test_put_throughput);
+	g_test_add_data_func("/gobex/test_packet_put_throughput",
+				GINT_TO_POINTER(SOCK_SEQPACKET),
+				test_put_throughput);
+
 	return g_test_run();
 }
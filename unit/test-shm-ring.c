@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: GPL-2.0-or-later
+/*
+ *
+ *  BlueZ - Bluetooth protocol stack for Linux
+ *
+ */
+
+#ifdef HAVE_CONFIG_H
+#include <config.h>
+#endif
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <unistd.h>
+
+#include <glib.h>
+
+#include "src/shared/shm-ring.h"
+#include "src/shared/tester.h"
+
+static struct shm_ring *attach_reader(struct shm_ring *writer)
+{
+	struct shm_ring *reader;
+	int fd;
+
+	fd = dup(shm_ring_get_fd(writer));
+	g_assert(fd >= 0);
+
+	reader = shm_ring_attach(fd);
+	g_assert(reader != NULL);
+
+	return reader;
+}
+
+static bool write_packet(struct shm_ring *ring, uint8_t value, size_t len)
+{
+	uint8_t buf[1024];
+	struct iovec iov;
+
+	memset(buf, value, len);
+
+	iov.iov_base = buf;
+	iov.iov_len = len;
+
+	return shm_ring_write(ring, &iov, 1);
+}
+
+static void test_alloc(const void *data)
+{
+	struct shm_ring *writer, *reader;
+
+	writer = shm_ring_new("test", 5000);
+	g_assert(writer != NULL);
+	g_assert(shm_ring_get_size(writer) == 8192);
+
+	reader = attach_reader(writer);
+	g_assert(shm_ring_get_size(reader) == 8192);
+
+	/* Readers can't write */
+	g_assert(!write_packet(reader, 0, 16));
+
+	shm_ring_free(reader);
+	shm_ring_free(writer);
+
+	/* Packets must not take more than a quarter of the ring */
+	writer = shm_ring_new("test", 4096);
+	g_assert(writer != NULL);
+	g_assert(!write_packet(writer, 0, 1024));
+	g_assert(write_packet(writer, 0, 1000));
+
+	shm_ring_free(writer);
+
+	tester_test_passed();
+}
+
+static void test_wrap(const void *data)
+{
+	struct shm_ring *writer, *reader;
+	uint8_t buf[1024];
+	uint64_t seq;
+	int i;
+
+	writer = shm_ring_new("test", 4096);
+	reader = attach_reader(writer);
+
+	g_assert(shm_ring_read(reader, buf, sizeof(buf), &seq) == -EAGAIN);
+
+	for (i = 0; i < 1000; i++) {
+		size_t len = 1 + (i * 7) % 500;
+		ssize_t ret;
+
+		tester_debug("Iteration %i\n", i);
+
+		g_assert(write_packet(writer, i, len));
+
+		ret = shm_ring_read(reader, buf, sizeof(buf), &seq);
+		g_assert(ret == (ssize_t) len);
+		g_assert(seq == (uint64_t) i);
+		g_assert(buf[0] == (uint8_t) i && buf[len - 1] == (uint8_t) i);
+	}
+
+	g_assert(shm_ring_read(reader, buf, sizeof(buf), &seq) == -EAGAIN);
+	g_assert(shm_ring_get_overruns(reader) == 0);
+
+	shm_ring_free(reader);
+	shm_ring_free(writer);
+
+	tester_test_passed();
+}
+
+static void test_overrun(const void *data)
+{
+	struct shm_ring *writer, *reader;
+	uint8_t buf[1024];
+	uint64_t seq, last;
+	int i;
+
+	writer = shm_ring_new("test", 4096);
+	reader = attach_reader(writer);
+
+	for (i = 0; i < 100; i++)
+		g_assert(write_packet(writer, i, 200));
+
+	/* The reader resumes from the oldest packet still available */
+	g_assert(shm_ring_read(reader, buf, sizeof(buf), &seq) == 200);
+	g_assert(shm_ring_get_overruns(reader) == 1);
+	g_assert(seq > 0 && buf[0] == (uint8_t) seq);
+
+	last = seq;
+
+	while (shm_ring_read(reader, buf, sizeof(buf), &seq) > 0) {
+		g_assert(seq == last + 1);
+		last = seq;
+	}
+
+	g_assert(last == 99);
+
+	shm_ring_free(reader);
+	shm_ring_free(writer);
+
+	tester_test_passed();
+}
+
+static void test_readers(const void *data)
+{
+	struct shm_ring *writer, *reader1, *reader2;
+	uint8_t buf[1024];
+	uint64_t seq;
+	int i;
+
+	writer = shm_ring_new("test", 4096);
+	reader1 = attach_reader(writer);
+	reader2 = attach_reader(writer);
+
+	for (i = 0; i < 4; i++)
+		g_assert(write_packet(writer, i, 64));
+
+	/* Each reader consumes at its own pace */
+	for (i = 0; i < 4; i++) {
+		g_assert(shm_ring_read(reader1, buf, sizeof(buf), &seq) == 64);
+		g_assert(seq == (uint64_t) i);
+	}
+
+	g_assert(shm_ring_read(reader1, buf, sizeof(buf), &seq) == -EAGAIN);
+
+	g_assert(shm_ring_read(reader2, buf, sizeof(buf), &seq) == 64);
+	g_assert(seq == 0);
+
+	/* Packets too large for the buffer are skipped */
+	g_assert(shm_ring_read(reader2, buf, 16, &seq) == -EMSGSIZE);
+	g_assert(shm_ring_read(reader2, buf, sizeof(buf), &seq) == 64);
+	g_assert(seq == 2);
+
+	shm_ring_free(reader2);
+	shm_ring_free(reader1);
+	shm_ring_free(writer);
+
+	tester_test_passed();
+}
+
+int main(int argc, char *argv[])
+{
+	tester_init(&argc, &argv);
+
+	tester_add("/shm-ring/alloc", NULL, NULL, test_alloc, NULL);
+	tester_add("/shm-ring/wrap", NULL, NULL, test_wrap, NULL);
+	tester_add("/shm-ring/overrun", NULL, NULL, test_overrun, NULL);
+	tester_add("/shm-ring/readers", NULL, NULL, test_readers, NULL);
+
+	return tester_run();
+}
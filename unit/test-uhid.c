@@ -225,6 +225,14 @@ static const struct uhid_event ev_feature = {
 	.type = UHID_FEATURE,
 };
 
+static const uint8_t input_report[] = { 0x01, 0x7f, 0x80, 0x00 };
+
+static const uint8_t ev_input2[] = {
+	0x0c, 0x00, 0x00, 0x00,			/* UHID_INPUT2 */
+	0x04, 0x00,				/* size */
+	0x01, 0x7f, 0x80, 0x00,			/* data */
+};
+
 static void test_client(gconstpointer data)
 {
 	struct context *context = create_context(data);
@@ -245,6 +253,14 @@ static void test_client(gconstpointer data)
 	context_quit(context);
 }
 
+static void test_input(gconstpointer data)
+{
+	struct context *context = create_context(data);
+
+	g_assert_cmpint(bt_uhid_input(context->uhid, input_report,
+					sizeof(input_report)), ==, 0);
+}
+
 static void handle_output(struct uhid_event *ev, void *user_data)
 {
 	g_assert_cmpint(ev->type, ==, UHID_OUTPUT);
@@ -278,6 +294,7 @@ int main(int argc, char *argv[])
 	define_test("/uhid/command/feature_answer", test_client,
 						event(&ev_feature_answer));
 	define_test("/uhid/command/input", test_client, event(&ev_input));
+	define_test("/uhid/command/input2", test_input, event(&ev_input2));
 
 	define_test("/uhid/event/output", test_server, event(&ev_output));
 	define_test("/uhid/event/feature", test_server, event(&ev_feature));